@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2008, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2008, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -57,6 +57,7 @@ public class SSEBackend extends TreeScanner {
     private final JSLParser parser;
     private final JSLVisitor visitor;
     private final String body;
+    private final String vbody;
 
     public SSEBackend(JSLParser parser, JSLVisitor visitor, ProgramUnit program) {
         // TODO: will be removed once we clean up static usage
@@ -68,6 +69,17 @@ public class SSEBackend extends TreeScanner {
         SSETreeScanner scanner = new SSETreeScanner();
         scanner.scan(program);
         this.body = scanner.getResult();
+
+        String vbody;
+        try {
+            SSEVectorTreeScanner vscanner = new SSEVectorTreeScanner();
+            vscanner.scan(program);
+            vbody = vscanner.getResult();
+        } catch (SSEVectorTreeScanner.UnsupportedException e) {
+            // the peer only gets the scalar loop
+            vbody = null;
+        }
+        this.vbody = vbody;
     }
 
     public static class GenCode {
@@ -117,6 +129,11 @@ public class SSEBackend extends TreeScanner {
         StringBuilder cparamDecls = new StringBuilder();
         StringBuilder arrayGet = new StringBuilder();
         StringBuilder arrayRelease = new StringBuilder();
+        StringBuilder vparamDecls = new StringBuilder();
+        StringBuilder vparams = new StringBuilder();
+        StringBuilder vposLoad = new StringBuilder();
+        StringBuilder vposInitX = new StringBuilder();
+        StringBuilder vposStore = new StringBuilder();
 
         appendGetRelease(arrayGet, arrayRelease, "int", "dst", "dst_arr");
 
@@ -165,6 +182,10 @@ public class SSEBackend extends TreeScanner {
                     cparamDecls.append(",\n");
                     cparamDecls.append("j" + vtype + "Array " + vname);
                     appendGetRelease(arrayGet, arrayRelease, vtype, arrayName, vname);
+                    vparamDecls.append(",\n");
+                    vparamDecls.append("j" + vtype + " *" + arrayName);
+                    vparams.append(",\n");
+                    vparams.append(arrayName);
                 } else {
                     if (t.isVector()) {
                         String arrayName = vname + "_arr";
@@ -172,16 +193,22 @@ public class SSEBackend extends TreeScanner {
                         jparams.append(",\n");
                         jparamDecls.append(",\n");
                         cparamDecls.append(",\n");
+                        vparamDecls.append(",\n");
+                        vparams.append(",\n");
                         for (int i = 0; i < t.getNumFields(); i++) {
                             if (i > 0) {
                                 jparams.append(", ");
                                 jparamDecls.append(", ");
                                 cparamDecls.append(", ");
+                                vparamDecls.append(", ");
+                                vparams.append(", ");
                             }
                             String vn = vname + getSuffix(i);
                             jparams.append(arrayName + "[" + i + "]");
                             jparamDecls.append(vtype + " " + vn);
                             cparamDecls.append("j" + vtype + " " + vn);
+                            vparamDecls.append("j" + vtype + " " + vn);
+                            vparams.append(vn);
                         }
                     } else {
                         constants.append(vtype + " " + vname);
@@ -197,6 +224,10 @@ public class SSEBackend extends TreeScanner {
                         jparamDecls.append(vtype + " " + vname);
                         cparamDecls.append(",\n");
                         cparamDecls.append("j" + vtype + " " + vname);
+                        vparamDecls.append(",\n");
+                        vparamDecls.append("j" + vtype + " " + vname);
+                        vparams.append(",\n");
+                        vparams.append(vname);
                     }
                 }
             } else if (v.getQualifier() == Qualifier.PARAM && bt == BaseType.SAMPLER) {
@@ -287,6 +318,26 @@ public class SSEBackend extends TreeScanner {
                     appendGetRelease(arrayGet, arrayRelease, "int", vname, vname + "_arr");
                 }
 
+                // the vector loops step pos_x across the lanes by the same
+                // additions as the scalar loop, and hand it back to the
+                // scalar loop for the pixels they leave over
+                String ctype = (t == Type.FSAMPLER) ? "jfloat" : "jint";
+                vparamDecls.append(",\n");
+                vparamDecls.append(ctype + " *" + vname + ",\n");
+                vparamDecls.append("float pos" + i + "_y, float *pos" + i + "_xp, float inc" + i + "_x,\n");
+                vparamDecls.append("jint src" + i + "w, jint src" + i + "h, jint src" + i + "scan");
+                vparams.append(",\n");
+                vparams.append(vname + ",\n");
+                vparams.append("pos" + i + "_y, &pos" + i + "_x, inc" + i + "_x,\n");
+                vparams.append("src" + i + "w, src" + i + "h, src" + i + "scan");
+                vposLoad.append("float pos" + i + "_xs = *pos" + i + "_xp;\n");
+                vposInitX.append("for (int i = 0; i < VF::LANES; i++) {\n");
+                vposInitX.append("    lanebuf[i] = pos" + i + "_xs;\n");
+                vposInitX.append("    pos" + i + "_xs += inc" + i + "_x;\n");
+                vposInitX.append("}\n");
+                vposInitX.append("VF pos" + i + "_x = VF::load(lanebuf);\n");
+                vposStore.append("*pos" + i + "_xp = pos" + i + "_xs;\n");
+
                 posDecls.append("float inc" + i + "_x = (src" + i + "Rect_x2 - src" + i + "Rect_x1) / dstw;\n");
                 posDecls.append("float inc" + i + "_y = (src" + i + "Rect_y2 - src" + i + "Rect_y1) / dsth;\n");
 
@@ -349,6 +400,22 @@ public class SSEBackend extends TreeScanner {
         cglue.add("posIncrX", posIncrX.toString());
         cglue.add("posInitX", posInitX.toString());
         cglue.add("body", body);
+        if (vbody != null) {
+            // one loop for SSE2 and one for AVX2 machines, which
+            // SSEUtils.h builds for AVX2 between DECORA_AVX2_BEGIN/END
+            cglue.add("vloops", true);
+            for (int lanes : new int[] {4, 8}) {
+                ST vloop = group.getInstanceOf("vloop");
+                vloop.add("lanes", lanes);
+                vloop.add("paramDecls", vparamDecls.toString());
+                vloop.add("posLoad", vposLoad.toString());
+                vloop.add("posInitX", vposInitX.toString());
+                vloop.add("posStore", vposStore.toString());
+                vloop.add("body", vbody);
+                cglue.add("vloop" + lanes, vloop.render());
+            }
+            cglue.add("vparams", vparams.toString());
+        }
 
         GenCode gen = new GenCode();
         gen.javaCode = jglue.render();
@@ -398,6 +465,19 @@ public class SSEBackend extends TreeScanner {
         resultVars.add(vname);
     }
 
+    private static Set<String> vectorResultVars = new HashSet<String>();
+    static boolean isVectorResultVarDeclared(String vname) {
+        return vectorResultVars.contains(vname);
+    }
+    static void declareVectorResultVar(String vname) {
+        vectorResultVars.add(vname);
+    }
+
+    private static int vectorMasks = 0;
+    static String newVectorMask() {
+        return "mask" + (vectorMasks++);
+    }
+
     private static StringBuilder usercode = new StringBuilder();
     static void addGlueBlock(String block) {
         usercode.append(block);
@@ -406,6 +486,8 @@ public class SSEBackend extends TreeScanner {
     private static void resetStatics() {
         funcDefs.clear();
         resultVars.clear();
+        vectorResultVars.clear();
+        vectorMasks = 0;
         usercode = new StringBuilder();
     }
 }
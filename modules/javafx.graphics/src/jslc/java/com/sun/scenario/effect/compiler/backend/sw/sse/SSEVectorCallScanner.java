@@ -0,0 +1,318 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.scenario.effect.compiler.backend.sw.sse;
+
+import java.util.HashSet;
+import java.util.List;
+import java.util.Set;
+import com.sun.scenario.effect.compiler.model.BaseType;
+import com.sun.scenario.effect.compiler.model.FuncImpl;
+import com.sun.scenario.effect.compiler.model.Function;
+import com.sun.scenario.effect.compiler.model.Param;
+import com.sun.scenario.effect.compiler.model.Type;
+import com.sun.scenario.effect.compiler.model.Variable;
+import com.sun.scenario.effect.compiler.tree.ArrayAccessExpr;
+import com.sun.scenario.effect.compiler.tree.BinaryExpr;
+import com.sun.scenario.effect.compiler.tree.CallExpr;
+import com.sun.scenario.effect.compiler.tree.Expr;
+import com.sun.scenario.effect.compiler.tree.FieldSelectExpr;
+import com.sun.scenario.effect.compiler.tree.LiteralExpr;
+import com.sun.scenario.effect.compiler.tree.ParenExpr;
+import com.sun.scenario.effect.compiler.tree.TreeScanner;
+import com.sun.scenario.effect.compiler.tree.UnaryExpr;
+import com.sun.scenario.effect.compiler.tree.VariableExpr;
+import com.sun.scenario.effect.compiler.tree.VectorCtorExpr;
+
+import static com.sun.scenario.effect.compiler.backend.sw.sse.SSEBackend.*;
+
+/**
+ * The counterpart of SSECallScanner for the vector loops: inlines the
+ * calls of an ExprStmt or VarDecl ahead of it in the same way, declaring
+ * the float results and parameters as VF.  A user-defined function is
+ * inlined under the mask of the statement calling it, so that its own
+ * conditions only take the lanes the statement updates.
+ */
+class SSEVectorCallScanner extends TreeScanner {
+    private final String mask;
+    private StringBuilder sb;
+    private boolean inCallExpr = false;
+    private Set<Integer> selectedFields = null;
+    private boolean inFieldSelect = false;
+    private char selectedField = 'x';
+    private boolean inVectorOp = false;
+    private int vectorIndex = 0;
+
+    SSEVectorCallScanner(String mask) {
+        this.mask = mask;
+    }
+
+    private void output(String s) {
+        if (sb == null) {
+            sb = new StringBuilder();
+        }
+        sb.append(s);
+    }
+
+    String getResult() {
+        return (sb != null) ? sb.toString() : null;
+    }
+
+    @Override
+    public void visitCallExpr(CallExpr e) {
+        if (inCallExpr) {
+            throw new InternalError("Nested function calls not yet supported");
+        }
+
+        Function func = e.getFunction();
+        Type t = func.getReturnType();
+        String vname = func.getName();
+        FuncImpl impl = SSEVectorFuncImpls.get(func);
+        if (t.getBaseType() != BaseType.FLOAT ||
+            (impl == null && SSEBackend.getFuncDef(vname) == null))
+        {
+            throw new SSEVectorTreeScanner.UnsupportedException(
+                "no vector version of " + vname + "()");
+        }
+        String vtype = "VF";
+        Set<Integer> fields = selectedFields;
+        if (t.isVector()) {
+            if (fields == null) {
+                fields = new HashSet<Integer>();
+                for (int i = 0; i < t.getNumFields(); i++) {
+                    fields.add(i);
+                }
+            }
+        }
+        if (!SSEBackend.isVectorResultVarDeclared(vname)) {
+            // only declare result variables if they haven't been already
+            // (see SSECallScanner)
+            SSEBackend.declareVectorResultVar(vname);
+            if (t.isVector()) {
+                output(vtype + " ");
+                boolean first = true;
+                for (Integer f : fields) {
+                    if (first) {
+                        first = false;
+                    } else {
+                        output(", ");
+                    }
+                    output(vname + "_res" + getSuffix(f));
+                }
+                output(";\n");
+            } else {
+                output(vtype + " " + vname + "_res;\n");
+            }
+        }
+
+        inCallExpr = true;
+        output("{\n");
+        List<Param> params = func.getParams();
+        List<Expr> argExprs = e.getParams();
+        for (int i = 0; i < params.size(); i++) {
+            Param param = params.get(i);
+            String pname = param.getName();
+            Type ptype = param.getType();
+            BaseType pbasetype = ptype.getBaseType();
+            if (pbasetype == BaseType.SAMPLER) {
+                // skip these for now
+                continue;
+            }
+            if (pbasetype != BaseType.FLOAT &&
+                SSEVectorTreeScanner.isVarying(argExprs.get(i)))
+            {
+                throw new SSEVectorTreeScanner.UnsupportedException(
+                    "varying " + pbasetype + " argument of " + vname + "()");
+            }
+            String ptypeName = SSEVectorTreeScanner.getVectorType(pbasetype);
+            if (ptype.isVector()) {
+                inVectorOp = true;
+                for (int j = 0; j < ptype.getNumFields(); j++) {
+                    vectorIndex = j;
+                    output(ptypeName);
+                    output(" ");
+                    output(pname + "_tmp" + getSuffix(j) + " = ");
+                    scan(argExprs.get(i));
+                    output(";\n");
+                }
+                inVectorOp = false;
+            } else {
+                output(ptypeName);
+                output(" ");
+                output(pname + "_tmp = ");
+                scan(argExprs.get(i));
+                output(";\n");
+            }
+        }
+
+        if (impl != null) {
+            // core (built-in) function
+            String preamble = impl.getPreamble(argExprs);
+            if (preamble != null) {
+                output(preamble);
+            }
+
+            if (t.isVector()) {
+                for (Integer f : fields) {
+                    output(vname + "_res" + getSuffix(f) + " = ");
+                    output(impl.toString(f, argExprs));
+                    output(";\n");
+                }
+            } else {
+                output(vname + "_res = ");
+                output(impl.toString(0, argExprs));
+                output(";\n");
+            }
+        } else {
+            // user-defined function
+            SSEVectorTreeScanner scanner = new SSEVectorTreeScanner(func.getName(), mask);
+            scanner.scan(SSEBackend.getFuncDef(func.getName()).getStmt());
+            output(scanner.getResult());
+        }
+
+        output("\n}\n");
+        inCallExpr = false;
+    }
+
+    @Override
+    public void visitArrayAccessExpr(ArrayAccessExpr e) {
+        if (inCallExpr) {
+            if (e.getExpr() instanceof VariableExpr &&
+                e.getIndex() instanceof VariableExpr)
+            {
+                VariableExpr ve = (VariableExpr)e.getExpr();
+                VariableExpr ie = (VariableExpr)e.getIndex();
+                output(ve.getVariable().getName());
+                output("_arr[" + ie.getVariable().getName());
+                output(" * " + ve.getVariable().getType().getNumFields());
+                output(" + " + getFieldIndex(selectedField) + "]");
+            } else {
+                throw new InternalError("Array access only supports variable expr/index (for now)");
+            }
+        } else {
+            super.visitArrayAccessExpr(e);
+        }
+    }
+
+    @Override
+    public void visitBinaryExpr(BinaryExpr e) {
+        if (inCallExpr) {
+            scan(e.getLeft());
+            output(" " + e.getOp() + " ");
+            scan(e.getRight());
+        } else {
+            super.visitBinaryExpr(e);
+        }
+    }
+
+    @Override
+    public void visitFieldSelectExpr(FieldSelectExpr e) {
+        if (inCallExpr) {
+            if (e.getFields().length() == 1) {
+                selectedField = e.getFields().charAt(0);
+            } else {
+                int index = inVectorOp ? vectorIndex : 0;
+                selectedField = e.getFields().charAt(index);
+            }
+            inFieldSelect = true;
+            scan(e.getExpr());
+            inFieldSelect = false;
+        } else {
+            selectedFields = getFieldSet(e.getFields());
+            super.visitFieldSelectExpr(e);
+            selectedFields = null;
+        }
+    }
+
+    private static Set<Integer> getFieldSet(String fields) {
+        Set<Integer> fieldSet = new HashSet<Integer>();
+        for (int i = 0; i < fields.length(); i++) {
+            fieldSet.add(getFieldIndex(fields.charAt(i)));
+        }
+        return fieldSet;
+    }
+
+    @Override
+    public void visitLiteralExpr(LiteralExpr e) {
+        if (inCallExpr) {
+            output(e.getValue().toString());
+            if (e.getValue() instanceof Float) {
+                output("f");
+            }
+        } else {
+            super.visitLiteralExpr(e);
+        }
+    }
+
+    @Override
+    public void visitParenExpr(ParenExpr e) {
+        if (inCallExpr) {
+            output("(");
+            scan(e.getExpr());
+            output(")");
+        } else {
+            super.visitParenExpr(e);
+        }
+    }
+
+    @Override
+    public void visitUnaryExpr(UnaryExpr e) {
+        if (inCallExpr) {
+            output(e.getOp().toString());
+            scan(e.getExpr());
+        } else {
+            super.visitUnaryExpr(e);
+        }
+    }
+
+    @Override
+    public void visitVariableExpr(VariableExpr e) {
+        if (inCallExpr) {
+            Variable var = e.getVariable();
+            output(var.getName());
+            if (var.isParam()) {
+                output("_tmp");
+            }
+            if (var.getType().isVector()) {
+                if (inFieldSelect) {
+                    output(getSuffix(getFieldIndex(selectedField)));
+                } else if (inVectorOp) {
+                    output(getSuffix(vectorIndex));
+                } else {
+                    throw new InternalError("TBD");
+                }
+            }
+        } else {
+            super.visitVariableExpr(e);
+        }
+    }
+
+    @Override
+    public void visitVectorCtorExpr(VectorCtorExpr e) {
+        // TODO: this will likely work for simple variables and literals,
+        // but we need something more for embedded function calls, etc...
+        scan(e.getParams().get(vectorIndex));
+    }
+}
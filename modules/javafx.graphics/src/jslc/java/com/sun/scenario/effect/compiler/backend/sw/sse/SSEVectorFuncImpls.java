@@ -0,0 +1,385 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.scenario.effect.compiler.backend.sw.sse;
+
+import java.util.Arrays;
+import java.util.HashMap;
+import java.util.List;
+import java.util.Map;
+import com.sun.scenario.effect.compiler.model.CoreSymbols;
+import com.sun.scenario.effect.compiler.model.FuncImpl;
+import com.sun.scenario.effect.compiler.model.Function;
+import com.sun.scenario.effect.compiler.model.Type;
+import com.sun.scenario.effect.compiler.tree.Expr;
+import com.sun.scenario.effect.compiler.tree.VariableExpr;
+
+import static com.sun.scenario.effect.compiler.backend.sw.sse.SSEBackend.*;
+import static com.sun.scenario.effect.compiler.model.Type.*;
+
+/**
+ * Contains the implementations of the core (built-in) functions for the
+ * vector loops, in terms of the VF helpers in SSEUtils.h.  Functions
+ * missing here (intcast, mod, ddx and ddy) have no vector version, and
+ * programs calling them are only given the scalar loop.
+ */
+class SSEVectorFuncImpls {
+
+    private static Map<Function, FuncImpl> funcs = new HashMap<Function, FuncImpl>();
+
+    static FuncImpl get(Function func) {
+        return funcs.get(func);
+    }
+
+    static {
+        // float4 sample(sampler s, float2 loc)
+        declareFunctionSample(SAMPLER, "vsample");
+
+        // float4 sample(lsampler s, float2 loc)
+        declareFunctionSample(LSAMPLER, "vlsample");
+
+        // float4 sample(fsampler s, float2 loc)
+        declareFunctionSample(FSAMPLER, "vfsample");
+
+        // <ftype> min(<ftype> x, <ftype> y)
+        // <ftype> min(<ftype> x, float y)
+        declareOverloadsMinMax("min", "vmin(x_tmp$1, y_tmp$2)");
+
+        // <ftype> max(<ftype> x, <ftype> y)
+        // <ftype> max(<ftype> x, float y)
+        declareOverloadsMinMax("max", "vmax(x_tmp$1, y_tmp$2)");
+
+        // <ftype> clamp(<ftype> val, <ftype> min, <ftype> max)
+        // <ftype> clamp(<ftype> val, float min, float max)
+        declareOverloadsClamp();
+
+        // <ftype> smoothstep(<ftype> min, <ftype> max, <ftype> val)
+        // <ftype> smoothstep(float min, float max, <ftype> val)
+        declareOverloadsSmoothstep();
+
+        // <ftype> abs(<ftype> x)
+        declareOverloadsSimple("abs", "vfabs(x_tmp$1)");
+
+        // <ftype> floor(<ftype> x)
+        declareOverloadsSimple("floor", "vfloor(x_tmp$1)");
+
+        // <ftype> ceil(<ftype> x)
+        declareOverloadsSimple("ceil", "vceil(x_tmp$1)");
+
+        // <ftype> fract(<ftype> x)
+        declareOverloadsSimple("fract", "(x_tmp$1 - vfloor(x_tmp$1))");
+
+        // <ftype> sign(<ftype> x)
+        declareOverloadsSimple("sign", "vsign(x_tmp$1)");
+
+        // <ftype> sqrt(<ftype> x)
+        declareOverloadsSimple("sqrt", "vsqrt(x_tmp$1)");
+
+        // <ftype> sin(<ftype> x)
+        declareOverloadsSimple("sin", "vsin(x_tmp$1)");
+
+        // <ftype> cos(<ftype> x)
+        declareOverloadsSimple("cos", "vcos(x_tmp$1)");
+
+        // <ftype> tan(<ftype> x)
+        declareOverloadsSimple("tan", "vtan(x_tmp$1)");
+
+        // <ftype> pow(<ftype> x, <ftype> y)
+        declareOverloadsSimple2("pow", "vpow(x_tmp$1, y_tmp$2)");
+
+        // float dot(<ftype> x, <ftype> y)
+        declareOverloadsDot();
+
+        // float distance(<ftype> x, <ftype> y)
+        declareOverloadsDistance();
+
+        // <ftype> mix(<ftype> x, <ftype> y, <ftype> a)
+        // <ftype> mix(<ftype> x, <ftype> y, float a)
+        declareOverloadsMix();
+
+        // <ftype> normalize(<ftype> x)
+        declareOverloadsNormalize();
+    }
+
+    private static void declareFunction(FuncImpl impl,
+                                        String name, Type... ptypes)
+    {
+        Function f = CoreSymbols.getFunction(name, Arrays.asList(ptypes));
+        if (f == null) {
+            throw new InternalError("Core function not found (have you declared the function in CoreSymbols?)");
+        }
+        funcs.put(f, impl);
+    }
+
+    /**
+     * Used to declare sample function:
+     *   float4 sample([l,f]sampler s, float2 loc)
+     */
+    private static void declareFunctionSample(final Type type, final String helper) {
+        FuncImpl fimpl = new FuncImpl() {
+            @Override
+            public String getPreamble(List<Expr> params) {
+                VariableExpr e = (VariableExpr)params.get(0);
+                String s = e.getVariable().getName();
+                String p = "src" + e.getVariable().getReg();
+                return
+                    "VF " + s + "_vals[4];\n" +
+                    helper + "(" + s + ", loc_tmp_x, loc_tmp_y,\n" +
+                    "        " + p + "w, " + p + "h, " + p + "scan,\n" +
+                    "        " + s + "_vals);\n";
+            }
+            public String toString(int i, List<Expr> params) {
+                VariableExpr e = (VariableExpr)params.get(0);
+                return (i < 0 || i > 3) ? null : e.getVariable().getName() + "_vals[" + i + "]";
+            }
+        };
+        declareFunction(fimpl, "sample", type, FLOAT2);
+    }
+
+    /**
+     * Used to declare simple functions of the following form:
+     *   <ftype> name(<ftype> x)
+     */
+    private static void declareOverloadsSimple(String name, final String pattern) {
+        for (Type type : new Type[] {FLOAT, FLOAT2, FLOAT3, FLOAT4}) {
+            final boolean useSuffix = (type != FLOAT);
+            FuncImpl fimpl = new FuncImpl() {
+                public String toString(int i, List<Expr> params) {
+                    String sfx = useSuffix ? getSuffix(i) : "";
+                    return pattern.replace("$1", sfx);
+                }
+            };
+            declareFunction(fimpl, name, type);
+        }
+    }
+
+    /**
+     * Used to declare simple two parameter functions of the following form:
+     *   <ftype> name(<ftype> x, <ftype> y)
+     */
+    private static void declareOverloadsSimple2(String name, final String pattern) {
+        for (Type type : new Type[] {FLOAT, FLOAT2, FLOAT3, FLOAT4}) {
+            final boolean useSuffix = (type != FLOAT);
+            FuncImpl fimpl = new FuncImpl() {
+                public String toString(int i, List<Expr> params) {
+                    String sfx = useSuffix ? getSuffix(i) : "";
+                    return pattern.replace("$1", sfx).replace("$2", sfx);
+                }
+            };
+            declareFunction(fimpl, name, type, type);
+        }
+    }
+
+    /**
+     * Used to declare normalize functions of the following form:
+     *   <ftype> normalize(<ftype> x)
+     */
+    private static void declareOverloadsNormalize() {
+        final String name = "normalize";
+        final String pattern = "x_tmp$1 / denom";
+        for (Type type : new Type[] {FLOAT, FLOAT2, FLOAT3, FLOAT4}) {
+            int n = type.getNumFields();
+            final String preamble;
+            if (n == 1) {
+                preamble = "VF denom = x_tmp;\n";
+            } else {
+                String     s  =    "(x_tmp_x * x_tmp_x)";
+                           s += "+\n(x_tmp_y * x_tmp_y)";
+                if (n > 2) s += "+\n(x_tmp_z * x_tmp_z)";
+                if (n > 3) s += "+\n(x_tmp_w * x_tmp_w)";
+                preamble = "VF denom = vsqrt(" + s + ");\n";
+            }
+
+            final boolean useSuffix = (type != FLOAT);
+            FuncImpl fimpl = new FuncImpl() {
+                @Override
+                public String getPreamble(List<Expr> params) {
+                    return preamble;
+                }
+                public String toString(int i, List<Expr> params) {
+                    String sfx = useSuffix ? getSuffix(i) : "";
+                    return pattern.replace("$1", sfx);
+                }
+            };
+            declareFunction(fimpl, name, type);
+        }
+    }
+
+    /**
+     * Used to declare dot functions of the following form:
+     *   float dot(<ftype> x, <ftype> y)
+     */
+    private static void declareOverloadsDot() {
+        final String name = "dot";
+        for (final Type type : new Type[] {FLOAT, FLOAT2, FLOAT3, FLOAT4}) {
+            int n = type.getNumFields();
+            String s;
+            if (n == 1) {
+                s = "(x_tmp * y_tmp)";
+            } else {
+                           s  =    "(x_tmp_x * y_tmp_x)";
+                           s += "+\n(x_tmp_y * y_tmp_y)";
+                if (n > 2) s += "+\n(x_tmp_z * y_tmp_z)";
+                if (n > 3) s += "+\n(x_tmp_w * y_tmp_w)";
+            }
+            final String str = s;
+            FuncImpl fimpl = new FuncImpl() {
+                public String toString(int i, List<Expr> params) {
+                    return str;
+                }
+            };
+            declareFunction(fimpl, name, type, type);
+        }
+    }
+
+    /**
+     * Used to declare distance functions of the following form:
+     *   float distance(<ftype> x, <ftype> y)
+     */
+    private static void declareOverloadsDistance() {
+        final String name = "distance";
+        for (final Type type : new Type[] {FLOAT, FLOAT2, FLOAT3, FLOAT4}) {
+            int n = type.getNumFields();
+            String s;
+            if (n == 1) {
+                s = "(x_tmp - y_tmp) * (x_tmp - y_tmp)";
+            } else {
+                           s  =    "((x_tmp_x - y_tmp_x) * (x_tmp_x - y_tmp_x))";
+                           s += "+\n((x_tmp_y - y_tmp_y) * (x_tmp_y - y_tmp_y))";
+                if (n > 2) s += "+\n((x_tmp_z - y_tmp_z) * (x_tmp_z - y_tmp_z))";
+                if (n > 3) s += "+\n((x_tmp_w - y_tmp_w) * (x_tmp_w - y_tmp_w))";
+            }
+            final String str = "vsqrt(" + s + ")";
+            FuncImpl fimpl = new FuncImpl() {
+                public String toString(int i, List<Expr> params) {
+                    return str;
+                }
+            };
+            declareFunction(fimpl, name, type, type);
+        }
+    }
+
+    /**
+     * Used to declare min/max functions of the following form:
+     *   <ftype> name(<ftype> x, <ftype> y)
+     *   <ftype> name(<ftype> x, float y)
+     */
+    private static void declareOverloadsMinMax(String name, final String pattern) {
+        for (Type type : new Type[] {FLOAT, FLOAT2, FLOAT3, FLOAT4}) {
+            // declare (vectype,vectype) variants
+            final boolean useSuffix = (type != FLOAT);
+            FuncImpl fimpl = new FuncImpl() {
+                public String toString(int i, List<Expr> params) {
+                    String sfx = useSuffix ? getSuffix(i) : "";
+                    return pattern.replace("$1", sfx).replace("$2", sfx);
+                }
+            };
+            declareFunction(fimpl, name, type, type);
+
+            if (type == FLOAT) {
+                continue;
+            }
+
+            // declare (vectype,float) variants
+            fimpl = new FuncImpl() {
+                public String toString(int i, List<Expr> params) {
+                    return pattern.replace("$1", getSuffix(i)).replace("$2", "");
+                }
+            };
+            declareFunction(fimpl, name, type, FLOAT);
+        }
+    }
+
+    /**
+     * Used to declare clamp functions of the following form:
+     *   <ftype> clamp(<ftype> val, <ftype> min, <ftype> max)
+     *   <ftype> clamp(<ftype> val, float min, float max)
+     */
+    private static void declareOverloadsClamp() {
+        declareOverloads3("clamp", "vclamp(val_tmp$1, min_tmp$2, max_tmp$2)", 1);
+    }
+
+    /**
+     * Used to declare smoothstep functions of the following form:
+     *   <ftype> smoothstep(<ftype> min, <ftype> max, <ftype> val)
+     *   <ftype> smoothstep(float min, float max, <ftype> val)
+     */
+    private static void declareOverloadsSmoothstep() {
+        declareOverloads3("smoothstep", "vsmoothstep(min_tmp$2, max_tmp$2, val_tmp$1)", 0);
+    }
+
+    /**
+     * Used to declare mix functions of the following form:
+     *   <ftype> mix(<ftype> x, <ftype> y, <ftype> a)
+     *   <ftype> mix(<ftype> x, <ftype> y, float a)
+     */
+    private static void declareOverloadsMix() {
+        declareOverloads3("mix", "(x_tmp$1 * (1.0f - a_tmp$2) + y_tmp$1 * a_tmp$2)", 2);
+    }
+
+    /**
+     * Used to declare three parameter functions, in a variant with three
+     * <ftype> parameters and one where the parameters marked $2 in the
+     * pattern are floats:
+     *   floatVariant 0: <ftype> name(float, float, <ftype>)
+     *   floatVariant 1: <ftype> name(<ftype>, float, float)
+     *   floatVariant 2: <ftype> name(<ftype>, <ftype>, float)
+     */
+    private static void declareOverloads3(String name, final String pattern, int floatVariant) {
+        for (Type type : new Type[] {FLOAT, FLOAT2, FLOAT3, FLOAT4}) {
+            // declare (vectype,vectype,vectype) variants
+            final boolean useSuffix = (type != FLOAT);
+            FuncImpl fimpl = new FuncImpl() {
+                public String toString(int i, List<Expr> params) {
+                    String sfx = useSuffix ? getSuffix(i) : "";
+                    return pattern.replace("$1", sfx).replace("$2", sfx);
+                }
+            };
+            declareFunction(fimpl, name, type, type, type);
+
+            if (type == FLOAT) {
+                continue;
+            }
+
+            // declare the variants with float parameters
+            fimpl = new FuncImpl() {
+                public String toString(int i, List<Expr> params) {
+                    return pattern.replace("$1", getSuffix(i)).replace("$2", "");
+                }
+            };
+            switch (floatVariant) {
+            case 0:
+                declareFunction(fimpl, name, FLOAT, FLOAT, type);
+                break;
+            case 1:
+                declareFunction(fimpl, name, type, FLOAT, FLOAT);
+                break;
+            default:
+                declareFunction(fimpl, name, type, type, FLOAT);
+                break;
+            }
+        }
+    }
+}
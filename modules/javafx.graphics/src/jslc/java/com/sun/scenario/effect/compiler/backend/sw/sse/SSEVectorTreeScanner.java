@@ -0,0 +1,563 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.scenario.effect.compiler.backend.sw.sse;
+
+import java.util.ArrayDeque;
+import java.util.Deque;
+import java.util.HashMap;
+import java.util.Map;
+import com.sun.scenario.effect.compiler.model.BaseType;
+import com.sun.scenario.effect.compiler.model.BinaryOpType;
+import com.sun.scenario.effect.compiler.model.Qualifier;
+import com.sun.scenario.effect.compiler.model.Type;
+import com.sun.scenario.effect.compiler.model.UnaryOpType;
+import com.sun.scenario.effect.compiler.model.Variable;
+import com.sun.scenario.effect.compiler.tree.*;
+import static com.sun.scenario.effect.compiler.backend.sw.sse.SSEBackend.getFieldIndex;
+import static com.sun.scenario.effect.compiler.backend.sw.sse.SSEBackend.getSuffix;
+
+/**
+ * Emits the body of the vector loops, which shade VF::LANES adjacent
+ * pixels at once.  Each float of the program becomes a VF holding its
+ * value for every one of those pixels, so the statements read as the
+ * scalar ones from SSETreeScanner do; ints, which the programs only use
+ * as loop counters, stay scalar.
+ *
+ * An if statement whose condition depends on the pixel runs each branch
+ * that any lane takes, under a VM mask of the lanes taking it, and the
+ * assignments made there to variables declared outside of the branch only
+ * update those lanes:
+ *     if (h < 0.0) {
+ *         h += 1.0;
+ *     }
+ * ==>
+ *     {
+ *     VM mask0 = (h < 0.0f);
+ *     if (any(mask0)) {
+ *     h = vselect(mask0, h + (1.0f), h);
+ *     }
+ *     }
+ *
+ * Loops, breaks and returns that would differ between the lanes, and ints
+ * computed from floats, have no such translation; for these the scanner
+ * throws UnsupportedException, and the peer keeps only its scalar loop.
+ */
+class SSEVectorTreeScanner extends TreeScanner {
+
+    static class UnsupportedException extends RuntimeException {
+        UnsupportedException(String message) {
+            super(message);
+        }
+    }
+
+    private final String funcName;
+    private final String baseMask;
+    private final StringBuilder sb = new StringBuilder();
+
+    // the masks of the enclosing pixel-dependent branches, innermost first
+    private final Deque<String> masks = new ArrayDeque<String>();
+    // the number of those masks where each local variable was declared
+    private final Map<Variable, Integer> declDepths = new HashMap<Variable, Integer>();
+
+    private boolean inVectorOp = false;
+    private int vectorIndex = 0;
+    private boolean inFieldSelect = false;
+    private char selectedField = 'x';
+
+    SSEVectorTreeScanner() {
+        this(null, null);
+    }
+
+    /**
+     * Creates a scanner for the body of the user-defined function
+     * funcName, inlined where the lanes in baseMask (or all of them, if
+     * null) are taken.
+     */
+    SSEVectorTreeScanner(String funcName, String baseMask) {
+        this.funcName = funcName;
+        this.baseMask = baseMask;
+    }
+
+    private void output(String s) {
+        sb.append(s);
+    }
+
+    String getResult() {
+        return (sb != null) ? sb.toString() : null;
+    }
+
+    /**
+     * Returns the C type that holds a variable of the given base type in
+     * the vector loops.
+     */
+    static String getVectorType(BaseType type) {
+        switch (type) {
+        case FLOAT:
+            return "VF";
+        case INT:
+            return "int";
+        default:
+            throw new UnsupportedException("no vector version of " + type);
+        }
+    }
+
+    /**
+     * Returns true for the variables that can hold different values for
+     * different pixels: the float locals (including the color output),
+     * function parameters and built-in positions.  Params, constants and
+     * ints are the same for all of the pixels.
+     */
+    static boolean isVarying(Variable var) {
+        if (var.getType().getBaseType() != BaseType.FLOAT) {
+            return false;
+        }
+        Qualifier q = var.getQualifier();
+        return var.isParam() || q == null ||
+            (q == Qualifier.CONST && var.getConstValue() == null);
+    }
+
+    /**
+     * Returns true if the value of the expression can differ between the
+     * pixels.
+     */
+    static boolean isVarying(Expr expr) {
+        final boolean[] varying = new boolean[1];
+        new TreeScanner() {
+            @Override
+            public void visitCallExpr(CallExpr e) {
+                varying[0] = true;
+            }
+            @Override
+            public void visitVariableExpr(VariableExpr e) {
+                if (isVarying(e.getVariable())) {
+                    varying[0] = true;
+                }
+            }
+        }.scan(expr);
+        return varying[0];
+    }
+
+    private String getMask() {
+        return masks.isEmpty() ? baseMask : masks.peek();
+    }
+
+    private String capture(Tree tree) {
+        int start = sb.length();
+        scan(tree);
+        String s = sb.substring(start);
+        sb.setLength(start);
+        return s;
+    }
+
+    private static Variable getAssignedVariable(Expr lhs) {
+        if (lhs instanceof VariableExpr) {
+            return ((VariableExpr)lhs).getVariable();
+        } else if (lhs instanceof FieldSelectExpr) {
+            return getAssignedVariable(((FieldSelectExpr)lhs).getExpr());
+        } else if (lhs instanceof ParenExpr) {
+            return getAssignedVariable(((ParenExpr)lhs).getExpr());
+        }
+        throw new UnsupportedException("assignment to " + lhs);
+    }
+
+    private void checkUnmasked(String what) {
+        if (!masks.isEmpty()) {
+            throw new UnsupportedException(what + " under a pixel-dependent condition");
+        }
+    }
+
+    private void checkUniform(Expr expr, String what) {
+        if (expr != null && isVarying(expr)) {
+            throw new UnsupportedException("pixel-dependent " + what);
+        }
+    }
+
+    private void outputAssignment(BinaryExpr e) {
+        Variable var = getAssignedVariable(e.getLeft());
+        if (!isVarying(var)) {
+            // only loop counters and the like, which must stay the same
+            // for all of the lanes
+            if (getMask() != null) {
+                throw new UnsupportedException("int assignment under a pixel-dependent condition");
+            }
+            checkUniform(e.getRight(), "int assignment");
+            scan(e);
+            output(";\n");
+            return;
+        }
+
+        // variables declared under the current mask only live in the
+        // lanes it takes, so they need no masking
+        String mask = getMask();
+        Integer depth = declDepths.get(var);
+        if (depth != null && depth == masks.size()) {
+            mask = null;
+        }
+
+        Type t = e.getResultType();
+        int n = t.isVector() ? t.getNumFields() : 1;
+        inVectorOp = t.isVector();
+        for (int i = 0; i < n; i++) {
+            vectorIndex = i;
+            if (mask == null) {
+                scan(e);
+                output(";\n");
+            } else {
+                String lhs = capture(e.getLeft());
+                String rhs = capture(e.getRight());
+                BinaryOpType op = e.getOp();
+                String val = (op == BinaryOpType.EQ) ? rhs :
+                    lhs + " " + op.getSymbol().charAt(0) + " (" + rhs + ")";
+                output(lhs + " = vselect(" + mask + ", " + val + ", " + lhs + ");\n");
+            }
+        }
+        inVectorOp = false;
+    }
+
+    @Override
+    public void visitArrayAccessExpr(ArrayAccessExpr e) {
+        if (e.getExpr() instanceof VariableExpr &&
+            e.getIndex() instanceof VariableExpr)
+        {
+            VariableExpr ve = (VariableExpr)e.getExpr();
+            VariableExpr ie = (VariableExpr)e.getIndex();
+            output(ve.getVariable().getName());
+            output("_arr[" + ie.getVariable().getName());
+            output(" * " + ve.getVariable().getType().getNumFields());
+            output(" + " + getFieldIndex(selectedField) + "]");
+        } else {
+            throw new InternalError("Array access only supports variable expr/index (for now)");
+        }
+    }
+
+    @Override
+    public void visitBinaryExpr(BinaryExpr e) {
+        if (e.getOp() == BinaryOpType.XOR) {
+            throw new UnsupportedException("^^");
+        }
+        scan(e.getLeft());
+        output(" " + e.getOp() + " ");
+        scan(e.getRight());
+    }
+
+    @Override
+    public void visitBreakStmt(BreakStmt s) {
+        checkUnmasked("break");
+        output("break;");
+    }
+
+    @Override
+    public void visitCallExpr(CallExpr e) {
+        output(e.getFunction().getName() + "_res");
+        if (e.getFunction().getReturnType().isVector()) {
+            if (inFieldSelect) {
+                output(getSuffix(getFieldIndex(selectedField)));
+            } else if (inVectorOp) {
+                output(getSuffix(vectorIndex));
+            } else {
+                throw new InternalError("TBD");
+            }
+        }
+    }
+
+    @Override
+    public void visitCompoundStmt(CompoundStmt s) {
+        output("{\n");
+        super.visitCompoundStmt(s);
+        output("}\n");
+    }
+
+    @Override
+    public void visitContinueStmt(ContinueStmt s) {
+        checkUnmasked("continue");
+        output("continue;");
+    }
+
+    @Override
+    public void visitDiscardStmt(DiscardStmt s) {
+        // TODO: not yet implemented
+    }
+
+    @Override
+    public void visitDoWhileStmt(DoWhileStmt s) {
+        checkUniform(s.getExpr(), "loop condition");
+        output("do ");
+        scan(s.getStmt());
+        output(" while (");
+        scan(s.getExpr());
+        output(");");
+    }
+
+    @Override
+    public void visitExprStmt(ExprStmt s) {
+        Expr expr = s.getExpr();
+
+        outputPreambles(expr);
+
+        if (expr instanceof BinaryExpr && ((BinaryExpr)expr).getOp().isAssignment()) {
+            outputAssignment((BinaryExpr)expr);
+        } else {
+            checkUnmasked("statement");
+            Type t = expr.getResultType();
+            if (t.isVector()) {
+                inVectorOp = true;
+                for (int i = 0; i < t.getNumFields(); i++) {
+                    vectorIndex = i;
+                    scan(expr);
+                    output(";\n");
+                }
+                inVectorOp = false;
+            } else {
+                scan(expr);
+                output(";\n");
+            }
+        }
+    }
+
+    @Override
+    public void visitFieldSelectExpr(FieldSelectExpr e) {
+        if (e.getFields().length() == 1) {
+            selectedField = e.getFields().charAt(0);
+        } else {
+            int index = inVectorOp ? vectorIndex : 0;
+            selectedField = e.getFields().charAt(index);
+        }
+        inFieldSelect = true;
+        scan(e.getExpr());
+        inFieldSelect = false;
+    }
+
+    @Override
+    public void visitForStmt(ForStmt s) {
+        checkUniform(s.getCondition(), "loop condition");
+        checkUniform(s.getExpr(), "loop expression");
+        output("for (");
+        scan(s.getInit());
+        scan(s.getCondition());
+        output(";");
+        scan(s.getExpr());
+        output(")");
+        scan(s.getStmt());
+    }
+
+    @Override
+    public void visitFuncDef(FuncDef d) {
+        // the other functions were saved by SSETreeScanner and are
+        // inlined at their calls
+        if (d.getFunction().getName().equals("main")) {
+            scan(d.getStmt());
+        }
+    }
+
+    @Override
+    public void visitGlueBlock(GlueBlock b) {
+        // already added by SSETreeScanner
+    }
+
+    @Override
+    public void visitLiteralExpr(LiteralExpr e) {
+        output(e.getValue().toString());
+        if (e.getValue() instanceof Float) {
+            output("f");
+        }
+    }
+
+    @Override
+    public void visitParenExpr(ParenExpr e) {
+        output("(");
+        scan(e.getExpr());
+        output(")");
+    }
+
+    @Override
+    public void visitReturnStmt(ReturnStmt s) {
+        Expr expr = s.getExpr();
+        if (expr == null) {
+            throw new InternalError("Empty return not yet implemented");
+        }
+        if (funcName == null) {
+            throw new RuntimeException("Return statement not expected");
+        }
+        // the lanes not taking the function's branches would go on past
+        // a return in one of them
+        checkUnmasked("return");
+
+        // the lanes outside of baseMask may be given any result, as the
+        // statement using it ignores them
+        Type t = expr.getResultType();
+        if (t.isVector()) {
+            inVectorOp = true;
+            for (int i = 0; i < t.getNumFields(); i++) {
+                vectorIndex = i;
+                output(funcName + "_res" + getSuffix(i) + " = ");
+                scan(s.getExpr());
+                output(";\n");
+            }
+            inVectorOp = false;
+        } else {
+            output(funcName + "_res = ");
+            scan(s.getExpr());
+            output(";\n");
+        }
+    }
+
+    @Override
+    public void visitSelectStmt(SelectStmt s) {
+        Expr cond = s.getIfExpr();
+        Stmt e = s.getElseStmt();
+        if (!isVarying(cond)) {
+            output("if (");
+            scan(cond);
+            output(") {\n");
+            scan(s.getThenStmt());
+            output("}\n");
+            if (e != null) {
+                output("else {\n");
+                scan(e);
+                output("}\n");
+            }
+            return;
+        }
+
+        // both masks are computed before either branch can change the
+        // variables the condition reads
+        String parent = getMask();
+        String c = capture(cond);
+        String thenMask = SSEBackend.newVectorMask();
+        String elseMask = (e != null) ? SSEBackend.newVectorMask() : null;
+        output("{\n");
+        output("VM " + thenMask + " = " +
+               (parent != null ? parent + " && " : "") + "(" + c + ");\n");
+        if (e != null) {
+            output("VM " + elseMask + " = " +
+                   (parent != null ? parent + " && " : "") + "!(" + c + ");\n");
+        }
+        masks.push(thenMask);
+        output("if (any(" + thenMask + ")) {\n");
+        scan(s.getThenStmt());
+        output("}\n");
+        masks.pop();
+        if (e != null) {
+            masks.push(elseMask);
+            output("if (any(" + elseMask + ")) {\n");
+            scan(e);
+            output("}\n");
+            masks.pop();
+        }
+        output("}\n");
+    }
+
+    @Override
+    public void visitUnaryExpr(UnaryExpr e) {
+        UnaryOpType op = e.getOp();
+        if ((op == UnaryOpType.INC || op == UnaryOpType.DEC) && isVarying(e.getExpr())) {
+            throw new UnsupportedException(op + " of a float");
+        }
+        output(op.toString());
+        scan(e.getExpr());
+    }
+
+    @Override
+    public void visitVarDecl(VarDecl d) {
+        Variable var = d.getVariable();
+        if (var.getQualifier() != null) {
+            // these will be declared separately outside the loop body
+            return;
+        }
+
+        outputPreambles(d);
+
+        Type t = var.getType();
+        String vtype = getVectorType(t.getBaseType());
+        Expr init = d.getInit();
+        if (!isVarying(var)) {
+            checkUniform(init, "int initializer");
+        }
+        declDepths.put(var, masks.size());
+        if (t.isVector()) {
+            inVectorOp = true;
+            for (int i = 0; i < t.getNumFields(); i++) {
+                output(vtype + " ");
+                output(var.getName() + getSuffix(i));
+                if (init != null) {
+                    output(" = ");
+                    vectorIndex = i;
+                    scan(init);
+                }
+                output(";\n");
+            }
+            inVectorOp = false;
+        } else {
+            output(vtype + " " + var.getName());
+            if (init != null) {
+                output(" = ");
+                scan(init);
+            }
+            output(";\n");
+        }
+    }
+
+    @Override
+    public void visitVariableExpr(VariableExpr e) {
+        Variable var = e.getVariable();
+        output(var.getName());
+        if (var.isParam()) {
+            output("_tmp");
+        }
+        if (var.getType().isVector()) {
+            if (inFieldSelect) {
+                output(getSuffix(getFieldIndex(selectedField)));
+            } else if (inVectorOp) {
+                output(getSuffix(vectorIndex));
+            } else {
+                throw new InternalError("TBD");
+            }
+        }
+    }
+
+    @Override
+    public void visitVectorCtorExpr(VectorCtorExpr e) {
+        scan(e.getParams().get(vectorIndex));
+    }
+
+    @Override
+    public void visitWhileStmt(WhileStmt s) {
+        checkUniform(s.getCondition(), "loop condition");
+        output("while (");
+        scan(s.getCondition());
+        output(")");
+        scan(s.getStmt());
+    }
+
+    private void outputPreambles(Tree tree) {
+        SSEVectorCallScanner scanner = new SSEVectorCallScanner(getMask());
+        scanner.scan(tree);
+        String res = scanner.getResult();
+        if (res != null) {
+            output(res);
+        }
+    }
+}
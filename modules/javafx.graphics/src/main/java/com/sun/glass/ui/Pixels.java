@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -84,6 +84,10 @@ public abstract class Pixels {
     private final float scalex;
     private final float scaley;
 
+    // The part of the image that changed since the previously uploaded
+    // frame. It covers the whole image unless the producer narrows it.
+    private int dirtyX, dirtyY, dirtyWidth, dirtyHeight;
+
     protected Pixels(final int width, final int height, final ByteBuffer pixels) {
         this(width, height, pixels, 1.0f, 1.0f);
     }
@@ -107,6 +111,7 @@ public abstract class Pixels {
         this.ints = null;
         this.scalex = scalex;
         this.scaley = scaley;
+        resetDirtyRegion();
     }
 
     protected Pixels(final int width, final int height, IntBuffer pixels) {
@@ -132,6 +137,7 @@ public abstract class Pixels {
         this.bytes = null;
         this.scalex = scalex;
         this.scaley = scaley;
+        resetDirtyRegion();
     }
 
     public final float getScaleX() {
@@ -175,6 +181,72 @@ public abstract class Pixels {
         return this.bytesPerComponent;
     }
 
+    /**
+     * Marks only the given rectangle, clipped to the image, as changed since
+     * the previously uploaded frame, so that a platform which supports it
+     * only needs to present that part of the image.
+     * May be called from any thread before the pixels are handed over for upload.
+     */
+    public final void setDirtyRegion(int x, int y, int w, int h) {
+        int x0 = Math.max(x, 0);
+        int y0 = Math.max(y, 0);
+        int x1 = Math.min(x + w, this.width);
+        int y1 = Math.min(y + h, this.height);
+        this.dirtyX = x0;
+        this.dirtyY = y0;
+        this.dirtyWidth = Math.max(x1 - x0, 0);
+        this.dirtyHeight = Math.max(y1 - y0, 0);
+    }
+
+    /**
+     * Marks the whole image as changed.
+     */
+    public final void resetDirtyRegion() {
+        this.dirtyX = 0;
+        this.dirtyY = 0;
+        this.dirtyWidth = this.width;
+        this.dirtyHeight = this.height;
+    }
+
+    /**
+     * Extends the dirty region to also cover the dirty region of
+     * {@code other}, a frame that is replaced before it was presented.
+     */
+    public final void unionDirtyRegion(Pixels other) {
+        if (other.width != this.width || other.height != this.height) {
+            resetDirtyRegion();
+            return;
+        }
+        if (other.dirtyWidth == 0 || other.dirtyHeight == 0) {
+            return;
+        }
+        if (this.dirtyWidth == 0 || this.dirtyHeight == 0) {
+            setDirtyRegion(other.dirtyX, other.dirtyY, other.dirtyWidth, other.dirtyHeight);
+            return;
+        }
+        int x0 = Math.min(this.dirtyX, other.dirtyX);
+        int y0 = Math.min(this.dirtyY, other.dirtyY);
+        int x1 = Math.max(this.dirtyX + this.dirtyWidth, other.dirtyX + other.dirtyWidth);
+        int y1 = Math.max(this.dirtyY + this.dirtyHeight, other.dirtyY + other.dirtyHeight);
+        setDirtyRegion(x0, y0, x1 - x0, y1 - y0);
+    }
+
+    public final int getDirtyX() {
+        return this.dirtyX;
+    }
+
+    public final int getDirtyY() {
+        return this.dirtyY;
+    }
+
+    public final int getDirtyWidth() {
+        return this.dirtyWidth;
+    }
+
+    public final int getDirtyHeight() {
+        return this.dirtyHeight;
+    }
+
     /**
      * Rewinds and returns the buffer used to create this {@code Pixels} object.
      *
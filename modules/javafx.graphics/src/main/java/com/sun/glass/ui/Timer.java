@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,6 +25,7 @@
 package com.sun.glass.ui;
 
 import java.lang.annotation.Native;
+import java.util.concurrent.TimeUnit;
 
 /**
  * A high-resolution timer.
@@ -51,6 +52,15 @@ public abstract class Timer {
     protected abstract void _pause(long timer);
     protected abstract void _resume(long timer);
 
+    /**
+     * Starts a timer with a period in nanoseconds. Timers that can only
+     * tick on whole milliseconds inherit this version, which truncates
+     * the period.
+     */
+    protected long _start(Runnable runnable, long periodNanos) {
+        return _start(runnable, (int) TimeUnit.NANOSECONDS.toMillis(periodNanos));
+    }
+
     /**
      * Constructs a new timer.
      *
@@ -102,6 +112,33 @@ public abstract class Timer {
         }
     }
 
+    /**
+     * Starts the timer with a period in nanoseconds, so that rates such as
+     * 60 Hz are not rounded to whole milliseconds on systems whose timers
+     * are more precise. The period, in milliseconds, must be in the range
+     * getMinPeriod() .. getMaxPeriod().
+     * If the timer is currently started, it gets stopped before re-starting.
+     * If starting the timer fails, the RuntimeException is thrown.
+     */
+    public synchronized void startNanos(long periodNanos) {
+        double periodMillis = periodNanos / 1_000_000.0;
+        if (periodMillis < getMinPeriod() || periodMillis > getMaxPeriod()) {
+            throw new IllegalArgumentException("period is out of range");
+        }
+
+        if (this.ptr != 0L) {
+            stop();
+        }
+
+        this.ptr = _start(this.runnable, periodNanos);
+        if (this.ptr == 0L) {
+            this.period = UNSET_PERIOD;
+            throw new RuntimeException("Failed to start the timer");
+        } else {
+            this.period = periodMillis;
+        }
+    }
+
     /**
      * Start a vsync-based timer if the system supports it.
      *
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -219,7 +219,12 @@ final class GtkApplication extends Application implements
         final boolean disableGrab = (Boolean.getBoolean("sun.awt.disablegrab") ||
                Boolean.getBoolean("glass.disableGrab"));
 
-        _init(eventProc, disableGrab);
+        // Consecutive motion and scroll events are merged by default; apps
+        // that need the full pointer history can turn this off
+        final boolean coalesceEvents =
+                !"false".equalsIgnoreCase(System.getProperty("glass.gtk.coalesceEvents"));
+
+        _init(eventProc, disableGrab, coalesceEvents);
     }
 
     @Override
@@ -249,6 +254,7 @@ final class GtkApplication extends Application implements
     protected void finishTerminating() {
         final Thread toolkitThread = getEventThread();
         if (toolkitThread != null) {
+            GtkRobot._releaseScreenCapture();
             _terminateLoop();
             setEventThread(null);
         }
@@ -261,7 +267,7 @@ final class GtkApplication extends Application implements
 
     private native void _terminateLoop();
 
-    private native void _init(long eventProc, boolean disableGrab);
+    private native void _init(long eventProc, boolean disableGrab, boolean coalesceEvents);
 
     private native void _runLoop(Runnable launchable, boolean noErrorTrap);
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -36,6 +36,9 @@ import com.sun.glass.ui.Screen;
 
 final class GtkRobot extends GlassRobot {
 
+    // Keeps the shared capture image between captures of the same size
+    static final boolean captureStreaming = Boolean.getBoolean("glass.gtk.captureStreaming");
+
     @Override
     public void create() {
         // no-op
@@ -146,12 +149,17 @@ final class GtkRobot extends GlassRobot {
                 || XdgDesktopPortal.isRemoteDesktop()) && ScreencastHelper.isAvailable()) {
             ScreencastHelper.getRGBPixels((int) x, (int) y, 1, 1, result);
         } else {
-            _getScreenCapture((int) x, (int) y, 1, 1, result);
+            _getScreenCapture((int) x, (int) y, 1, 1, result, true, false);
         }
         return GlassRobot.convertFromIntArgb(result[0]);
     }
 
-    protected native void _getScreenCapture(int x, int y, int width, int height, int[] data);
+    // Captures through MIT-SHM if shm is set and possible, else GdkPixbuf
+    protected native void _getScreenCapture(int x, int y, int width, int height, int[] data,
+                                            boolean shm, boolean streaming);
+
+    // Releases the shared capture image kept by capture streaming
+    static native void _releaseScreenCapture();
 
     @Override
     public void getScreenCapture(int x, int y, int width, int height, int[] data, boolean scaleToFit) {
@@ -160,7 +168,7 @@ final class GtkRobot extends GlassRobot {
                 || XdgDesktopPortal.isRemoteDesktop()) && ScreencastHelper.isAvailable()) {
             ScreencastHelper.getRGBPixels(x, y, width, height, data);
         } else {
-            _getScreenCapture(x, y, width, height, data);
+            _getScreenCapture(x, y, width, height, data, true, captureStreaming);
         }
     }
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2018, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -28,6 +28,9 @@ import com.sun.glass.ui.Timer;
 
 final class GtkTimer extends Timer{
 
+    // Follows the presentation times of the GDK frame clock when set
+    private static final boolean useFrameClock = Boolean.getBoolean("glass.gtk.frameClockTimer");
+
     public GtkTimer(Runnable runnable) {
         super(runnable);
     }
@@ -37,7 +40,14 @@ final class GtkTimer extends Timer{
     }
 
     @Override
-    protected native long _start(Runnable runnable, int period);
+    protected long _start(Runnable runnable, int period) {
+        return _startTimer(runnable, period * 1_000_000L, useFrameClock);
+    }
+
+    @Override
+    protected long _start(Runnable runnable, long periodNanos) {
+        return _startTimer(runnable, periodNanos, useFrameClock);
+    }
 
     @Override
     protected native void _stop(long timer);
@@ -45,4 +55,19 @@ final class GtkTimer extends Timer{
     @Override protected void _pause(long timer) {}
     @Override protected void _resume(long timer) {}
 
+    /**
+     * Returns the jitter statistics of the GTK timers: the number of ticks,
+     * the number of skipped ticks, and the mean and maximum lateness of a
+     * tick in nanoseconds.
+     */
+    static long[] getStatistics() {
+        long[] stats = new long[4];
+        _getStatistics(stats);
+        return stats;
+    }
+
+    private static native long _startTimer(Runnable runnable, long periodNanos, boolean frameClock);
+
+    private static native void _getStatistics(long[] stats);
+
 }
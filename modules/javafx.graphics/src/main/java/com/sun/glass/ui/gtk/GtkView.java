@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -78,27 +78,52 @@ final class GtkView extends View {
     @Override
     protected void _end(long ptr) {}
 
+    // Number of pixel bytes sent to the X server by _uploadPixels, only
+    // touched on the event thread. Lets tests check that small updates
+    // present only their dirty region.
+    private static long presentedBytes;
+
+    static long getPresentedBytes() {
+        return presentedBytes;
+    }
+
+    // Selects between the XShm and the Cairo paths for frames presented
+    // from now on, on the event thread. XShm is used where the display
+    // supports it.
+    static native void _setShmEnabled(boolean enabled);
+
     @Override
     protected void _uploadPixels(long ptr, Pixels pixels) {
         Buffer data = pixels.getPixels();
+        int dx = pixels.getDirtyX();
+        int dy = pixels.getDirtyY();
+        int dw = pixels.getDirtyWidth();
+        int dh = pixels.getDirtyHeight();
+        long bytes;
         if (data.isDirect() == true) {
-            _uploadPixelsDirect(ptr, data, pixels.getWidth(), pixels.getHeight());
+            bytes = _uploadPixelsDirect(ptr, data, pixels.getWidth(), pixels.getHeight(), dx, dy, dw, dh);
         } else if (data.hasArray() == true) {
             if (pixels.getBytesPerComponent() == 1) {
-                ByteBuffer bytes = (ByteBuffer)data;
-                _uploadPixelsByteArray(ptr, bytes.array(), bytes.arrayOffset(), pixels.getWidth(), pixels.getHeight());
+                ByteBuffer byteData = (ByteBuffer)data;
+                bytes = _uploadPixelsByteArray(ptr, byteData.array(), byteData.arrayOffset(),
+                                               pixels.getWidth(), pixels.getHeight(), dx, dy, dw, dh);
             } else {
                 IntBuffer ints = (IntBuffer)data;
-                _uploadPixelsIntArray(ptr, ints.array(), ints.arrayOffset(), pixels.getWidth(), pixels.getHeight());
+                bytes = _uploadPixelsIntArray(ptr, ints.array(), ints.arrayOffset(),
+                                              pixels.getWidth(), pixels.getHeight(), dx, dy, dw, dh);
             }
         } else {
             // gznote: what are the circumstances under which this can happen?
-            _uploadPixelsDirect(ptr, pixels.asByteBuffer(), pixels.getWidth(), pixels.getHeight());
+            bytes = _uploadPixelsDirect(ptr, pixels.asByteBuffer(), pixels.getWidth(), pixels.getHeight(), dx, dy, dw, dh);
         }
+        presentedBytes += bytes;
     }
-    private native void _uploadPixelsDirect(long viewPtr, Buffer pixels, int width, int height);
-    private native void _uploadPixelsByteArray(long viewPtr, byte[] pixels, int offset, int width, int height);
-    private native void _uploadPixelsIntArray(long viewPtr, int[] pixels, int offset, int width, int height);
+    private native long _uploadPixelsDirect(long viewPtr, Buffer pixels, int width, int height,
+                                            int dirtyX, int dirtyY, int dirtyWidth, int dirtyHeight);
+    private native long _uploadPixelsByteArray(long viewPtr, byte[] pixels, int offset, int width, int height,
+                                               int dirtyX, int dirtyY, int dirtyWidth, int dirtyHeight);
+    private native long _uploadPixelsIntArray(long viewPtr, int[] pixels, int offset, int width, int height,
+                                              int dirtyX, int dirtyY, int dirtyWidth, int dirtyHeight);
 
     @Override
     protected native boolean _enterFullscreen(long ptr, boolean animate, boolean keepRatio, boolean hideCursor);
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.glass.ui.monocle;
+
+import java.nio.Buffer;
+import java.nio.ByteBuffer;
+
+/**
+ * Native pixel operations for the software framebuffer screens: source-over
+ * composition of premultiplied ARGB32 pixels, and conversion of ARGB32 to
+ * RGB565 or Y8 with optional ordered dithering. The operations work on
+ * rectangles of direct buffers, and fall back to Java when the glass_monocle
+ * library is not loaded, as on the headless platform.
+ * <p>
+ * Native composition is turned off with
+ * {@code -Dmonocle.nativeComposition=false}, and dithering is turned on with
+ * {@code -Dmonocle.dither=true}.</p>
+ */
+final class Compositor {
+
+    private static final boolean available = checkAvailable();
+
+    private Compositor() {
+    }
+
+    private static boolean checkAvailable() {
+        if (!MonocleSettings.settings.nativeComposition) {
+            return false;
+        }
+        try {
+            return isSupported();
+        } catch (UnsatisfiedLinkError e) {
+            return false;
+        }
+    }
+
+    /**
+     * Returns whether the native operations can be used for the given
+     * buffers.
+     */
+    static boolean isAvailable(Buffer... buffers) {
+        if (!available) {
+            return false;
+        }
+        for (Buffer b : buffers) {
+            if (!b.isDirect()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static boolean isDithering() {
+        return MonocleSettings.settings.dither;
+    }
+
+    private static native boolean isSupported();
+
+    /**
+     * Composes a rectangle of source pixels over the destination, with the
+     * source scaled by {@code alpha / 256}. Offsets and strides are in bytes.
+     */
+    static native void blend(ByteBuffer dst, int dstOffset, int dstStride,
+                             Buffer src, int srcOffset, int srcStride,
+                             int width, int height, int alpha);
+
+    /**
+     * Converts a rectangle of ARGB32 pixels to 1, 2 or 4 bytes per pixel.
+     * The position {@code x, y} of the rectangle on the screen sets the
+     * phase of the dither pattern. Offsets and strides are in bytes.
+     */
+    static native void convert(ByteBuffer dst, int dstOffset, int dstStride, int dstBytesPerPixel,
+                               ByteBuffer src, int srcOffset, int srcStride,
+                               int x, int y, int width, int height, boolean dither);
+}
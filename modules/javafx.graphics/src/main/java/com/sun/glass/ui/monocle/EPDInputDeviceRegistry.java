@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2019, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -180,10 +180,14 @@ class EPDInputDeviceRegistry extends InputDeviceRegistry {
             return null;
         } else {
             device.setInputProcessor(processor);
-            var thread = new Thread(device);
-            thread.setName(name);
-            thread.setDaemon(true);
-            thread.start();
+            var reader = device.getFileDescriptor() != -1
+                    ? LinuxInputReader.getInstance() : null;
+            if (reader == null || !reader.addDevice(device)) {
+                var thread = new Thread(device);
+                thread.setName(name);
+                thread.setDaemon(true);
+                thread.start();
+            }
             devices.add(device);
             return device;
         }
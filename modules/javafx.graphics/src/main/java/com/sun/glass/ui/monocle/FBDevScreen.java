@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -46,6 +46,8 @@ class FBDevScreen implements NativeScreen {
     private long nativeHandle;
     private FileChannel fbdev;
     private ByteBuffer mappedFB;
+    // Set when composing off screen for a mapped 16-bit framebuffer
+    private ByteBuffer composeBuffer;
     private boolean isShutdown;
     private int consoleCursorBlink;
     private Framebuffer fb;
@@ -144,15 +146,29 @@ class FBDevScreen implements NativeScreen {
                 // Only map 32-bit framebuffers with enough space for two
                 // full screens
                 mappedFB = linuxFB.getMappedBuffer();
+            } else if (linuxFB.getDepth() == 16 && linuxFB.canDoubleBuffer()
+                    && Compositor.isAvailable()) {
+                // 16-bit framebuffers are composed off screen, and converted
+                // into the back page on each swap
+                mappedFB = linuxFB.getMappedBuffer();
+                if (mappedFB != null) {
+                    composeBuffer = ByteBuffer.allocateDirect(getWidth() * getHeight() * 4);
+                }
             }
-            if (mappedFB != null) {
+            if (composeBuffer != null) {
+                bb = composeBuffer;
+            } else if (mappedFB != null) {
                 bb = mappedFB;
             } else {
                 bb = ByteBuffer.allocateDirect(getWidth() * getHeight() * 4);
             }
             bb.order(ByteOrder.nativeOrder());
-            fb = new Framebuffer(bb, getWidth(), getHeight(), getDepth(), true);
-            fb.setStartAddress(linuxFB.getNextAddress());
+            if (composeBuffer != null) {
+                fb = new Framebuffer(bb, getWidth(), getHeight(), 32, true);
+            } else {
+                fb = new Framebuffer(bb, getWidth(), getHeight(), getDepth(), true);
+                fb.setStartAddress(linuxFB.getNextAddress());
+            }
         }
         return fb;
     }
@@ -228,6 +244,12 @@ class FBDevScreen implements NativeScreen {
             }
             fbdev.position(linuxFB.getNextAddress());
             getFramebuffer().write(fbdev);
+        } else if (composeBuffer != null && linuxFB.isDoubleBuffer()) {
+            Compositor.convert(mappedFB, linuxFB.getNextAddress(), getWidth() * 2, 2,
+                               composeBuffer, 0, getWidth() * 4,
+                               0, 0, getWidth(), getHeight(), Compositor.isDithering());
+            linuxFB.next();
+            linuxFB.vSync();
         } else if (linuxFB.isDoubleBuffer()) {
             linuxFB.next();
             linuxFB.vSync();
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2014, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2014, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -31,6 +31,7 @@ import java.nio.ByteBuffer;
 import java.nio.ByteOrder;
 import java.nio.IntBuffer;
 import java.nio.ShortBuffer;
+import java.nio.channels.SeekableByteChannel;
 import java.nio.channels.WritableByteChannel;
 
 /**
@@ -47,7 +48,20 @@ class Framebuffer {
     private ByteBuffer clearBuffer;
     private ByteBuffer lineByteBuffer;
     private Buffer linePixelBuffer;
+    private ByteBuffer convertBuffer;
     private int address;
+    // Rows composed or cleared since the last write, all of them until the
+    // first write
+    private int dirtyTop;
+    private int dirtyBottom;
+    // Rows that may hold composed pixels, which the next frame clears. All of
+    // them until the first clear. Pages flipped through setStartAddress keep
+    // their own rows.
+    private int contentTop;
+    private int contentBottom;
+    private int otherAddress = -1;
+    private int otherContentTop;
+    private int otherContentBottom;
 
     Framebuffer(ByteBuffer bb, int width, int height, int depth, boolean clear) {
         this.bb = bb;
@@ -57,6 +71,10 @@ class Framebuffer {
         if (clear) {
             clearBuffer = ByteBuffer.allocate(width * 4);
         }
+        dirtyTop = 0;
+        dirtyBottom = height;
+        contentTop = 0;
+        contentBottom = height;
     }
 
     ByteBuffer getBuffer() {
@@ -69,23 +87,122 @@ class Framebuffer {
     }
 
     void setStartAddress(int address) {
+        if (address == this.address) {
+            return;
+        }
+        int top = contentTop;
+        int bottom = contentBottom;
+        if (address == otherAddress) {
+            contentTop = otherContentTop;
+            contentBottom = otherContentBottom;
+        } else {
+            contentTop = 0;
+            contentBottom = height;
+        }
+        otherAddress = this.address;
+        otherContentTop = top;
+        otherContentBottom = bottom;
         this.address = address;
     }
 
     void clearBufferContents() {
-        bb.clear();
-        bb.position(address);
-        bb.limit(address + width * height * 4);
-        for (int i = 0; i < height; i++) {
-            clearBuffer.clear();
-            bb.put(clearBuffer);
+        clearRows(0, height);
+    }
+
+    private void clearRows(int top, int bottom) {
+        if (top < bottom) {
+            bb.clear();
+            bb.position(address + top * width * 4);
+            bb.limit(address + bottom * width * 4);
+            for (int i = top; i < bottom; i++) {
+                clearBuffer.clear();
+                bb.put(clearBuffer);
+            }
+            dirtyTop = Math.min(dirtyTop, top);
+            dirtyBottom = Math.max(dirtyBottom, bottom);
         }
+        contentTop = height;
+        contentBottom = 0;
     }
 
     boolean hasReceivedData() {
         return receivedData;
     }
 
+    /**
+     * Returns the first row composed since the last call to
+     * {@link #clearDirtyRows}.
+     */
+    int getDirtyTop() {
+        return dirtyTop;
+    }
+
+    /**
+     * Returns the row after the last one composed since the last call to
+     * {@link #clearDirtyRows}.
+     */
+    int getDirtyBottom() {
+        return dirtyBottom;
+    }
+
+    void clearDirtyRows() {
+        dirtyTop = height;
+        dirtyBottom = 0;
+    }
+
+    /**
+     * Returns the range of rows to write to the channel, and moves the
+     * position of a seekable channel to the first of them. Channels that
+     * cannot seek get all rows.
+     */
+    int[] getRowsToWrite(WritableByteChannel out, int bytesPerPixel) throws IOException {
+        if (out instanceof SeekableByteChannel) {
+            SeekableByteChannel channel = (SeekableByteChannel) out;
+            int top = Math.min(dirtyTop, dirtyBottom);
+            channel.position(channel.position() + (long) top * width * bytesPerPixel);
+            return new int[] { top, dirtyBottom };
+        }
+        return new int[] { 0, height };
+    }
+
+    /**
+     * Converts the given rows of the composition buffer natively and writes
+     * them to the channel, or copies them to the buffer when {@code out} is
+     * null. Returns false if the conversion is not available.
+     */
+    boolean convertRows(WritableByteChannel out, ByteBuffer outBuffer,
+                        int top, int bottom, int bytesPerPixel) throws IOException {
+        if (bottom <= top) {
+            return Compositor.isAvailable(bb);
+        }
+        int size = (bottom - top) * width * bytesPerPixel;
+        if (outBuffer != null) {
+            if (!Compositor.isAvailable(bb, outBuffer)) {
+                return false;
+            }
+            Compositor.convert(outBuffer, outBuffer.position(), width * bytesPerPixel, bytesPerPixel,
+                               bb, top * width * 4, width * 4,
+                               0, top, width, bottom - top, Compositor.isDithering());
+            outBuffer.position(outBuffer.position() + size);
+            return true;
+        }
+        if (!Compositor.isAvailable(bb)) {
+            return false;
+        }
+        if (convertBuffer == null || convertBuffer.capacity() < size) {
+            convertBuffer = ByteBuffer.allocateDirect(width * height * bytesPerPixel);
+        }
+        Compositor.convert(convertBuffer, 0, width * bytesPerPixel, bytesPerPixel,
+                           bb, top * width * 4, width * 4,
+                           0, top, width, bottom - top, Compositor.isDithering());
+        convertBuffer.clear();
+        convertBuffer.limit(size);
+        while (convertBuffer.hasRemaining()) {
+            out.write(convertBuffer);
+        }
+        return true;
+    }
+
     void composePixels(Buffer src,
                               int pX, int pY, int pW, int pH,
                               float alpha) {
@@ -111,18 +228,31 @@ class Framebuffer {
         if (pW < 0 || pH < 0 || alphaMultiplier <= 0) {
             return;
         }
-        // If clearBuffer is set, clear the buffer on the first upload of each
-        // frame, unless that upload already overwrites the whole buffer.
+        // Both blend paths draw 255 / 256 and above as opaque
+        if (alphaMultiplier >= 255) {
+            alphaMultiplier = 256;
+        }
+        // If clearBuffer is set, clear the rows composed into by the previous
+        // frame on the first upload of each frame, unless that upload already
+        // overwrites the whole buffer.
         if (!receivedData && clearBuffer != null) {
             if (alphaMultiplier < 256 || start != 0 || pW != width || pH != height) {
-                clearBufferContents();
+                clearRows(contentTop, contentBottom);
             }
         }
+        if (pW > 0 && pH > 0) {
+            dirtyTop = Math.min(dirtyTop, pY);
+            dirtyBottom = Math.max(dirtyBottom, pY + pH);
+            contentTop = Math.min(contentTop, pY);
+            contentBottom = Math.max(contentBottom, pY + pH);
+        }
         bb.position(address + pX * 4 + pY * width * 4);
         bb.limit(bb.capacity());
         // TODO: use a back buffer in Java when double buffering is not available in /dev/fb0
-        // TODO: move alpha blending into native
-        if (receivedData) {
+        if (receivedData && Compositor.isAvailable(bb, src)) {
+            Compositor.blend(bb, address + pX * 4 + pY * width * 4, width * 4,
+                             src, start, stride, pW, pH, alphaMultiplier);
+        } else if (receivedData) {
             IntBuffer srcPixels;
             if (src instanceof IntBuffer) {
                 srcPixels = ((IntBuffer) src);
@@ -133,7 +263,7 @@ class Framebuffer {
             for (int i = 0; i < pH; i++) {
                 int dstPosition = i * width;
                 int srcPosition = (start + i * stride) >> 2;
-                if (alphaMultiplier >= 255) {
+                if (alphaMultiplier == 256) {
                     for (int j = 0; j < pW; j++) {
                         int srcPixel = srcPixels.get(srcPosition + j);
                         int srcA = (srcPixel >> 24) & 0xff;
@@ -143,7 +273,7 @@ class Framebuffer {
                             dstPixels.put(dstPosition + j,
                                           blend32(srcPixel,
                                                   dstPixels.get(dstPosition + j),
-                                                  256));
+                                                  alphaMultiplier));
                         }
                     }
                 } else {
@@ -192,35 +322,45 @@ class Framebuffer {
         receivedData = true;
     }
 
+    /**
+     * Composes a premultiplied source pixel over a premultiplied destination
+     * pixel, with the source scaled by {@code alphaMultiplier / 256}. Gives
+     * the same result as the native composition.
+     */
     private static int blend32(int src, int dst, int alphaMultiplier) {
         int srcA = (((src >> 24) & 0xff) * alphaMultiplier) >> 8;
-        int srcR = (src >> 16) & 0xff;
-        int srcG = (src >> 8) & 0xff;
-        int srcB = src & 0xff;
-        int dstA = (dst >> 24) & 0xff;
-        int dstR = (dst >> 16) & 0xff;
-        int dstG = (dst >> 8) & 0xff;
-        int dstB = dst & 0xff;
-        dstR = (srcR * srcA / 255) + (dstR * dstA * (255 - srcA) / 0xff00);
-        dstG = (srcG * srcA / 255) + (dstG * dstA * (255 - srcA) / 0xff00);
-        dstB = (srcB * srcA / 255) + (dstB * dstA * (255 - srcA) / 0xff00);
-        dstA = srcA + (dstA * (255 - srcA) / 0xff);
-        return (dstA << 24)| (dstR << 16) | (dstG << 8) | dstB;
+        int inverse = 255 - srcA;
+        int result = 0;
+        for (int shift = 0; shift < 32; shift += 8) {
+            int s = (((src >> shift) & 0xff) * alphaMultiplier) >> 8;
+            int d = ((dst >> shift) & 0xff) * inverse + 128;
+            int c = s + ((d + (d >> 8)) >> 8);
+            result |= Math.min(c, 255) << shift;
+        }
+        return result;
     }
 
     void write(WritableByteChannel out) throws IOException {
+        int[] rows = getRowsToWrite(out, byteDepth);
+        clearDirtyRows();
         bb.clear();
         if (byteDepth == 4) {
+            bb.position(rows[0] * width * 4);
+            bb.limit(rows[1] * width * 4);
             out.write(bb);
         } else if (byteDepth == 2) {
+            if (convertRows(out, null, rows[0], rows[1], byteDepth)) {
+                return;
+            }
             if (lineByteBuffer == null) {
                 lineByteBuffer = ByteBuffer.allocate(width * 2);
                 lineByteBuffer.order(ByteOrder.nativeOrder());
                 linePixelBuffer = lineByteBuffer.asShortBuffer();
             }
             IntBuffer srcPixels = bb.asIntBuffer();
+            srcPixels.position(rows[0] * width);
             ShortBuffer shortBuffer = (ShortBuffer) linePixelBuffer;
-            for (int i = 0; i < height; i++) {
+            for (int i = rows[0]; i < rows[1]; i++) {
                 shortBuffer.clear();
                 for (int j = 0; j < width; j++) {
                     int pixel32 = srcPixels.get();
@@ -241,6 +381,13 @@ class Framebuffer {
         if (byteDepth == 4) {
             out.put(bb);
         } else if (byteDepth == 2) {
+            try {
+                if (convertRows(null, out, 0, height, byteDepth)) {
+                    return;
+                }
+            } catch (IOException e) {
+                // not thrown without a channel
+            }
             if (lineByteBuffer == null) {
                 lineByteBuffer = ByteBuffer.allocate(width * 2);
                 lineByteBuffer.order(ByteOrder.nativeOrder());
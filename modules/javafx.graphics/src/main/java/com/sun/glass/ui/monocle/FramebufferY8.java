@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, 2020, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2019, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -49,6 +49,13 @@ class FramebufferY8 extends Framebuffer {
      */
     private static final int BITS_TO_BYTES = 3;
 
+    /**
+     * The Rec. 709 luma coefficients scaled by 2<sup>16</sup>.
+     */
+    private static final int LUMA_R = 13933;
+    private static final int LUMA_G = 46871;
+    private static final int LUMA_B = 4732;
+
     private final PlatformLogger logger = Logging.getJavaFXLogger();
     private final ByteBuffer bb;
     private final int width;
@@ -98,10 +105,11 @@ class FramebufferY8 extends Framebuffer {
      * Rec. 2100 (HDR): Y' = 0.2627 * R' + 0.6780 * G' + 0.0593 * B'
      * }</pre>
      *
-     * @implNote Java rounds toward zero when converting a {@code float} to an
-     * {@code int}. The calculation of luma could be rounded to the nearest
-     * integer by adding 0.5 before the type conversion, but the extra operation
-     * seems unnecessary for a display with only 16 levels of gray.
+     * @implNote The coefficients are scaled by 2<sup>16</sup> so that luma is
+     * calculated in integer arithmetic, rounding toward zero, with the same
+     * result as the native conversion in {@link Compositor}. The result is
+     * within one level of the {@code float} calculation, which is more than
+     * enough for a display with only 16 levels of gray.
      *
      * @param source the source integer buffer in ARGB32 format
      * @param target the target byte buffer in Y8 format
@@ -111,7 +119,7 @@ class FramebufferY8 extends Framebuffer {
         int r = (pixel32 >> 16) & 0xFF;
         int g = (pixel32 >> 8) & 0xFF;
         int b = pixel32 & 0xFF;
-        int y = (int) (0.2126f * r + 0.7152f * g + 0.0722f * b);
+        int y = (LUMA_R * r + LUMA_G * g + LUMA_B * b) >> 16;
         target.put((byte) y);
     }
 
@@ -133,7 +141,8 @@ class FramebufferY8 extends Framebuffer {
 
     /**
      * Writes the contents of the composition buffer to the output channel,
-     * converting the pixel format as necessary.
+     * converting the pixel format as necessary. Only the rows composed since
+     * the last write are written to a seekable channel.
      *
      * @param out the output channel
      * @throws IOException if an error occurs writing to the channel
@@ -142,6 +151,11 @@ class FramebufferY8 extends Framebuffer {
      */
     @Override
     void write(WritableByteChannel out) throws IOException {
+        int[] rows = getRowsToWrite(out, byteDepth);
+        clearDirtyRows();
+        if (byteDepth != Integer.BYTES && convertRows(out, null, rows[0], rows[1], byteDepth)) {
+            return;
+        }
         bb.clear();
         switch (byteDepth) {
             case Byte.BYTES: {
@@ -151,8 +165,9 @@ class FramebufferY8 extends Framebuffer {
                     linePixelBuffer = lineByteBuffer.duplicate();
                 }
                 IntBuffer srcPixels = bb.asIntBuffer();
+                srcPixels.position(rows[0] * width);
                 ByteBuffer byteBuffer = (ByteBuffer) linePixelBuffer;
-                for (int y = 0; y < height; y++) {
+                for (int y = rows[0]; y < rows[1]; y++) {
                     byteBuffer.clear();
                     for (int x = 0; x < width; x++) {
                         copyNextPixel(srcPixels, byteBuffer);
@@ -169,8 +184,9 @@ class FramebufferY8 extends Framebuffer {
                     linePixelBuffer = lineByteBuffer.asShortBuffer();
                 }
                 IntBuffer srcPixels = bb.asIntBuffer();
+                srcPixels.position(rows[0] * width);
                 ShortBuffer shortBuffer = (ShortBuffer) linePixelBuffer;
-                for (int y = 0; y < height; y++) {
+                for (int y = rows[0]; y < rows[1]; y++) {
                     shortBuffer.clear();
                     for (int x = 0; x < width; x++) {
                         copyNextPixel(srcPixels, shortBuffer);
@@ -181,6 +197,8 @@ class FramebufferY8 extends Framebuffer {
                 break;
             }
             case Integer.BYTES: {
+                bb.position(rows[0] * width * Integer.BYTES);
+                bb.limit(rows[1] * width * Integer.BYTES);
                 out.write(bb);
                 break;
             }
@@ -201,6 +219,13 @@ class FramebufferY8 extends Framebuffer {
      */
     @Override
     void copyToBuffer(ByteBuffer out) {
+        try {
+            if (byteDepth != Integer.BYTES && convertRows(null, out, 0, height, byteDepth)) {
+                return;
+            }
+        } catch (IOException e) {
+            // not thrown without a channel
+        }
         bb.clear();
         switch (byteDepth) {
             case Byte.BYTES: {
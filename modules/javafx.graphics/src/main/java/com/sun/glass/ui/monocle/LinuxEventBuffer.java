@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -69,7 +69,7 @@ class LinuxEventBuffer {
      * SYN_REPORT. However it should not be too large or a flood of events will
      * prevent rendering from happening until the buffer is full.
      */
-    private static final int EVENT_BUFFER_SIZE = 1000;
+    static final int EVENT_BUFFER_SIZE = 1000;
 
     private final ByteBuffer bb;
     private final EventStruct eventStruct;
@@ -100,7 +100,62 @@ class LinuxEventBuffer {
             InterruptedException {
         boolean isSync = event.getShort(eventStruct.getTypeIndex()) == 0
                 && event.getInt(eventStruct.getValueIndex()) == 0;
-        while (bb.limit() - bb.position() < event.limit()) {
+        waitForSpace(event.limit());
+        if (isSync) {
+            positionOfLastSync = bb.position();
+        }
+        bb.put(event);
+        if (MonocleSettings.settings.traceEventsVerbose) {
+            int index = bb.position() - eventStruct.getSize();
+            MonocleTrace.traceEvent("Read %s [index=%d]",
+                                    getEventDescription(index), index);
+        }
+        return isSync;
+    }
+
+    /**
+     * Adds a frame of Linux events, each given by a short type, short code and
+     * int value, if the whole frame fits in the buffer. Does not block. The
+     * event time is left at zero, since input processors do not use it.
+     *
+     * @param events the buffer positioned at the first event of the frame,
+     * which is advanced past the frame if it was added
+     * @param count the number of events in the frame
+     * @return true if the frame was added, false if there is not enough space
+     */
+    synchronized boolean offerFrame(ByteBuffer events, int count) {
+        if (bb.limit() - bb.position() < count * eventStruct.getSize()) {
+            return false;
+        }
+        for (int i = 0; i < count; i++) {
+            putEvent(events.getShort(), events.getShort(), events.getInt());
+        }
+        return true;
+    }
+
+    private boolean putEvent(short type, short code, int value) {
+        boolean isSync = type == 0 && value == 0;
+        int size = eventStruct.getSize();
+        int index = bb.position();
+        if (isSync) {
+            positionOfLastSync = index;
+        }
+        for (int i = 0; i < eventStruct.getTypeIndex(); i++) {
+            bb.put(index + i, (byte) 0);
+        }
+        bb.putShort(index + eventStruct.getTypeIndex(), type);
+        bb.putShort(index + eventStruct.getCodeIndex(), code);
+        bb.putInt(index + eventStruct.getValueIndex(), value);
+        bb.position(index + size);
+        if (MonocleSettings.settings.traceEventsVerbose) {
+            MonocleTrace.traceEvent("Read %s [index=%d]",
+                                    getEventDescription(index), index);
+        }
+        return isSync;
+    }
+
+    private void waitForSpace(int size) throws InterruptedException {
+        while (bb.limit() - bb.position() < size) {
             // Block if bb is full. This should be the
             // only time this thread waits for anything
             // except for more event lines.
@@ -112,16 +167,6 @@ class LinuxEventBuffer {
             }
             wait();
         }
-        if (isSync) {
-            positionOfLastSync = bb.position();
-        }
-        bb.put(event);
-        if (MonocleSettings.settings.traceEventsVerbose) {
-            int index = bb.position() - eventStruct.getSize();
-            MonocleTrace.traceEvent("Read %s [index=%d]",
-                                    getEventDescription(index), index);
-        }
-        return isSync;
     }
 
     synchronized void startIteration() {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -30,6 +30,7 @@ import com.sun.glass.ui.Application;
 import java.io.File;
 import java.io.IOException;
 import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
 import java.nio.channels.ReadableByteChannel;
 import java.util.BitSet;
 import java.util.Map;
@@ -38,7 +39,9 @@ import java.util.Map;
  * A LinuxInputDevice listens for events on a Linux
  * input device node, typically one of the files in /dev/input. When events are
  * waiting to be processed on the device it notifies its listener on a thread
- * provided by its runnable processor object.
+ * provided by its runnable processor object. Devices opened on a device
+ * node are read by the shared LinuxInputReader when it is available, rather
+ * than on a thread of their own.
  * <p>
  * Event lines are accumulated in a buffer until an event "EV_SYN EV_SYN_REPORT
  * 0" is received. At this point the listener is notified. The listener can then
@@ -62,6 +65,12 @@ class LinuxInputDevice implements Runnable, InputDevice {
     private RunnableProcessor runnableProcessor;
     private EventProcessor processor = new EventProcessor();
     private final LinuxEventBuffer buffer;
+    /**
+     * Frames from the LinuxInputReader that did not fit in the event buffer,
+     * in the layout of the reader's batches. They are moved to the event
+     * buffer on the application thread once it has made space.
+     */
+    private ByteBuffer pending;
     private Map<String,String> uevent;
     private static LinuxSystem system = LinuxSystem.getLinuxSystem();
 
@@ -140,6 +149,93 @@ class LinuxInputDevice implements Runnable, InputDevice {
         }
     }
 
+    long getFileDescriptor() {
+        return fd;
+    }
+
+    /**
+     * Adds events read by the LinuxInputReader to the event buffer. Called
+     * on the reader thread, which is shared by all devices, so it never
+     * waits for the application thread. Frames that do not fit in the event
+     * buffer are kept until the application thread has made space, and
+     * frames that do not fit there either are dropped.
+     *
+     * @param events the buffer positioned at the first event, which is
+     * advanced past the last one
+     * @param count the number of events, each a short type, short code and
+     * int value, in complete frames
+     */
+    void putEvents(ByteBuffer events, int count) {
+        int end = events.position() + count * 8;
+        synchronized (buffer) {
+            while (events.position() < end) {
+                int frame = getFrameLength(events, end);
+                if ((pending == null || pending.position() == 0)
+                        && buffer.offerFrame(events, frame)) {
+                    if (!processor.scheduled) {
+                        runnableProcessor.invokeLater(processor);
+                        processor.scheduled = true;
+                    }
+                    continue;
+                }
+                if (pending == null) {
+                    pending = ByteBuffer.allocate(LinuxEventBuffer.EVENT_BUFFER_SIZE * 8);
+                    pending.order(ByteOrder.nativeOrder());
+                }
+                if (pending.remaining() >= frame * 8) {
+                    pending.put(events.slice(events.position(), frame * 8));
+                } else if (MonocleSettings.settings.traceEvents) {
+                    MonocleTrace.traceEvent("Dropped a frame of %d events on %s", frame, this);
+                }
+                events.position(events.position() + frame * 8);
+            }
+        }
+    }
+
+    /**
+     * Returns the number of events up to and including the next "EV_SYN
+     * SYN_REPORT 0", or up to the end if there is none.
+     */
+    private static int getFrameLength(ByteBuffer events, int end) {
+        int start = events.position();
+        for (int i = start; i < end; i += 8) {
+            if (events.getShort(i) == LinuxInput.EV_SYN && events.getInt(i + 4) == 0) {
+                return (i + 8 - start) / 8;
+            }
+        }
+        return (end - start) / 8;
+    }
+
+    /**
+     * Moves the frames kept by putEvents to the event buffer, as far as they
+     * fit. Called with the event buffer locked.
+     *
+     * @return true if a frame was added
+     */
+    private boolean putPendingFrames() {
+        if (pending == null || pending.position() == 0) {
+            return false;
+        }
+        boolean added = false;
+        pending.flip();
+        while (pending.hasRemaining()
+                && buffer.offerFrame(pending, getFrameLength(pending, pending.limit()))) {
+            added = true;
+        }
+        pending.compact();
+        return added;
+    }
+
+    /**
+     * Closes the device node after the device is disconnected.
+     */
+    void close() {
+        if (fd != -1) {
+            system.close(fd);
+            fd = -1;
+        }
+    }
+
     @Override
     public void run() {
         if (inputProcessor == null) {
@@ -191,6 +287,10 @@ class LinuxInputDevice implements Runnable, InputDevice {
                     processor.scheduled = false;
                 }
                 buffer.compact();
+                if (putPendingFrames() && !processor.scheduled) {
+                    runnableProcessor.invokeLater(processor);
+                    processor.scheduled = true;
+                }
             }
         }
     }
@@ -205,7 +305,8 @@ class LinuxInputDevice implements Runnable, InputDevice {
      */
     boolean isQuiet() {
         synchronized (buffer) {
-            return !processor.scheduled && !buffer.hasData();
+            return !processor.scheduled && !buffer.hasData()
+                    && (pending == null || pending.position() == 0);
         }
     }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -92,10 +92,14 @@ class LinuxInputDeviceRegistry extends InputDeviceRegistry {
             return null;
         } else {
             device.setInputProcessor(processor);
-            Thread thread = new Thread(device);
-            thread.setName(name);
-            thread.setDaemon(true);
-            thread.start();
+            LinuxInputReader reader = device.getFileDescriptor() != -1
+                    ? LinuxInputReader.getInstance() : null;
+            if (reader == null || !reader.addDevice(device)) {
+                Thread thread = new Thread(device);
+                thread.setName(name);
+                thread.setDaemon(true);
+                thread.start();
+            }
             devices.add(device);
             return device;
         }
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.glass.ui.monocle;
+
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.util.Map;
+import java.util.concurrent.ConcurrentHashMap;
+
+/**
+ * Reads all Linux input devices on a single thread. The native reader waits
+ * on the device nodes with epoll, splits their events into frames at
+ * "EV_SYN SYN_REPORT 0", drops frames lost to a kernel buffer overflow and
+ * merges repeated axis events within a frame. Complete frames from all
+ * devices are delivered in batches through a direct buffer, and are then
+ * added to the event buffer of each LinuxInputDevice for its input
+ * processor.
+ * <p>
+ * Devices use a thread each, reading one event at a time, when the native
+ * reader is not available or is turned off with
+ * {@code -Dmonocle.input.nativeReader=false}. Simulated devices always do.
+ */
+final class LinuxInputReader implements Runnable {
+
+    /** The size of a batch of frames, enough for several full event buffers */
+    private static final int BATCH_SIZE = 64 * 1024;
+
+    private static LinuxInputReader instance;
+    private static boolean initialized;
+
+    private final long handle;
+    private final ByteBuffer batch;
+    private final Map<Integer, LinuxInputDevice> devices = new ConcurrentHashMap<>();
+    private int nextId;
+
+    private LinuxInputReader(long handle) {
+        this.handle = handle;
+        batch = ByteBuffer.allocateDirect(BATCH_SIZE);
+        batch.order(ByteOrder.nativeOrder());
+    }
+
+    /**
+     * Returns the reader, starting its thread on the first call, or
+     * {@code null} if input devices must be read on their own threads.
+     */
+    static synchronized LinuxInputReader getInstance() {
+        if (!initialized) {
+            initialized = true;
+            if (MonocleSettings.settings.nativeInputReader) {
+                try {
+                    long handle = _open();
+                    if (handle != 0l) {
+                        instance = new LinuxInputReader(handle);
+                        Thread thread = new Thread(instance);
+                        thread.setName("Linux input reader");
+                        thread.setDaemon(true);
+                        thread.start();
+                    }
+                } catch (UnsatisfiedLinkError e) {
+                    instance = null;
+                }
+            }
+        }
+        return instance;
+    }
+
+    /**
+     * Starts reading events from the device.
+     *
+     * @param device a device opened on a device node, with its input
+     * processor set
+     * @return true if the device was added, false if it must be read on its
+     * own thread
+     */
+    synchronized boolean addDevice(LinuxInputDevice device) {
+        int id = ++nextId;
+        devices.put(id, device);
+        if (!_addDevice(handle, device.getFileDescriptor(), id)) {
+            devices.remove(id);
+            return false;
+        }
+        return true;
+    }
+
+    @Override
+    public void run() {
+        while (true) {
+            int bytes = _read(handle, batch);
+            if (bytes < 0) {
+                System.err.println("Error reading Linux input devices");
+                return;
+            }
+            batch.clear();
+            batch.limit(bytes);
+            while (batch.hasRemaining()) {
+                int id = batch.getInt();
+                int count = batch.getInt();
+                LinuxInputDevice device = devices.get(id);
+                if (count < 0) {
+                    // the device is disconnected
+                    devices.remove(id);
+                    if (device != null) {
+                        device.close();
+                    }
+                } else if (device != null) {
+                    device.putEvents(batch, count);
+                } else {
+                    batch.position(batch.position() + count * 8);
+                }
+            }
+        }
+    }
+
+    static native long _open();
+
+    static native boolean _addDevice(long handle, long fd, int id);
+
+    /**
+     * Waits for input on any device and writes the frames read to the
+     * buffer. Returns the number of bytes written, or -1 on error.
+     */
+    static native int _read(long handle, ByteBuffer buffer);
+}
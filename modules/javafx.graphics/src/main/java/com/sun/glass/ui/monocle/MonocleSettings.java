@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2014, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2014, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -32,11 +32,17 @@ class MonocleSettings {
     final boolean traceEvents;
     final boolean traceEventsVerbose;
     final boolean tracePlatformConfig;
+    final boolean nativeComposition;
+    final boolean dither;
+    final boolean nativeInputReader;
 
     private MonocleSettings() {
         traceEventsVerbose = Boolean.getBoolean("monocle.input.traceEvents.verbose");
         traceEvents = traceEventsVerbose || Boolean.getBoolean("monocle.input.traceEvents");
         tracePlatformConfig = Boolean.getBoolean("monocle.platform.traceConfig");
+        nativeComposition = !"false".equals(System.getProperty("monocle.nativeComposition"));
+        dither = Boolean.getBoolean("monocle.dither");
+        nativeInputReader = !"false".equals(System.getProperty("monocle.input.nativeReader"));
     }
 
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -40,6 +40,7 @@ public class FontConfigManager {
     static boolean useFontConfig = true;
     static boolean fontConfigFailed = false;
     static boolean useEmbeddedFontSupport = false;
+    static boolean useFontConfigCache = true;
 
     static {
         String dbg = System.getProperty("prism.debugfonts", "");
@@ -48,6 +49,8 @@ public class FontConfigManager {
         useFontConfig = "true".equals(ufc);
         String emb = System.getProperty("prism.embeddedfonts", "");
         useEmbeddedFontSupport = "true".equals(emb);
+        String fcc = System.getProperty("prism.fontConfigCache", "true");
+        useFontConfigCache = "true".equals(fcc);
     }
 
     /* These next three classes are just data structures.
@@ -220,7 +223,31 @@ public class FontConfigManager {
         (HashMap<String,String> fontToFileMap,
          HashMap<String,String> fontToFamilyNameMap,
          HashMap<String,ArrayList<String>> familyToFontListMap,
-         Locale locale);
+         Locale locale,
+         String cacheFile);
+
+    /*
+     * The native code keeps the fonts it found in a cache file, which saves
+     * listing all fonts with fontconfig on every start. The native code
+     * checks that the cache still matches the fontconfig setup before using it.
+     */
+    private static String getFontConfigCacheFile() {
+        if (!useFontConfigCache) {
+            return null;
+        }
+        String home = System.getProperty("user.home");
+        if (home == null) {
+            return null;
+        }
+        File dir = new File(home, ".openjfx/cache/fontconfig");
+        if (!dir.isDirectory() && !dir.mkdirs()) {
+            if (debugFonts) {
+                System.err.println("Cannot create font cache directory " + dir);
+            }
+            return null;
+        }
+        return new File(dir, "fonts.cache").getPath();
+    }
 
     public static void populateMaps
         (HashMap<String,String> fontToFileMap,
@@ -230,9 +257,17 @@ public class FontConfigManager {
 
         boolean pnm = false;
         if (useFontConfig && !fontConfigFailed) {
+            long start = debugFonts ? System.nanoTime() : 0L;
+            String cacheFile = getFontConfigCacheFile();
             pnm = populateMapsNative(fontToFileMap, fontToFamilyNameMap,
-                                familyToFontListMap, locale);
-
+                                familyToFontListMap, locale, cacheFile);
+            if (debugFonts) {
+                long end = System.nanoTime();
+                System.err.println("populateMapsNative took " +
+                                   ((end - start) / 1000000.0) + " ms, " +
+                                   fontToFileMap.size() + " fonts, cache=" +
+                                   cacheFile);
+            }
         }
 
         if (fontConfigFailed ||
@@ -25,6 +25,8 @@
 
 package com.sun.javafx.font.freetype;
 
+import java.nio.ByteBuffer;
+
 import com.sun.javafx.font.Disposer;
 import com.sun.javafx.font.FontResource;
 import com.sun.javafx.font.FontStrikeDesc;
@@ -51,6 +53,9 @@ class FTFontFile extends PrismFontFile {
     private long library;
     private long face;
     private FTDisposer disposer;
+    /* Scratch buffer the glyph bitmaps are rendered into, grown on demand */
+    private ByteBuffer glyphBuffer;
+    private static final int GLYPH_BUFFER_SIZE = 4096;
 
     FTFontFile(String name, String filename, int fIndex, boolean register,
                boolean embedded, boolean copy) throws Exception {
@@ -125,16 +130,13 @@ class FTFontFile extends PrismFontFile {
             return;
         }
         int size26dot6 = (int)(size * 64);
-        OSFreetype.FT_Set_Char_Size(face, 0, size26dot6, 72, 72);
 
         boolean lcd = strike.getAAMode() == FontResource.AA_LCD &&
                       FTFactory.LCD_SUPPORT;
 
         int flags = OSFreetype.FT_LOAD_RENDER | OSFreetype.FT_LOAD_NO_HINTING | OSFreetype.FT_LOAD_NO_BITMAP;
         FT_Matrix matrix = strike.matrix;
-        if (matrix != null) {
-            OSFreetype.FT_Set_Transform(face, matrix, 0, 0);
-        } else {
+        if (matrix == null) {
             flags |= OSFreetype.FT_LOAD_IGNORE_TRANSFORM;
         }
         if (lcd) {
@@ -144,7 +146,24 @@ class FTFontFile extends PrismFontFile {
         }
 
         int glyphCode = glyph.getGlyphCode();
-        int error = OSFreetype.FT_Load_Glyph(face, glyphCode, flags);
+        int[] glyphCodes = {glyphCode};
+        int[] metrics = new int[OSFreetype.GLYPH_METRICS_SIZE];
+        if (glyphBuffer == null) {
+            glyphBuffer = ByteBuffer.allocateDirect(GLYPH_BUFFER_SIZE);
+        }
+        int count = OSFreetype.renderGlyphs(face, size26dot6, matrix, flags,
+                                            glyphCodes, 1, glyphBuffer, metrics);
+        if (count == 0) {
+            /* The bitmap did not fit, grow the buffer and try again */
+            int needed = metrics[OSFreetype.GLYPH_WIDTH] * metrics[OSFreetype.GLYPH_ROWS];
+            if (needed <= glyphBuffer.capacity()) return;
+            glyphBuffer = ByteBuffer.allocateDirect(Math.max(needed, glyphBuffer.capacity() * 2));
+            count = OSFreetype.renderGlyphs(face, size26dot6, matrix, flags,
+                                            glyphCodes, 1, glyphBuffer, metrics);
+            if (count == 0) return;
+        }
+
+        int error = metrics[OSFreetype.GLYPH_ERROR];
         if (error != 0) {
             if (PrismFontFactory.debugFonts) {
                 System.err.println("FT_Load_Glyph failed " + error +
@@ -154,14 +173,9 @@ class FTFontFile extends PrismFontFile {
             return;
         }
 
-        FT_GlyphSlotRec glyphRec = OSFreetype.getGlyphSlot(face);
-        if (glyphRec == null) return;
-        FT_Bitmap bitmap = glyphRec.bitmap;
-        if (bitmap == null) return;
-        int pixelMode = bitmap.pixel_mode;
-        int width = bitmap.width;
-        int height = bitmap.rows;
-        int pitch = bitmap.pitch;
+        int pixelMode = metrics[OSFreetype.GLYPH_PIXEL_MODE];
+        int width = metrics[OSFreetype.GLYPH_WIDTH];
+        int height = metrics[OSFreetype.GLYPH_ROWS];
         if (pixelMode != OSFreetype.FT_PIXEL_MODE_GRAY && pixelMode != OSFreetype.FT_PIXEL_MODE_LCD) {
             /* This procedure only requests FT_RENDER_MODE_NORMAL and FT_RENDER_MODE_LCD,
              * and for its output is expects FT_PIXEL_MODE_GRAY and FT_PIXEL_MODE_LCD, respectively.
@@ -176,34 +190,24 @@ class FTFontFile extends PrismFontFile {
             }
             return;
         }
-        byte[] buffer;
-        if (width != 0 && height != 0) {
-            buffer = OSFreetype.getBitmapData(face);
-            if (buffer != null && pitch != width) {
-                /* Common for LCD glyphs */
-                byte[] newBuffer = new byte[width * height];
-                int src = 0, dst = 0;
-                for (int y = 0; y < height; y++) {
-                    for (int x = 0; x < width; x++) {
-                        newBuffer[dst + x] = buffer[src + x];
-                    }
-                    dst += width;
-                    src += pitch;
-                }
-                buffer = newBuffer;
-            }
-        } else {
-            /* white space */
-            buffer = new byte[0];
+        /* The bitmap is stored without row padding, pitch is always width */
+        byte[] buffer = new byte[width * height];
+        if (buffer.length != 0) {
+            glyphBuffer.get(metrics[OSFreetype.GLYPH_OFFSET], buffer);
         }
+        FT_Bitmap bitmap = new FT_Bitmap();
+        bitmap.pixel_mode = (byte)pixelMode;
+        bitmap.width = width;
+        bitmap.rows = height;
+        bitmap.pitch = width;
 
         glyph.buffer = buffer;
         glyph.bitmap = bitmap;
-        glyph.bitmap_left = glyphRec.bitmap_left;
-        glyph.bitmap_top = glyphRec.bitmap_top;
-        glyph.advanceX = glyphRec.advance_x / 64f;    /* Fixed 26.6*/
-        glyph.advanceY = glyphRec.advance_y / 64f;
-        glyph.userAdvance = glyphRec.linearHoriAdvance / 65536.0f; /* Fixed 16.16 */
+        glyph.bitmap_left = metrics[OSFreetype.GLYPH_LEFT];
+        glyph.bitmap_top = metrics[OSFreetype.GLYPH_TOP];
+        glyph.advanceX = metrics[OSFreetype.GLYPH_ADVANCE_X] / 64f;    /* Fixed 26.6*/
+        glyph.advanceY = metrics[OSFreetype.GLYPH_ADVANCE_Y] / 64f;
+        glyph.userAdvance = metrics[OSFreetype.GLYPH_LINEAR_ADVANCE] / 65536.0f; /* Fixed 16.16 */
         glyph.lcd = lcd;
     }
 }
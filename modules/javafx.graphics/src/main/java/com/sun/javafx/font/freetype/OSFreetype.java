@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,6 +25,8 @@
 
 package com.sun.javafx.font.freetype;
 
+import java.nio.ByteBuffer;
+
 import com.sun.glass.utils.NativeLibLoader;
 import com.sun.javafx.geom.Path2D;
 
@@ -88,6 +90,19 @@ class OSFreetype {
     static final int FT_LCD_FILTER_LIGHT   = 2;
     static final int FT_LCD_FILTER_LEGACY  = 16;
 
+    /* Packed per glyph metrics stored by renderGlyphs() */
+    static final int GLYPH_ERROR          = 0;
+    static final int GLYPH_PIXEL_MODE     = 1;
+    static final int GLYPH_WIDTH          = 2;
+    static final int GLYPH_ROWS           = 3;
+    static final int GLYPH_LEFT           = 4;
+    static final int GLYPH_TOP            = 5;
+    static final int GLYPH_ADVANCE_X      = 6; /* Fixed 26.6 */
+    static final int GLYPH_ADVANCE_Y      = 7; /* Fixed 26.6 */
+    static final int GLYPH_LINEAR_ADVANCE = 8; /* Fixed 16.16 */
+    static final int GLYPH_OFFSET         = 9; /* Byte offset of the bitmap in the atlas */
+    static final int GLYPH_METRICS_SIZE   = 10;
+
     static final int FT_LOAD_TARGET_MODE(int x) {
         return (x >> 16 ) & 15;
     }
@@ -104,7 +119,8 @@ class OSFreetype {
     static final native int FT_Load_Glyph(long face, int glyph_index, int load_flags);
     static final native void FT_Set_Transform(long face, FT_Matrix matrix, long delta_x, long delta_y);
     static final native FT_GlyphSlotRec getGlyphSlot(long face);
-    static final native byte[] getBitmapData(long face);
+    static final native int renderGlyphs(long face, long size, FT_Matrix matrix, int load_flags,
+                                         int[] glyphCodes, int count, ByteBuffer atlas, int[] metrics);
     static final native boolean isPangoEnabled();
     static final native boolean isHarfbuzzEnabled();
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -77,6 +77,8 @@ public class JPEGImageLoader extends ImageLoaderImpl {
     private int outWidth;
     /** Set by setOutputAttributes native code callback. */
     private int outHeight;
+    /** Set by setOutputAttributes native code callback. */
+    private int outScaleNum = 8;
     private ImageType outImageType;
 
     private boolean isDisposed = false;
@@ -88,6 +90,17 @@ public class JPEGImageLoader extends ImageLoaderImpl {
 
     private static native void disposeNative(long structPointer);
 
+    /**
+     * Selects the SSE2 or the C versions of the libjpeg decoding methods
+     * that have both, for images decoded from now on. Both give identical
+     * results. The SSE2 versions are used by default where the native
+     * library was built with them.
+     *
+     * @param enabled whether to use the SSE2 versions
+     * @return whether the SSE2 versions are in use
+     */
+    static native boolean setSSE2Enabled(boolean enabled);
+
     /** Sets up per-reader C structure and returns a pointer to it. */
     private native long initDecompressor(InputStream stream) throws IOException;
 
@@ -98,7 +111,7 @@ public class JPEGImageLoader extends ImageLoaderImpl {
     private native int startDecompression(long structPointer,
             int outColorSpaceCode, int scaleNum, int scaleDenom);
 
-    private native boolean decompressIndirect(long structPointer, boolean reportProgress, byte[] array) throws IOException;
+    private native boolean decompressIndirect(long structPointer, int progressUpdates, byte[] array) throws IOException;
 
     static {
         NativeLibLoader.loadLibrary("javafx_iio");
@@ -162,9 +175,34 @@ public class JPEGImageLoader extends ImageLoaderImpl {
     /*
      * Called by the native code after starting decompression.
      */
-    private void setOutputAttributes(int width, int height) {
+    private void setOutputAttributes(int width, int height, int scaleNum) {
         this.outWidth = width;
         this.outHeight = height;
+        this.outScaleNum = scaleNum;
+    }
+
+    /**
+     * Returns N for the N/8 scale at which the inverse DCT decoded the
+     * image, 8 if it was decoded at full size.
+     */
+    public int getDCTScale() {
+        return outScaleNum;
+    }
+
+    /**
+     * Returns the width of the image as decoded, before it is resampled
+     * to the requested size.
+     */
+    public int getDecodedWidth() {
+        return outWidth;
+    }
+
+    /**
+     * Returns the height of the image as decoded, before it is resampled
+     * to the requested size.
+     */
+    public int getDecodedHeight() {
+        return outHeight;
     }
 
     private void updateImageProgress(int outLinesDecoded) {
@@ -210,18 +248,15 @@ public class JPEGImageLoader extends ImageLoaderImpl {
         accessLock.lock();
 
         // Determine output image dimensions.
+        int maxWidth = (int)(w * imagePixelScale);
+        int maxHeight = (int)(h * imagePixelScale);
         int[] widthHeight = ImageTools.computeDimensions(
-            inWidth, inHeight, (int)(w * imagePixelScale), (int)(h * imagePixelScale), preserveAspectRatio);
+            inWidth, inHeight, maxWidth, maxHeight, preserveAspectRatio);
         int width = widthHeight[0];
         int height = widthHeight[1];
 
-        ImageMetadata md = new ImageMetadata(null, true,
-                null, null, null, null, null,
-                width, height, null, null, null);
-
-        updateImageMetadata(md);
-
         ByteBuffer buffer = null;
+        ImageMetadata md;
 
         int outNumComponents;
         try {
@@ -231,6 +266,28 @@ public class JPEGImageLoader extends ImageLoaderImpl {
             if (outWidth < 0 || outHeight < 0 || outNumComponents < 0) {
                throw new IOException("negative dimension.");
             }
+
+            // libjpeg rounds the scaled size up, where computeDimensions
+            // rounds to nearest. With the aspect ratio preserved, a decoded
+            // image that matches the requested side exactly and is at most
+            // one pixel off on the derived side still fits the request, so
+            // it is kept as is instead of being resampled by one pixel.
+            if (preserveAspectRatio && outScaleNum < 8) {
+                if (outWidth == width && Math.abs(outHeight - height) <= 1 &&
+                        (maxHeight <= 0 || outHeight <= maxHeight)) {
+                    height = outHeight;
+                } else if (outHeight == height && Math.abs(outWidth - width) <= 1 &&
+                        (maxWidth <= 0 || outWidth <= maxWidth)) {
+                    width = outWidth;
+                }
+            }
+
+            md = new ImageMetadata(null, true,
+                    null, null, null, null, null,
+                    width, height, null, null, null);
+
+            updateImageMetadata(md);
+
             if (outWidth > (Integer.MAX_VALUE / outNumComponents)) {
                throw new IOException("bad width.");
             }
@@ -241,7 +298,10 @@ public class JPEGImageLoader extends ImageLoaderImpl {
 
             byte[] array = new byte[scanlineStride*outHeight];
             buffer = ByteBuffer.wrap(array);
-            decompressIndirect(structPointer, listeners != null && !listeners.isEmpty(), buffer.array());
+            // one progress update per ImageTools.PROGRESS_INTERVAL percent
+            int progressUpdates = (listeners != null && !listeners.isEmpty())
+                    ? 100 / ImageTools.PROGRESS_INTERVAL : 0;
+            decompressIndirect(structPointer, progressUpdates, buffer.array());
         } catch (IOException e) {
             throw e;
         } catch (Throwable t) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -211,7 +211,7 @@ public final class QuantumToolkit extends Toolkit {
     private int                     inPulse = 0;
     private CountDownLatch          launchLatch = new CountDownLatch(1);
 
-    final int                       PULSE_INTERVAL = (int)(TimeUnit.SECONDS.toMillis(1L) / getRefreshRate());
+    final long                      PULSE_PERIOD_NANOS = TimeUnit.SECONDS.toNanos(1L) / getRefreshRate();
     final int                       FULLSPEED_INTERVAL = 1;     // ms
     boolean                         nativeSystemVsync = false;
     private long                    firstPauseRequestTime = 0;
@@ -398,7 +398,7 @@ public final class QuantumToolkit extends Toolkit {
                     // rely on millisecond resolution timer to provide
                     // nominal pulse sync and use pulse hinting on
                     // synchronous pipelines to fine tune the interval
-                    pulseTimer.start(PULSE_INTERVAL);
+                    pulseTimer.startNanos(PULSE_PERIOD_NANOS);
                 }
             }
         } catch (Throwable th) {
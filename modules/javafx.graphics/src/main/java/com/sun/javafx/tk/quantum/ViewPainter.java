@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -99,6 +99,9 @@ abstract class ViewPainter implements Runnable {
     // and if dirty opts are turned off via a runtime flag, then these fields
     // are never initialized or used.
     private Rectangle dirtyRect;
+    // Bounds of the back buffer pixels painted by the last paintImpl, in
+    // device pixels, or null if the whole back buffer was painted
+    protected Rectangle paintedRegion;
     private RectBounds clip;
     private RectBounds dirtyRegionTemp;
     private DirtyRegionPool dirtyRegionPool;
@@ -165,6 +168,7 @@ abstract class ViewPainter implements Runnable {
     protected void paintImpl(final Graphics backBufferGraphics) {
         // We should not be painting anything with a width / height
         // that is <= 0, so we might as well bail right off.
+        paintedRegion = null;
         if (width <= 0 || height <= 0 || backBufferGraphics == null) {
             root.renderForcedContent(backBufferGraphics);
             return;
@@ -320,6 +324,11 @@ abstract class ViewPainter implements Runnable {
                     g.setClipRectIndex(i);
                     doPaint(g, getRootPath(i));
                     getRootPath(i).clear();
+                    if (paintedRegion == null) {
+                        paintedRegion = new Rectangle(dirtyRect);
+                    } else {
+                        paintedRegion.add(dirtyRect);
+                    }
                 }
             }
         } else {
@@ -341,6 +350,7 @@ abstract class ViewPainter implements Runnable {
         // we will first blit the sceneBuffer into the back buffer, and then draw directly
         // on the back buffer.
         if (showDirtyOpts) {
+            paintedRegion = null;
             if (sceneBuffer != null) {
                 g.sync();
                 backBufferGraphics.clear();
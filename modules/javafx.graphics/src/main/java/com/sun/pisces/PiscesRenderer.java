@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2020, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -93,6 +93,36 @@ public final class PiscesRenderer {
 
     private native void initialize();
 
+    /**
+     * Enables parallel rendering of large fills on {@code count} native threads,
+     * the calling thread included. Values below 2 leave rendering single threaded.
+     * The number of threads can only grow.
+     *
+     * @param count number of threads
+     */
+    public static void setWorkerThreads(int count) {
+        if (count > 1) {
+            setWorkerThreadsImpl(count);
+        }
+    }
+
+    private static native void setWorkerThreadsImpl(int count);
+
+    /**
+     * Selects the SSE2 or NEON versions of the SrcOver blits and of the
+     * bilinear texture paint, where the native library was built with them,
+     * or the scalar ones. Both give identical results. The vector versions
+     * are used by default.
+     *
+     * @param enabled whether to use the vector versions
+     * @return whether the vector versions are in use
+     */
+    public static boolean setSIMDEnabled(boolean enabled) {
+        return setSIMDEnabledImpl(enabled);
+    }
+
+    private static native boolean setSIMDEnabledImpl(boolean enabled);
+
     /**
      * Sets the current paint color.
      *
@@ -361,6 +391,30 @@ public final class PiscesRenderer {
     private native void emitAndClearAlphaRowImpl(byte[] alphaMap, int[] alphaDeltas, int pix_y, int pix_x_from, int pix_x_to,
         int pix_x_off, int rowNum);
 
+    /**
+     * Emits a band of rows collected by the caller with one native call.
+     * Deltas of row {@code i} start at {@code i * deltaStride} in {@code alphaDeltas},
+     * the row itself is described by {@code (pix_y, pix_x_from, pix_x_to)} stored at
+     * {@code rows[3 * i]}. Rows are numbered starting from {@code rowNum}.
+     */
+    public void emitAndClearAlphaRows(byte[] alphaMap, int[] alphaDeltas, int deltaStride,
+        int[] rows, int rowCount, int rowNum)
+    {
+        if (rowCount < 0 || deltaStride < 0 || rowCount * 3 > rows.length
+                || (long) rowCount * deltaStride > alphaDeltas.length) {
+            throw new IllegalArgumentException("rendering range exceeds length of data");
+        }
+        for (int i = 0; i < rowCount; i++) {
+            if ((rows[3 * i + 2] - rows[3 * i + 1]) >= deltaStride) {
+                throw new IllegalArgumentException("rendering range exceeds length of data");
+            }
+        }
+        this.emitAndClearAlphaRowsImpl(alphaMap, alphaDeltas, deltaStride, rows, rowCount, rowNum);
+    }
+
+    private native void emitAndClearAlphaRowsImpl(byte[] alphaMap, int[] alphaDeltas, int deltaStride,
+        int[] rows, int rowCount, int rowNum);
+
     public void fillAlphaMask(byte[] mask, int x, int y, int width, int height, int offset, int stride) {
         if (mask == null) {
             throw new NullPointerException("Mask is NULL");
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -84,6 +84,8 @@ public final class PrismSettings {
     public static final boolean forceUploadingPainter;
     public static final boolean forceAlphaTestShader;
     public static final boolean forceNonAntialiasedShape;
+    public static final int swRenderThreads;
+    public static final boolean swSIMD;
 
     public static enum RasterizerType {
         DoubleMarlin("Double Precision Marlin Rasterizer");
@@ -270,6 +272,12 @@ public final class PrismSettings {
                           "Try -Dprism.maxvram=<long>[kKmMgG]");
         targetVram = getLong(systemProperties, "prism.targetvram", maxVram / 8, maxVram,
                              "Try -Dprism.targetvram=<long>[kKmMgG]|<double(0,100)>%");
+        /* Number of threads the SW pipeline renders large fills with */
+        swRenderThreads = Utils.clamp(1, getInt(systemProperties, "prism.swthreads", 1,
+                                                "Try -Dprism.swthreads=<number>"), 16);
+        /* Whether the SW pipeline uses its SSE2 or NEON blits where available */
+        swSIMD = getBoolean(systemProperties, "prism.swsimd", true);
+
         poolStats = getBoolean(systemProperties, "prism.poolstats", false);
         poolDebug = getBoolean(systemProperties, "prism.pooldebug", false);
 
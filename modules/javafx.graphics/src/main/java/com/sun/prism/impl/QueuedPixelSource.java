@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2014, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2014, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -64,6 +64,7 @@ public class QueuedPixelSource implements PixelSource {
     private final List<WeakReference<Pixels>> saved =
          new ArrayList<>(3);
     private final boolean useDirectBuffers;
+    private boolean skipped;
 
     public QueuedPixelSource(boolean useDirectBuffers) {
         this.useDirectBuffers = useDirectBuffers;
@@ -95,6 +96,7 @@ public class QueuedPixelSource implements PixelSource {
             throw new IllegalStateException("cannot skip while processing: "+beingConsumed);
         }
         enqueued = null;
+        skipped = true;
     }
 
     private boolean usesSameBuffer(Pixels p1, Pixels p2) {
@@ -136,6 +138,7 @@ public class QueuedPixelSource implements PixelSource {
                 p.getScaleXUnsafe() == scalex &&
                 p.getScaleYUnsafe() == scaley)
             {
+                p.resetDirtyRegion();
                 return p;
             }
             // Whether or not we reuse its buffer, this Pixels object is going away.
@@ -166,10 +169,19 @@ public class QueuedPixelSource implements PixelSource {
      * Place the indicated {@code Pixels} object into the enqueued state,
      * replacing any other objects that are currently enqueued but not yet
      * being used by the consumer.
+     * The dirty region of a replaced object is merged into the new one, and
+     * the whole image is marked dirty if the previous pixels were skipped,
+     * so that no change is lost when only the dirty region is presented.
      *
      * @param pixels the {@code Pixels} object to be enqueued
      */
     public synchronized void enqueuePixels(Pixels pixels) {
+        if (skipped) {
+            pixels.resetDirtyRegion();
+            skipped = false;
+        } else if (enqueued != null && enqueued != pixels) {
+            pixels.unionDirtyRegion(enqueued);
+        }
         enqueued = pixels;
     }
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -43,6 +43,7 @@ import com.sun.prism.Texture;
 import com.sun.prism.impl.PrismSettings;
 import com.sun.prism.impl.shape.DMarlinPrismUtils;
 import java.lang.ref.SoftReference;
+import java.util.Arrays;
 
 final class SWContext {
 
@@ -66,6 +67,13 @@ final class SWContext {
 
         private PiscesRenderer pr;
 
+        // rows are collected into a band and emitted with a single native call
+        private static final int BAND_HEIGHT = 16;
+        private int bandDeltas[];
+        private int bandRows[] = new int[3 * BAND_HEIGHT];
+        private int bandStride;
+        private int bandCount;
+
         public void initConsumer(int x, int y, int w, int h, PiscesRenderer pr) {
             this.x = x;
             this.y = y;
@@ -73,6 +81,19 @@ final class SWContext {
             this.h = h;
             rowNum = 0;
             this.pr = pr;
+            bandStride = w + 1;
+            bandCount = 0;
+            if (bandDeltas == null || bandDeltas.length < BAND_HEIGHT * bandStride) {
+                bandDeltas = new int[BAND_HEIGHT * bandStride];
+            }
+        }
+
+        public void flush() {
+            if (bandCount > 0) {
+                pr.emitAndClearAlphaRows(alpha_map, bandDeltas, bandStride, bandRows, bandCount,
+                        rowNum - bandCount);
+                bandCount = 0;
+            }
         }
 
         @Override
@@ -120,15 +141,30 @@ final class SWContext {
                                               final int pix_from, final int pix_to)
         {
             // pix_from indicates the first alpha coverage != 0 within [x; pix_to[
-            pr.emitAndClearAlphaRow(alpha_map, alphaDeltas, pix_y, pix_from, pix_to, (pix_from - x), rowNum);
-            rowNum++;
-
-            // clear properly the end of the alphaDeltas:
+            final int from = pix_from - x;
             final int to = pix_to - x;
-            if (to <= w) {
-                alphaDeltas[to] = 0;
+            if (to > w) {
+                flush();
+                pr.emitAndClearAlphaRow(alpha_map, alphaDeltas, pix_y, pix_from, pix_to, from, rowNum);
+                rowNum++;
+
+                // clear properly the end of the alphaDeltas:
+                alphaDeltas[w] = 0;
             } else {
-                alphaDeltas[w]  = 0;
+                // copy the row into the band and clear it including the end of the alphaDeltas
+                if (to >= from) {
+                    System.arraycopy(alphaDeltas, from, bandDeltas, bandCount * bandStride, to - from + 1);
+                    Arrays.fill(alphaDeltas, from, to + 1, 0);
+                }
+                final int r = 3 * bandCount;
+                bandRows[r] = pix_y;
+                bandRows[r + 1] = pix_from;
+                bandRows[r + 2] = pix_to;
+                bandCount++;
+                rowNum++;
+                if (bandCount == BAND_HEIGHT) {
+                    flush();
+                }
             }
 
             if (MarlinConst.DO_CHECKS) {
@@ -181,6 +217,7 @@ final class SWContext {
                 }
                 alphaConsumer.initConsumer(outpix_xmin, outpix_ymin, w, h, pr);
                 renderer.produceAlphas(alphaConsumer);
+                alphaConsumer.flush();
             } finally {
                 if (renderer != null) {
                     renderer.dispose();
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -27,6 +27,7 @@ package com.sun.prism.sw;
 
 import com.sun.glass.ui.Screen;
 import com.sun.glass.utils.NativeLibLoader;
+import com.sun.pisces.PiscesRenderer;
 import com.sun.prism.GraphicsPipeline;
 import com.sun.prism.ResourceFactory;
 import com.sun.prism.impl.PrismSettings;
@@ -40,6 +41,8 @@ public final class SWPipeline extends GraphicsPipeline {
 
     static {
         NativeLibLoader.loadLibrary("prism_sw");
+        PiscesRenderer.setWorkerThreads(PrismSettings.swRenderThreads);
+        PiscesRenderer.setSIMDEnabled(PrismSettings.swSIMD);
     }
 
     @Override public boolean init() {
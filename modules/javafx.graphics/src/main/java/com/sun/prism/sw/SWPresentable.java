@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -55,7 +55,6 @@ final class SWPresentable extends SWRTTexture implements Presentable {
             /*
              * JDK-8092310
              * TODO: make sure the imgrep matches the Pixels.getNativeFormat()
-             * TODO: dirty region support
              */
             int w = getPhysicalWidth();
             int h = getPhysicalHeight();
@@ -63,7 +62,13 @@ final class SWPresentable extends SWRTTexture implements Presentable {
             IntBuffer pixBuf = (IntBuffer) pixels.getPixels();
             IntBuffer buf = getSurface().getDataIntBuffer();
             assert buf.hasArray();
+            // The Pixels buffers are recycled, so they always receive the whole
+            // surface, but only the dirty region needs to reach the screen
             System.arraycopy(buf.array(), 0, pixBuf.array(), 0, w*h);
+            if (dirtyregion != null) {
+                pixels.setDirtyRegion(dirtyregion.x, dirtyregion.y,
+                                      dirtyregion.width, dirtyregion.height);
+            }
             return true;
         } else {
             return false;
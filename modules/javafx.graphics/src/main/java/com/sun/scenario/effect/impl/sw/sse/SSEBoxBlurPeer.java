@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2014, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -113,11 +113,11 @@ public class SSEBoxBlurPeer extends SSEEffectPeer<BoxRenderState> {
         return new ImageData(getFilterContext(), cur, dstBounds);
     }
 
-    private static native void
+    static native void
         filterHorizontal(int dstPixels[], int dstw, int dsth, int dstscan,
                          int srcPixels[], int srcw, int srch, int srcscan);
 
-    private static native void
+    static native void
         filterVertical(int dstPixels[], int dstw, int dsth, int dstscan,
                        int srcPixels[], int srcw, int srch, int srcscan);
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2014, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -141,17 +141,17 @@ public class SSEBoxShadowPeer extends SSEEffectPeer<BoxRenderState> {
         return new ImageData(getFilterContext(), cur, dstBounds, inputs[0].getTransform());
     }
 
-    private static native void
+    static native void
         filterHorizontalBlack(int dstPixels[], int dstw, int dsth, int dstscan,
                               int srcPixels[], int srcw, int srch, int srcscan,
                               float spread);
 
-    private static native void
+    static native void
         filterVerticalBlack(int dstPixels[], int dstw, int dsth, int dstscan,
                             int srcPixels[], int srcw, int srch, int srcscan,
                             float spread);
 
-    private static native void
+    static native void
         filterVertical(int dstPixels[], int dstw, int dsth, int dstscan,
                        int srcPixels[], int srcw, int srch, int srcscan,
                        float spread, float shadowColor[]);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2008, 2014, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2008, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,6 +25,10 @@
 
 package com.sun.scenario.effect.impl.sw.sse;
 
+import java.util.concurrent.ExecutionException;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.Future;
 import com.sun.scenario.effect.FilterContext;
 import com.sun.scenario.effect.impl.EffectPeer;
 import com.sun.scenario.effect.impl.Renderer;
@@ -32,7 +36,113 @@ import com.sun.scenario.effect.impl.state.RenderState;
 
 public abstract class SSEEffectPeer<T extends RenderState> extends EffectPeer<T> {
 
+    /**
+     * Number of threads the generated peers split their destination rows
+     * across, by default one per processor up to 4; 1 filters on the
+     * calling thread only.
+     */
+    private static final int numThreads =
+        Math.max(1, Math.min(Integer.getInteger("decora.sse.threads",
+            Math.min(4, Runtime.getRuntime().availableProcessors())), 16));
+
+    /**
+     * Destinations smaller than this many pixels are always filtered on
+     * the calling thread, as handing them off costs more than it saves.
+     */
+    private static final int MIN_PARALLEL_PIXELS = 256 * 256;
+
+    private static ExecutorService executor;
+
     protected SSEEffectPeer(FilterContext fctx, Renderer r, String uniqueName) {
         super(fctx, r, uniqueName);
     }
+
+    @FunctionalInterface
+    protected interface RowBandFilter {
+        /**
+         * Filters the destination rows {@code [bandy, bandy + bandh)}.
+         */
+        void filter(int bandy, int bandh);
+    }
+
+    private static synchronized ExecutorService getExecutor() {
+        if (executor == null) {
+            executor = Executors.newFixedThreadPool(numThreads - 1, r -> {
+                Thread t = new Thread(r, "Decora SSE Worker");
+                t.setDaemon(true);
+                return t;
+            });
+        }
+        return executor;
+    }
+
+    /**
+     * Runs {@code filter} over the destination rows
+     * {@code [dsty, dsty + dsth)}, split into horizontal bands that are
+     * filtered concurrently when the destination is large enough and
+     * more than one thread has been configured.  Returns once every band
+     * has been filtered.
+     */
+    protected static void filterRowBands(int dsty, int dstw, int dsth,
+                                         RowBandFilter filter)
+    {
+        if ((long) dstw * dsth < MIN_PARALLEL_PIXELS) {
+            filter.filter(dsty, dsth);
+            return;
+        }
+        filterRowBands(numThreads, dsty, dsth, filter);
+    }
+
+    /**
+     * Runs {@code filter} over the destination rows split into
+     * {@code numBands} bands, whatever the size of the destination.  The
+     * bands are all filtered on the calling thread when only one thread
+     * has been configured.
+     */
+    static void filterRowBands(int numBands, int dsty, int dsth,
+                               RowBandFilter filter)
+    {
+        numBands = Math.min(numBands, dsth);
+        if (numBands <= 1) {
+            filter.filter(dsty, dsth);
+            return;
+        }
+
+        ExecutorService exec = (numThreads > 1) ? getExecutor() : null;
+        Future<?>[] futures = new Future<?>[numBands - 1];
+        for (int i = 1; i < numBands; i++) {
+            int y0 = dsty + (int) ((long) dsth * i / numBands);
+            int y1 = dsty + (int) ((long) dsth * (i + 1) / numBands);
+            if (exec == null) {
+                filter.filter(y0, y1 - y0);
+            } else {
+                futures[i - 1] = exec.submit(() -> filter.filter(y0, y1 - y0));
+            }
+        }
+        filter.filter(dsty, (int) ((long) dsth / numBands));
+
+        boolean interrupted = false;
+        RuntimeException failure = null;
+        for (Future<?> f : futures) {
+            while (f != null) {
+                try {
+                    f.get();
+                    break;
+                } catch (InterruptedException e) {
+                    interrupted = true;
+                } catch (ExecutionException e) {
+                    if (failure == null) {
+                        failure = new RuntimeException(e.getCause());
+                    }
+                    break;
+                }
+            }
+        }
+        if (interrupted) {
+            Thread.currentThread().interrupt();
+        }
+        if (failure != null) {
+            throw failure;
+        }
+    }
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2008, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2008, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -34,6 +34,28 @@ public class SSERendererDelegate implements RendererDelegate {
 
     public static native boolean isSupported();
 
+    /**
+     * Selects the SSE2 versions of the box blur and box shadow filters,
+     * where the native library was built with them, or the scalar ones.
+     * Both give identical results. The SSE2 versions are used by default.
+     *
+     * @param enabled whether to use the SSE2 versions
+     * @return whether the SSE2 versions are in use
+     */
+    public static native boolean setSSE2Enabled(boolean enabled);
+
+    /**
+     * Selects how many adjacent pixels the generated peers shade at once:
+     * 8 where the processor has AVX2, 4 where the native library was
+     * built with SSE2, or 1 for their scalar loops only.  Requests for
+     * more lanes than are available get the widest available.  The widest
+     * available are used by default.
+     *
+     * @param lanes the requested number of lanes
+     * @return the number of lanes now in use
+     */
+    public static native int setVectorLanes(int lanes);
+
     static {
         NativeLibLoader.loadLibrary("decora_sse");
     }
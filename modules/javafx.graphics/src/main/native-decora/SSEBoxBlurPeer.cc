@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -32,27 +32,10 @@
 #include "SSEUtils.h"
 #include "com_sun_scenario_effect_impl_sw_sse_SSEBoxBlurPeer.h"
 
-JNIEXPORT void JNICALL
-Java_com_sun_scenario_effect_impl_sw_sse_SSEBoxBlurPeer_filterHorizontal
-    (JNIEnv *env, jclass klass,
-     jintArray dstPixels_arr, jint dstw, jint dsth, jint dstscan,
-     jintArray srcPixels_arr, jint srcw, jint srch, jint srcscan)
+static void
+boxBlurHorizontal(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                  jint *srcPixels, jint srcw, jint srch, jint srcscan)
 {
-    if ((checkRange(env,
-                    dstPixels_arr, dstw, dsth,
-                    srcPixels_arr, srcw, srch)) ||
-        dsth > srch) { // We should not move out of source vertical bounds
-        return;
-    }
-
-    jint *srcPixels = (jint *)env->GetPrimitiveArrayCritical(srcPixels_arr, 0);
-    if (srcPixels == NULL) return;
-    jint *dstPixels = (jint *)env->GetPrimitiveArrayCritical(dstPixels_arr, 0);
-    if (dstPixels == NULL) {
-        env->ReleasePrimitiveArrayCritical(srcPixels_arr, srcPixels, JNI_ABORT);
-        return;
-    }
-
     jint hsize = dstw - srcw + 1;
     jint kscale = 0x7fffffff / (hsize * 255);
     jint srcoff = 0;
@@ -85,6 +68,168 @@ Java_com_sun_scenario_effect_impl_sw_sse_SSEBoxBlurPeer_filterHorizontal
         srcoff += srcscan;
         dstoff += dstscan;
     }
+}
+
+static void
+boxBlurVertical(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                jint *srcPixels, jint srcw, jint srch, jint srcscan)
+{
+    jint vsize = dsth - srch + 1;
+    jint kscale = 0x7fffffff / (vsize * 255);
+    jint suma[VERTICAL_BLOCK_COLUMNS];
+    jint sumr[VERTICAL_BLOCK_COLUMNS];
+    jint sumg[VERTICAL_BLOCK_COLUMNS];
+    jint sumb[VERTICAL_BLOCK_COLUMNS];
+    for (jint x0 = 0; x0 < dstw; x0 += VERTICAL_BLOCK_COLUMNS) {
+        jint bw = dstw - x0;
+        if (bw > VERTICAL_BLOCK_COLUMNS) bw = VERTICAL_BLOCK_COLUMNS;
+        for (jint x = 0; x < bw; x++) {
+            suma[x] = sumr[x] = sumg[x] = sumb[x] = 0;
+        }
+        for (jint y = 0; y < dsth; y++) {
+            // Rows leaving and entering the window for this output row.
+            jint *oldRow = (y >= vsize)
+                ? srcPixels + (y - vsize) * srcscan + x0 : NULL;
+            jint *newRow = (y < srch)
+                ? srcPixels + y * srcscan + x0 : NULL;
+            jint *dstRow = dstPixels + y * dstscan + x0;
+            for (jint x = 0; x < bw; x++) {
+                jint rgb;
+                // Un-accumulate the data for row-vsize location into the sums.
+                rgb = (oldRow != NULL) ? oldRow[x] : 0;
+                suma[x] -= (rgb >> 24) & 0xff;
+                sumr[x] -= (rgb >> 16) & 0xff;
+                sumg[x] -= (rgb >>  8) & 0xff;
+                sumb[x] -= (rgb      ) & 0xff;
+                // Accumulate the data for this row location into the sums.
+                rgb = (newRow != NULL) ? newRow[x] : 0;
+                suma[x] += (rgb >> 24) & 0xff;
+                sumr[x] += (rgb >> 16) & 0xff;
+                sumg[x] += (rgb >>  8) & 0xff;
+                sumb[x] += (rgb      ) & 0xff;
+                dstRow[x] =
+                    (((suma[x] * kscale) >> 23) << 24) +
+                    (((sumr[x] * kscale) >> 23) << 16) +
+                    (((sumg[x] * kscale) >> 23) <<  8) +
+                    (((sumb[x] * kscale) >> 23)      );
+            }
+        }
+    }
+}
+
+#ifdef DECORA_SSE2
+
+/*
+ * The SSE2 versions keep the four sums of a pixel in one vector and step
+ * through four pixels at a time, with the same integer arithmetic as the
+ * scalar loops above.
+ */
+static void
+boxBlurHorizontalSSE2(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                      jint *srcPixels, jint srcw, jint srch, jint srcscan)
+{
+    jint hsize = dstw - srcw + 1;
+    __m128i kscale = _mm_set1_epi32(0x7fffffff / (hsize * 255));
+    jint srcoff = 0;
+    jint dstoff = 0;
+    for (jint y = 0; y < dsth; y++) {
+        jint *srcRow = srcPixels + srcoff;
+        jint *dstRow = dstPixels + dstoff;
+        __m128i sum = _mm_setzero_si128();
+        for (jint x = 0; x < dstw; x += 4) {
+            __m128i d[4];
+            pixelDeltas4(loadPixels4(srcRow, x, srcw),
+                         loadPixels4(srcRow, x - hsize, srcw), d);
+            __m128i sum0 = _mm_add_epi32(sum, d[0]);
+            __m128i sum1 = _mm_add_epi32(sum0, d[1]);
+            __m128i sum2 = _mm_add_epi32(sum1, d[2]);
+            sum = _mm_add_epi32(sum2, d[3]);
+            storePixels4(dstRow + x,
+                         packPixels4(mulShift23(sum0, kscale),
+                                     mulShift23(sum1, kscale),
+                                     mulShift23(sum2, kscale),
+                                     mulShift23(sum, kscale)),
+                         dstw - x);
+        }
+        srcoff += srcscan;
+        dstoff += dstscan;
+    }
+}
+
+static void
+boxBlurVerticalSSE2(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                    jint *srcPixels, jint srcw, jint srch, jint srcscan)
+{
+    jint vsize = dsth - srch + 1;
+    __m128i kscale = _mm_set1_epi32(0x7fffffff / (vsize * 255));
+    __m128i sums[VERTICAL_BLOCK_COLUMNS];
+    for (jint x0 = 0; x0 < dstw; x0 += VERTICAL_BLOCK_COLUMNS) {
+        jint bw = dstw - x0;
+        if (bw > VERTICAL_BLOCK_COLUMNS) bw = VERTICAL_BLOCK_COLUMNS;
+        for (jint x = 0; x < VERTICAL_BLOCK_COLUMNS; x++) {
+            sums[x] = _mm_setzero_si128();
+        }
+        for (jint y = 0; y < dsth; y++) {
+            // Rows leaving and entering the window for this output row.
+            jint *oldRow = (y >= vsize)
+                ? srcPixels + (y - vsize) * srcscan + x0 : NULL;
+            jint *newRow = (y < srch)
+                ? srcPixels + y * srcscan + x0 : NULL;
+            jint *dstRow = dstPixels + y * dstscan + x0;
+            for (jint x = 0; x < bw; x += 4) {
+                __m128i d[4];
+                __m128i *sum = sums + x;
+                pixelDeltas4((newRow != NULL)
+                             ? loadPixels4(newRow, x, bw) : _mm_setzero_si128(),
+                             (oldRow != NULL)
+                             ? loadPixels4(oldRow, x, bw) : _mm_setzero_si128(),
+                             d);
+                sum[0] = _mm_add_epi32(sum[0], d[0]);
+                sum[1] = _mm_add_epi32(sum[1], d[1]);
+                sum[2] = _mm_add_epi32(sum[2], d[2]);
+                sum[3] = _mm_add_epi32(sum[3], d[3]);
+                storePixels4(dstRow + x,
+                             packPixels4(mulShift23(sum[0], kscale),
+                                         mulShift23(sum[1], kscale),
+                                         mulShift23(sum[2], kscale),
+                                         mulShift23(sum[3], kscale)),
+                             bw - x);
+            }
+        }
+    }
+}
+
+#endif /* DECORA_SSE2 */
+
+JNIEXPORT void JNICALL
+Java_com_sun_scenario_effect_impl_sw_sse_SSEBoxBlurPeer_filterHorizontal
+    (JNIEnv *env, jclass klass,
+     jintArray dstPixels_arr, jint dstw, jint dsth, jint dstscan,
+     jintArray srcPixels_arr, jint srcw, jint srch, jint srcscan)
+{
+    if ((checkRange(env,
+                    dstPixels_arr, dstw, dsth,
+                    srcPixels_arr, srcw, srch)) ||
+        dsth > srch) { // We should not move out of source vertical bounds
+        return;
+    }
+
+    jint *srcPixels = (jint *)env->GetPrimitiveArrayCritical(srcPixels_arr, 0);
+    if (srcPixels == NULL) return;
+    jint *dstPixels = (jint *)env->GetPrimitiveArrayCritical(dstPixels_arr, 0);
+    if (dstPixels == NULL) {
+        env->ReleasePrimitiveArrayCritical(srcPixels_arr, srcPixels, JNI_ABORT);
+        return;
+    }
+
+#ifdef DECORA_SSE2
+    if (sse2Enabled) {
+        boxBlurHorizontalSSE2(dstPixels, dstw, dsth, dstscan,
+                              srcPixels, srcw, srch, srcscan);
+    } else
+#endif
+    boxBlurHorizontal(dstPixels, dstw, dsth, dstscan,
+                      srcPixels, srcw, srch, srcscan);
 
     env->ReleasePrimitiveArrayCritical(dstPixels_arr, dstPixels, 0);
     env->ReleasePrimitiveArrayCritical(srcPixels_arr, srcPixels, JNI_ABORT);
@@ -111,39 +256,14 @@ Java_com_sun_scenario_effect_impl_sw_sse_SSEBoxBlurPeer_filterVertical
         return;
     }
 
-    jint vsize = dsth - srch + 1;
-    jint kscale = 0x7fffffff / (vsize * 255);
-    jint voff = vsize * srcscan;
-    for (jint x = 0; x < dstw; x++) {
-        jint suma = 0;
-        jint sumr = 0;
-        jint sumg = 0;
-        jint sumb = 0;
-        jint srcoff = x;
-        jint dstoff = x;
-        for (jint y = 0; y < dsth; y++) {
-            jint rgb;
-            // Un-accumulate the data for row-vsize location into the sums.
-            rgb = (srcoff >= voff) ? srcPixels[srcoff - voff] : 0;
-            suma -= (rgb >> 24) & 0xff;
-            sumr -= (rgb >> 16) & 0xff;
-            sumg -= (rgb >>  8) & 0xff;
-            sumb -= (rgb      ) & 0xff;
-            // Accumulate the data for this col location into the sums.
-            rgb = (y < srch) ? srcPixels[srcoff] : 0;
-            suma += (rgb >> 24) & 0xff;
-            sumr += (rgb >> 16) & 0xff;
-            sumg += (rgb >>  8) & 0xff;
-            sumb += (rgb      ) & 0xff;
-            dstPixels[dstoff] =
-                (((suma * kscale) >> 23) << 24) +
-                (((sumr * kscale) >> 23) << 16) +
-                (((sumg * kscale) >> 23) <<  8) +
-                (((sumb * kscale) >> 23)      );
-            srcoff += srcscan;
-            dstoff += dstscan;
-        }
-    }
+#ifdef DECORA_SSE2
+    if (sse2Enabled) {
+        boxBlurVerticalSSE2(dstPixels, dstw, dsth, dstscan,
+                            srcPixels, srcw, srch, srcscan);
+    } else
+#endif
+    boxBlurVertical(dstPixels, dstw, dsth, dstscan,
+                    srcPixels, srcw, srch, srcscan);
 
     env->ReleasePrimitiveArrayCritical(dstPixels_arr, dstPixels, 0);
     env->ReleasePrimitiveArrayCritical(srcPixels_arr, srcPixels, JNI_ABORT);
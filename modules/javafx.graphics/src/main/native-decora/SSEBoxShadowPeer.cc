@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -32,28 +32,11 @@
 #include "SSEUtils.h"
 #include "com_sun_scenario_effect_impl_sw_sse_SSEBoxShadowPeer.h"
 
-JNIEXPORT void JNICALL
-Java_com_sun_scenario_effect_impl_sw_sse_SSEBoxShadowPeer_filterHorizontalBlack
-    (JNIEnv *env, jclass klass,
-     jintArray dstPixels_arr, jint dstw, jint dsth, jint dstscan,
-     jintArray srcPixels_arr, jint srcw, jint srch, jint srcscan,
-     jfloat spread)
+static void
+boxShadowHorizontalBlack(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                         jint *srcPixels, jint srcw, jint srch, jint srcscan,
+                         jfloat spread)
 {
-    if ((checkRange(env,
-                    dstPixels_arr, dstw, dsth,
-                    srcPixels_arr, srcw, srch)) ||
-        dsth > srch) { // We should not move out of source vertical bounds
-        return;
-    }
-
-    jint *srcPixels = (jint *)env->GetPrimitiveArrayCritical(srcPixels_arr, 0);
-    if (srcPixels == NULL) return;
-    jint *dstPixels = (jint *)env->GetPrimitiveArrayCritical(dstPixels_arr, 0);
-    if (dstPixels == NULL) {
-        env->ReleasePrimitiveArrayCritical(srcPixels_arr, srcPixels, JNI_ABORT);
-        return;
-    }
-
     jint hsize = dstw - srcw + 1;
     // amax goes from hsize*255 to 255 as spread goes from 0 to 1
     jint amax = hsize * 255;
@@ -81,6 +64,294 @@ Java_com_sun_scenario_effect_impl_sw_sse_SSEBoxShadowPeer_filterHorizontalBlack
         srcoff += srcscan;
         dstoff += dstscan;
     }
+}
+
+static void
+boxShadowVerticalBlack(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                       jint *srcPixels, jint srcw, jint srch, jint srcscan,
+                       jfloat spread)
+{
+    jint vsize = dsth - srch + 1;
+    // amax goes from hsize*255 to 255 as spread goes from 0 to 1
+    jint amax = vsize * 255;
+    amax += (jint) ((255 - amax) * spread);
+    jint kscale = 0x7fffffff / amax;
+    jint amin = (amax / 255);
+    jint suma[VERTICAL_BLOCK_COLUMNS];
+    for (jint x0 = 0; x0 < dstw; x0 += VERTICAL_BLOCK_COLUMNS) {
+        jint bw = dstw - x0;
+        if (bw > VERTICAL_BLOCK_COLUMNS) bw = VERTICAL_BLOCK_COLUMNS;
+        for (jint x = 0; x < bw; x++) {
+            suma[x] = 0;
+        }
+        for (jint y = 0; y < dsth; y++) {
+            // Rows leaving and entering the window for this output row.
+            jint *oldRow = (y >= vsize)
+                ? srcPixels + (y - vsize) * srcscan + x0 : NULL;
+            jint *newRow = (y < srch)
+                ? srcPixels + y * srcscan + x0 : NULL;
+            jint *dstRow = dstPixels + y * dstscan + x0;
+            for (jint x = 0; x < bw; x++) {
+                jint rgb;
+                // Un-accumulate the data for row-vsize location into the sums.
+                rgb = (oldRow != NULL) ? oldRow[x] : 0;
+                suma[x] -= (rgb >> 24) & 0xff;
+                // Accumulate the data for this row location into the sums.
+                rgb = (newRow != NULL) ? newRow[x] : 0;
+                suma[x] += (rgb >> 24) & 0xff;
+                // Clamp, scale and convert the sum into a color.
+                jint a = suma[x];
+                dstRow[x] =
+                    ((a < amin) ? 0
+                     : ((a >= amax) ? 0xff000000
+                        : (((a * kscale) >> 23) << 24)));
+            }
+        }
+    }
+}
+
+static void
+boxShadowVertical(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                  jint *srcPixels, jint srcw, jint srch, jint srcscan,
+                  jfloat spread, jfloat *shadowColor)
+{
+    jint vsize = dsth - srch + 1;
+    // amax goes from hsize*255 to 255 as spread goes from 0 to 1
+    jint amax = vsize * 255;
+    amax += (jint) ((255 - amax) * spread);
+    jint kscalea = 0x7fffffff / amax;
+    jint kscaler = (jint) (kscalea * shadowColor[0]);
+    jint kscaleg = (jint) (kscalea * shadowColor[1]);
+    jint kscaleb = (jint) (kscalea * shadowColor[2]);
+    kscalea = (jint) (kscalea * shadowColor[3]);
+    jint amin = (amax / 255);
+    jint shadowRGB =
+        (((jint) (shadowColor[0] * 255)) << 16) |
+        (((jint) (shadowColor[1] * 255)) <<  8) |
+        (((jint) (shadowColor[2] * 255))      ) |
+        (((jint) (shadowColor[3] * 255)) << 24);
+    jint suma[VERTICAL_BLOCK_COLUMNS];
+    for (jint x0 = 0; x0 < dstw; x0 += VERTICAL_BLOCK_COLUMNS) {
+        jint bw = dstw - x0;
+        if (bw > VERTICAL_BLOCK_COLUMNS) bw = VERTICAL_BLOCK_COLUMNS;
+        for (jint x = 0; x < bw; x++) {
+            suma[x] = 0;
+        }
+        for (jint y = 0; y < dsth; y++) {
+            // Rows leaving and entering the window for this output row.
+            jint *oldRow = (y >= vsize)
+                ? srcPixels + (y - vsize) * srcscan + x0 : NULL;
+            jint *newRow = (y < srch)
+                ? srcPixels + y * srcscan + x0 : NULL;
+            jint *dstRow = dstPixels + y * dstscan + x0;
+            for (jint x = 0; x < bw; x++) {
+                jint rgb;
+                // Un-accumulate the data for row-vsize location into the sums.
+                rgb = (oldRow != NULL) ? oldRow[x] : 0;
+                suma[x] -= (rgb >> 24) & 0xff;
+                // Accumulate the data for this row location into the sums.
+                rgb = (newRow != NULL) ? newRow[x] : 0;
+                suma[x] += (rgb >> 24) & 0xff;
+                // Clamp, scale and convert the sum into a color.
+                jint a = suma[x];
+                dstRow[x] =
+                    ((a < amin) ? 0
+                     : ((a >= amax) ? shadowRGB
+                        : ((((a * kscalea) >> 23) << 24) |
+                           (((a * kscaler) >> 23) << 16) |
+                           (((a * kscaleg) >> 23) <<  8) |
+                           (((a * kscaleb) >> 23)      ))));
+            }
+        }
+    }
+}
+
+#ifdef DECORA_SSE2
+
+/*
+ * The SSE2 versions keep the alpha sums of four adjacent pixels in one
+ * vector, with the same integer arithmetic as the scalar loops above.
+ * clampShadow4() is their (a < amin) ? 0 : ((a >= amax) ? full : color)
+ * on each lane.
+ */
+static inline __m128i
+clampShadow4(__m128i a, __m128i amin, __m128i amax, __m128i full, __m128i color)
+{
+    __m128i low = _mm_cmplt_epi32(a, amin);
+    __m128i high = _mm_cmpgt_epi32(a, _mm_sub_epi32(amax, _mm_set1_epi32(1)));
+    color = _mm_or_si128(_mm_and_si128(high, full), _mm_andnot_si128(high, color));
+    return _mm_andnot_si128(low, color);
+}
+
+static void
+boxShadowHorizontalBlackSSE2(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                             jint *srcPixels, jint srcw, jint srch, jint srcscan,
+                             jfloat spread)
+{
+    jint hsize = dstw - srcw + 1;
+    // amax goes from hsize*255 to 255 as spread goes from 0 to 1
+    jint amax = hsize * 255;
+    amax += (jint) ((255 - amax) * spread);
+    __m128i kscale = _mm_set1_epi32(0x7fffffff / amax);
+    __m128i amin4 = _mm_set1_epi32(amax / 255);
+    __m128i amax4 = _mm_set1_epi32(amax);
+    __m128i black = _mm_set1_epi32(0xff000000);
+    jint srcoff = 0;
+    jint dstoff = 0;
+    for (jint y = 0; y < dsth; y++) {
+        jint *srcRow = srcPixels + srcoff;
+        jint *dstRow = dstPixels + dstoff;
+        __m128i suma = _mm_setzero_si128();
+        for (jint x = 0; x < dstw; x += 4) {
+            __m128i a = _mm_sub_epi32(
+                _mm_srli_epi32(loadPixels4(srcRow, x, srcw), 24),
+                _mm_srli_epi32(loadPixels4(srcRow, x - hsize, srcw), 24));
+            // Running sums of the four pixels, continuing from the last one.
+            a = _mm_add_epi32(a, _mm_slli_si128(a, 4));
+            a = _mm_add_epi32(a, _mm_slli_si128(a, 8));
+            a = _mm_add_epi32(a, suma);
+            suma = _mm_shuffle_epi32(a, _MM_SHUFFLE(3, 3, 3, 3));
+            __m128i color = _mm_slli_epi32(mulShift23(a, kscale), 24);
+            storePixels4(dstRow + x, clampShadow4(a, amin4, amax4, black, color),
+                         dstw - x);
+        }
+        srcoff += srcscan;
+        dstoff += dstscan;
+    }
+}
+
+static void
+boxShadowVerticalBlackSSE2(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                           jint *srcPixels, jint srcw, jint srch, jint srcscan,
+                           jfloat spread)
+{
+    jint vsize = dsth - srch + 1;
+    // amax goes from hsize*255 to 255 as spread goes from 0 to 1
+    jint amax = vsize * 255;
+    amax += (jint) ((255 - amax) * spread);
+    __m128i kscale = _mm_set1_epi32(0x7fffffff / amax);
+    __m128i amin4 = _mm_set1_epi32(amax / 255);
+    __m128i amax4 = _mm_set1_epi32(amax);
+    __m128i black = _mm_set1_epi32(0xff000000);
+    __m128i suma[VERTICAL_BLOCK_COLUMNS / 4];
+    for (jint x0 = 0; x0 < dstw; x0 += VERTICAL_BLOCK_COLUMNS) {
+        jint bw = dstw - x0;
+        if (bw > VERTICAL_BLOCK_COLUMNS) bw = VERTICAL_BLOCK_COLUMNS;
+        for (jint x = 0; x < VERTICAL_BLOCK_COLUMNS / 4; x++) {
+            suma[x] = _mm_setzero_si128();
+        }
+        for (jint y = 0; y < dsth; y++) {
+            // Rows leaving and entering the window for this output row.
+            jint *oldRow = (y >= vsize)
+                ? srcPixels + (y - vsize) * srcscan + x0 : NULL;
+            jint *newRow = (y < srch)
+                ? srcPixels + y * srcscan + x0 : NULL;
+            jint *dstRow = dstPixels + y * dstscan + x0;
+            for (jint x = 0; x < bw; x += 4) {
+                __m128i oldPixels = (oldRow != NULL)
+                    ? loadPixels4(oldRow, x, bw) : _mm_setzero_si128();
+                __m128i newPixels = (newRow != NULL)
+                    ? loadPixels4(newRow, x, bw) : _mm_setzero_si128();
+                __m128i a = _mm_add_epi32(suma[x / 4],
+                    _mm_sub_epi32(_mm_srli_epi32(newPixels, 24),
+                                  _mm_srli_epi32(oldPixels, 24)));
+                suma[x / 4] = a;
+                __m128i color = _mm_slli_epi32(mulShift23(a, kscale), 24);
+                storePixels4(dstRow + x, clampShadow4(a, amin4, amax4, black, color),
+                             bw - x);
+            }
+        }
+    }
+}
+
+static void
+boxShadowVerticalSSE2(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                      jint *srcPixels, jint srcw, jint srch, jint srcscan,
+                      jfloat spread, jfloat *shadowColor)
+{
+    jint vsize = dsth - srch + 1;
+    // amax goes from hsize*255 to 255 as spread goes from 0 to 1
+    jint amax = vsize * 255;
+    amax += (jint) ((255 - amax) * spread);
+    jint kscale = 0x7fffffff / amax;
+    __m128i kscaler = _mm_set1_epi32((jint) (kscale * shadowColor[0]));
+    __m128i kscaleg = _mm_set1_epi32((jint) (kscale * shadowColor[1]));
+    __m128i kscaleb = _mm_set1_epi32((jint) (kscale * shadowColor[2]));
+    __m128i kscalea = _mm_set1_epi32((jint) (kscale * shadowColor[3]));
+    __m128i amin4 = _mm_set1_epi32(amax / 255);
+    __m128i amax4 = _mm_set1_epi32(amax);
+    __m128i shadowRGB = _mm_set1_epi32(
+        (((jint) (shadowColor[0] * 255)) << 16) |
+        (((jint) (shadowColor[1] * 255)) <<  8) |
+        (((jint) (shadowColor[2] * 255))      ) |
+        (((jint) (shadowColor[3] * 255)) << 24));
+    __m128i suma[VERTICAL_BLOCK_COLUMNS / 4];
+    for (jint x0 = 0; x0 < dstw; x0 += VERTICAL_BLOCK_COLUMNS) {
+        jint bw = dstw - x0;
+        if (bw > VERTICAL_BLOCK_COLUMNS) bw = VERTICAL_BLOCK_COLUMNS;
+        for (jint x = 0; x < VERTICAL_BLOCK_COLUMNS / 4; x++) {
+            suma[x] = _mm_setzero_si128();
+        }
+        for (jint y = 0; y < dsth; y++) {
+            // Rows leaving and entering the window for this output row.
+            jint *oldRow = (y >= vsize)
+                ? srcPixels + (y - vsize) * srcscan + x0 : NULL;
+            jint *newRow = (y < srch)
+                ? srcPixels + y * srcscan + x0 : NULL;
+            jint *dstRow = dstPixels + y * dstscan + x0;
+            for (jint x = 0; x < bw; x += 4) {
+                __m128i oldPixels = (oldRow != NULL)
+                    ? loadPixels4(oldRow, x, bw) : _mm_setzero_si128();
+                __m128i newPixels = (newRow != NULL)
+                    ? loadPixels4(newRow, x, bw) : _mm_setzero_si128();
+                __m128i a = _mm_add_epi32(suma[x / 4],
+                    _mm_sub_epi32(_mm_srli_epi32(newPixels, 24),
+                                  _mm_srli_epi32(oldPixels, 24)));
+                suma[x / 4] = a;
+                __m128i color = _mm_or_si128(
+                    _mm_or_si128(_mm_slli_epi32(mulShift23(a, kscalea), 24),
+                                 _mm_slli_epi32(mulShift23(a, kscaler), 16)),
+                    _mm_or_si128(_mm_slli_epi32(mulShift23(a, kscaleg), 8),
+                                 mulShift23(a, kscaleb)));
+                storePixels4(dstRow + x, clampShadow4(a, amin4, amax4, shadowRGB, color),
+                             bw - x);
+            }
+        }
+    }
+}
+
+#endif /* DECORA_SSE2 */
+
+JNIEXPORT void JNICALL
+Java_com_sun_scenario_effect_impl_sw_sse_SSEBoxShadowPeer_filterHorizontalBlack
+    (JNIEnv *env, jclass klass,
+     jintArray dstPixels_arr, jint dstw, jint dsth, jint dstscan,
+     jintArray srcPixels_arr, jint srcw, jint srch, jint srcscan,
+     jfloat spread)
+{
+    if ((checkRange(env,
+                    dstPixels_arr, dstw, dsth,
+                    srcPixels_arr, srcw, srch)) ||
+        dsth > srch) { // We should not move out of source vertical bounds
+        return;
+    }
+
+    jint *srcPixels = (jint *)env->GetPrimitiveArrayCritical(srcPixels_arr, 0);
+    if (srcPixels == NULL) return;
+    jint *dstPixels = (jint *)env->GetPrimitiveArrayCritical(dstPixels_arr, 0);
+    if (dstPixels == NULL) {
+        env->ReleasePrimitiveArrayCritical(srcPixels_arr, srcPixels, JNI_ABORT);
+        return;
+    }
+
+#ifdef DECORA_SSE2
+    if (sse2Enabled) {
+        boxShadowHorizontalBlackSSE2(dstPixels, dstw, dsth, dstscan,
+                                     srcPixels, srcw, srch, srcscan, spread);
+    } else
+#endif
+    boxShadowHorizontalBlack(dstPixels, dstw, dsth, dstscan,
+                             srcPixels, srcw, srch, srcscan, spread);
 
     env->ReleasePrimitiveArrayCritical(dstPixels_arr, dstPixels, 0);
     env->ReleasePrimitiveArrayCritical(srcPixels_arr, srcPixels, JNI_ABORT);
@@ -108,34 +379,14 @@ Java_com_sun_scenario_effect_impl_sw_sse_SSEBoxShadowPeer_filterVerticalBlack
         return;
     }
 
-    jint vsize = dsth - srch + 1;
-    // amax goes from hsize*255 to 255 as spread goes from 0 to 1
-    jint amax = vsize * 255;
-    amax += (jint) ((255 - amax) * spread);
-    jint kscale = 0x7fffffff / amax;
-    jint amin = (amax / 255);
-    jint voff = vsize * srcscan;
-    for (jint x = 0; x < dstw; x++) {
-        jint suma = 0;
-        jint srcoff = x;
-        jint dstoff = x;
-        for (jint y = 0; y < dsth; y++) {
-            jint rgb;
-            // Un-accumulate the data for row-vsize location into the sums.
-            rgb = (srcoff >= voff) ? srcPixels[srcoff - voff] : 0;
-            suma -= (rgb >> 24) & 0xff;
-            // Accumulate the data for this row location into the sums.
-            rgb = (y < srch) ? srcPixels[srcoff] : 0;
-            suma += (rgb >> 24) & 0xff;
-            // Clamp, scale and convert the sum into a color.
-            dstPixels[dstoff] =
-                ((suma < amin) ? 0
-                 : ((suma >= amax) ? 0xff000000
-                    : (((suma * kscale) >> 23) << 24)));
-            srcoff += srcscan;
-            dstoff += dstscan;
-        }
-    }
+#ifdef DECORA_SSE2
+    if (sse2Enabled) {
+        boxShadowVerticalBlackSSE2(dstPixels, dstw, dsth, dstscan,
+                                   srcPixels, srcw, srch, srcscan, spread);
+    } else
+#endif
+    boxShadowVerticalBlack(dstPixels, dstw, dsth, dstscan,
+                           srcPixels, srcw, srch, srcscan, spread);
 
     env->ReleasePrimitiveArrayCritical(dstPixels_arr, dstPixels, 0);
     env->ReleasePrimitiveArrayCritical(srcPixels_arr, srcPixels, JNI_ABORT);
@@ -166,46 +417,14 @@ Java_com_sun_scenario_effect_impl_sw_sse_SSEBoxShadowPeer_filterVertical
         return;
     }
 
-    jint vsize = dsth - srch + 1;
-    // amax goes from hsize*255 to 255 as spread goes from 0 to 1
-    jint amax = vsize * 255;
-    amax += (jint) ((255 - amax) * spread);
-    jint kscalea = 0x7fffffff / amax;
-    jint kscaler = (jint) (kscalea * shadowColor[0]);
-    jint kscaleg = (jint) (kscalea * shadowColor[1]);
-    jint kscaleb = (jint) (kscalea * shadowColor[2]);
-    kscalea = (jint) (kscalea * shadowColor[3]);
-    jint amin = (amax / 255);
-    jint voff = vsize * srcscan;
-    jint shadowRGB =
-        (((jint) (shadowColor[0] * 255)) << 16) |
-        (((jint) (shadowColor[1] * 255)) <<  8) |
-        (((jint) (shadowColor[2] * 255))      ) |
-        (((jint) (shadowColor[3] * 255)) << 24);
-    for (jint x = 0; x < dstw; x++) {
-        jint suma = 0;
-        jint srcoff = x;
-        jint dstoff = x;
-        for (jint y = 0; y < dsth; y++) {
-            jint rgb;
-            // Un-accumulate the data for row-vsize location into the sums.
-            rgb = (srcoff >= voff) ? srcPixels[srcoff - voff] : 0;
-            suma -= (rgb >> 24) & 0xff;
-            // Accumulate the data for this row location into the sums.
-            rgb = (y < srch) ? srcPixels[srcoff] : 0;
-            suma += (rgb >> 24) & 0xff;
-            // Clamp, scale and convert the sum into a color.
-            dstPixels[dstoff] =
-                ((suma < amin) ? 0
-                 : ((suma >= amax) ? shadowRGB
-                    : ((((suma * kscalea) >> 23) << 24) |
-                       (((suma * kscaler) >> 23) << 16) |
-                       (((suma * kscaleg) >> 23) <<  8) |
-                       (((suma * kscaleb) >> 23)      ))));
-            srcoff += srcscan;
-            dstoff += dstscan;
-        }
-    }
+#ifdef DECORA_SSE2
+    if (sse2Enabled) {
+        boxShadowVerticalSSE2(dstPixels, dstw, dsth, dstscan,
+                              srcPixels, srcw, srch, srcscan, spread, shadowColor);
+    } else
+#endif
+    boxShadowVertical(dstPixels, dstw, dsth, dstscan,
+                      srcPixels, srcw, srch, srcscan, spread, shadowColor);
 
     env->ReleasePrimitiveArrayCritical(dstPixels_arr, dstPixels, 0);
     env->ReleasePrimitiveArrayCritical(srcPixels_arr, srcPixels, JNI_ABORT);
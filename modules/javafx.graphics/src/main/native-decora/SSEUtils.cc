@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2008, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2008, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -29,6 +29,9 @@
 #ifdef WIN32 /* WIN32 */
 #include <windows.h>
 #endif
+#if defined(DECORA_AVX2) && defined(_MSC_VER)
+#include <intrin.h>
+#endif
 
 JNIEXPORT jboolean JNICALL
 Java_com_sun_scenario_effect_impl_sw_sse_SSERendererDelegate_isSupported
@@ -43,6 +46,74 @@ Java_com_sun_scenario_effect_impl_sw_sse_SSERendererDelegate_isSupported
 #endif
 }
 
+#ifdef DECORA_SSE2
+jboolean sse2Enabled = JNI_TRUE;
+#endif
+
+JNIEXPORT jboolean JNICALL
+Java_com_sun_scenario_effect_impl_sw_sse_SSERendererDelegate_setSSE2Enabled
+    (JNIEnv *env, jclass klass, jboolean enabled)
+{
+#ifdef DECORA_SSE2
+    sse2Enabled = enabled;
+    return enabled;
+#else
+    return JNI_FALSE;
+#endif
+}
+
+/*
+ * The widest vector loops of the generated peers this processor can run.
+ */
+static jint maxVectorLanes()
+{
+#ifdef DECORA_AVX2
+#ifdef _MSC_VER
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] >= 7) {
+        __cpuid(info, 1);
+        // AVX, and the OS saving the YMM registers
+        if ((info[2] & (1 << 28)) && (info[2] & (1 << 27)) &&
+            (_xgetbv(0) & 6) == 6)
+        {
+            __cpuidex(info, 7, 0);
+            if (info[1] & (1 << 5)) {
+                return 8;
+            }
+        }
+    }
+#else
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return 8;
+    }
+#endif
+#endif
+#ifdef DECORA_SSE2
+    return 4;
+#else
+    return 1;
+#endif
+}
+
+static const jint supportedVectorLanes = maxVectorLanes();
+jint vectorLanes = supportedVectorLanes;
+
+JNIEXPORT jint JNICALL
+Java_com_sun_scenario_effect_impl_sw_sse_SSERendererDelegate_setVectorLanes
+    (JNIEnv *env, jclass klass, jint lanes)
+{
+    if (lanes >= 8 && supportedVectorLanes >= 8) {
+        vectorLanes = 8;
+    } else if (lanes >= 4 && supportedVectorLanes >= 4) {
+        vectorLanes = 4;
+    } else {
+        vectorLanes = 1;
+    }
+    return vectorLanes;
+}
+
 static void laccum(jint pixel, jfloat mul, jfloat *fvals) {
     mul /= 255.f;
     fvals[FVAL_R] += ((pixel >> 16) & 0xff) * mul;
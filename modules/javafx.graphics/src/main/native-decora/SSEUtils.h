@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -29,6 +29,18 @@
 #include <stddef.h>
 #include <jni.h>
 
+/*
+ * The box blur and box shadow filters have SSE2 versions wherever the
+ * target instruction set has it, as on x64. They give the same pixels as
+ * the scalar loops, which stay in use for the other targets and when
+ * sse2Enabled is cleared through SSERendererDelegate.setSSE2Enabled().
+ */
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define DECORA_SSE2
+#include <emmintrin.h>
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif /* __cplusplus */
@@ -42,6 +54,13 @@ extern "C" {
 #define INT_MAX 2147483647
 #endif /* INT_MAX */
 
+/*
+ * Number of adjacent columns the vertical box filters keep running sums
+ * for while sweeping down the image, so that rows are read sequentially
+ * instead of walking one column at a time.
+ */
+#define VERTICAL_BLOCK_COLUMNS 256
+
 void lsample(jint *img,
              jfloat floc_x, jfloat floc_y,
              jint w, jint h, jint scan,
@@ -61,8 +80,325 @@ bool checkRange(JNIEnv *env,
                 jintArray dstPixels_arr, jint dstw, jint dsth,
                 jintArray srcPixels_arr, jint srcw, jint srch);
 
+#ifdef DECORA_SSE2
+extern jboolean sse2Enabled;
+#endif
+
+/*
+ * Number of adjacent pixels the generated peers shade at once: 8 where
+ * the processor has AVX2, otherwise 4 where the library has SSE2, or 1
+ * for their scalar loop only.
+ */
+extern jint vectorLanes;
+
 #ifdef __cplusplus
 };
 #endif /* __cplusplus */
 
+#ifdef DECORA_SSE2
+
+/*
+ * Loads row[start] to row[start + 3], with 0 for the pixels outside of
+ * row[0] to row[limit - 1].
+ */
+static inline __m128i loadPixels4(const jint *row, jint start, jint limit)
+{
+    if (start >= 0 && start + 4 <= limit) {
+        return _mm_loadu_si128((const __m128i *) (row + start));
+    }
+    if (start + 4 <= 0 || start >= limit) {
+        return _mm_setzero_si128();
+    }
+    jint pixels[4];
+    for (jint i = 0; i < 4; i++) {
+        jint x = start + i;
+        pixels[i] = (x >= 0 && x < limit) ? row[x] : 0;
+    }
+    return _mm_loadu_si128((const __m128i *) pixels);
+}
+
+/*
+ * Stores the first count of four pixels, all of them when count >= 4.
+ */
+static inline void storePixels4(jint *row, __m128i pixels, jint count)
+{
+    if (count >= 4) {
+        _mm_storeu_si128((__m128i *) row, pixels);
+    } else {
+        jint values[4];
+        _mm_storeu_si128((__m128i *) values, pixels);
+        for (jint i = 0; i < count; i++) {
+            row[i] = values[i];
+        }
+    }
+}
+
+/*
+ * Differences between the components of four new and four old pixels,
+ * spread over the four 32-bit lanes of one vector per pixel, blue in the
+ * lowest lane and alpha in the highest.
+ */
+static inline void pixelDeltas4(__m128i newPixels, __m128i oldPixels, __m128i *deltas)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i lo = _mm_sub_epi16(_mm_unpacklo_epi8(newPixels, zero),
+                               _mm_unpacklo_epi8(oldPixels, zero));
+    __m128i hi = _mm_sub_epi16(_mm_unpackhi_epi8(newPixels, zero),
+                               _mm_unpackhi_epi8(oldPixels, zero));
+    deltas[0] = _mm_srai_epi32(_mm_unpacklo_epi16(lo, lo), 16);
+    deltas[1] = _mm_srai_epi32(_mm_unpackhi_epi16(lo, lo), 16);
+    deltas[2] = _mm_srai_epi32(_mm_unpacklo_epi16(hi, hi), 16);
+    deltas[3] = _mm_srai_epi32(_mm_unpackhi_epi16(hi, hi), 16);
+}
+
+/*
+ * Packs four pixels with their components in the 0-255 range, spread
+ * over the lanes of one vector per pixel as by pixelDeltas4().
+ */
+static inline __m128i packPixels4(__m128i p0, __m128i p1, __m128i p2, __m128i p3)
+{
+    return _mm_packus_epi16(_mm_packs_epi32(p0, p1), _mm_packs_epi32(p2, p3));
+}
+
+/*
+ * (sum * kscale) >> 23 on each 32-bit lane, as the scalar filters compute
+ * it for products below 2^31. Lanes with larger products give other values
+ * without disturbing their neighbors.
+ */
+static inline __m128i mulShift23(__m128i sum, __m128i kscale)
+{
+    const __m128i low = _mm_set_epi32(0, -1, 0, -1);
+    __m128i even = _mm_srli_epi64(_mm_mul_epu32(sum, kscale), 23);
+    __m128i odd = _mm_srli_epi64(_mm_mul_epu32(_mm_srli_epi64(sum, 32),
+                                               _mm_srli_epi64(kscale, 32)), 23);
+    return _mm_or_si128(_mm_and_si128(even, low), _mm_slli_epi64(odd, 32));
+}
+
+#endif /* DECORA_SSE2 */
+
+#if defined(DECORA_SSE2) && defined(__cplusplus)
+
+#include <math.h>
+
+/*
+ * Types for the vector loops of the generated peers, which shade
+ * VFloat4::LANES adjacent pixels at once with each JSL float held in a
+ * VFloat4, lane i for the i-th pixel. The operators compute on each lane
+ * what the C operators compute for one pixel in the scalar loops. JSL
+ * comparisons give a VMask4 of the lanes for which they hold, which the
+ * generated code passes to vselect() to update only those lanes.
+ */
+struct VMask4 {
+    __m128 m;
+    VMask4(__m128 m) : m(m) {}
+    VMask4(bool b) : m(_mm_castsi128_ps(_mm_set1_epi32(b ? -1 : 0))) {}
+};
+
+static inline VMask4 operator&&(VMask4 a, VMask4 b) { return _mm_and_ps(a.m, b.m); }
+static inline VMask4 operator||(VMask4 a, VMask4 b) { return _mm_or_ps(a.m, b.m); }
+static inline VMask4 operator!(VMask4 a) { return _mm_xor_ps(a.m, VMask4(true).m); }
+
+/*
+ * Bit i is set when lane i is.
+ */
+static inline int laneBits(VMask4 a) { return _mm_movemask_ps(a.m); }
+static inline bool any(VMask4 a) { return laneBits(a) != 0; }
+
+struct VInt4 {
+    __m128i v;
+    VInt4(__m128i v) : v(v) {}
+    VInt4(jint i) : v(_mm_set1_epi32(i)) {}
+    static VInt4 load(const jint *p) { return _mm_loadu_si128((const __m128i *) p); }
+    void store(jint *p) const { _mm_storeu_si128((__m128i *) p, v); }
+};
+
+static inline VInt4 operator&(VInt4 a, VInt4 b) { return _mm_and_si128(a.v, b.v); }
+static inline VInt4 operator|(VInt4 a, VInt4 b) { return _mm_or_si128(a.v, b.v); }
+static inline VInt4 operator<<(VInt4 a, int n) { return _mm_slli_epi32(a.v, n); }
+/* Logical shift; only used where the bits shifted in are masked off. */
+static inline VInt4 operator>>(VInt4 a, int n) { return _mm_srli_epi32(a.v, n); }
+static inline VMask4 operator<(VInt4 a, VInt4 b) { return _mm_castsi128_ps(_mm_cmplt_epi32(a.v, b.v)); }
+static inline VMask4 operator>(VInt4 a, VInt4 b) { return _mm_castsi128_ps(_mm_cmpgt_epi32(a.v, b.v)); }
+static inline VMask4 operator<=(VInt4 a, VInt4 b) { return !(a > b); }
+static inline VMask4 operator>=(VInt4 a, VInt4 b) { return !(a < b); }
+
+struct VFloat4 {
+    enum { LANES = 4 };
+    __m128 v;
+    VFloat4() : v(_mm_setzero_ps()) {}
+    VFloat4(__m128 v) : v(v) {}
+    VFloat4(float f) : v(_mm_set1_ps(f)) {}
+    static VFloat4 load(const float *p) { return _mm_loadu_ps(p); }
+    void store(float *p) const { _mm_storeu_ps(p, v); }
+    VFloat4 &operator+=(VFloat4 b) { v = _mm_add_ps(v, b.v); return *this; }
+    VFloat4 &operator-=(VFloat4 b) { v = _mm_sub_ps(v, b.v); return *this; }
+    VFloat4 &operator*=(VFloat4 b) { v = _mm_mul_ps(v, b.v); return *this; }
+    VFloat4 &operator/=(VFloat4 b) { v = _mm_div_ps(v, b.v); return *this; }
+};
+
+static inline VFloat4 operator+(VFloat4 a, VFloat4 b) { return _mm_add_ps(a.v, b.v); }
+static inline VFloat4 operator-(VFloat4 a, VFloat4 b) { return _mm_sub_ps(a.v, b.v); }
+static inline VFloat4 operator*(VFloat4 a, VFloat4 b) { return _mm_mul_ps(a.v, b.v); }
+static inline VFloat4 operator/(VFloat4 a, VFloat4 b) { return _mm_div_ps(a.v, b.v); }
+static inline VFloat4 operator+(VFloat4 a) { return a; }
+static inline VFloat4 operator-(VFloat4 a) { return _mm_xor_ps(a.v, _mm_set1_ps(-0.f)); }
+static inline VMask4 operator<(VFloat4 a, VFloat4 b) { return _mm_cmplt_ps(a.v, b.v); }
+static inline VMask4 operator>(VFloat4 a, VFloat4 b) { return _mm_cmpgt_ps(a.v, b.v); }
+static inline VMask4 operator<=(VFloat4 a, VFloat4 b) { return _mm_cmple_ps(a.v, b.v); }
+static inline VMask4 operator>=(VFloat4 a, VFloat4 b) { return _mm_cmpge_ps(a.v, b.v); }
+static inline VMask4 operator==(VFloat4 a, VFloat4 b) { return _mm_cmpeq_ps(a.v, b.v); }
+static inline VMask4 operator!=(VFloat4 a, VFloat4 b) { return _mm_cmpneq_ps(a.v, b.v); }
+
+/*
+ * a where m is set, b elsewhere.
+ */
+static inline VFloat4 vselect(VMask4 m, VFloat4 a, VFloat4 b)
+{
+    return _mm_or_ps(_mm_and_ps(m.m, a.v), _mm_andnot_ps(m.m, b.v));
+}
+
+/* (int) casts, truncating towards zero. */
+static inline VInt4 vtrunc(VFloat4 a) { return _mm_cvttps_epi32(a.v); }
+static inline VFloat4 vfloat(VInt4 a) { return _mm_cvtepi32_ps(a.v); }
+
+static inline VFloat4 vfabs(VFloat4 a) { return _mm_andnot_ps(_mm_set1_ps(-0.f), a.v); }
+static inline VFloat4 vsqrt(VFloat4 a) { return _mm_sqrt_ps(a.v); }
+
+/*
+ * SSE2 has no rounding instruction, so these round the truncated value
+ * the rest of the way and give it the sign of a, which it always has
+ * (floor(-0.0) and ceil(-0.5) are -0.0). Magnitudes from 2^23 up have no
+ * fraction and are returned as they are, and so are NaNs.
+ */
+static inline VFloat4 vfloor(VFloat4 a)
+{
+    VFloat4 t = vfloat(vtrunc(a));
+    t = vselect(t > a, t - 1.f, t);
+    t = _mm_or_ps(t.v, _mm_and_ps(a.v, _mm_set1_ps(-0.f)));
+    return vselect(vfabs(a) < 8388608.f, t, a);
+}
+
+static inline VFloat4 vceil(VFloat4 a)
+{
+    VFloat4 t = vfloat(vtrunc(a));
+    t = vselect(t < a, t + 1.f, t);
+    t = _mm_or_ps(t.v, _mm_and_ps(a.v, _mm_set1_ps(-0.f)));
+    return vselect(vfabs(a) < 8388608.f, t, a);
+}
+
+#define DECORA_VFLOAT VFloat4
+#define DECORA_VMASK VMask4
+#define DECORA_VINT VInt4
+#include "SSEVectorUtils.h"
+#undef DECORA_VFLOAT
+#undef DECORA_VMASK
+#undef DECORA_VINT
+
+/*
+ * The same types for eight pixels. They use AVX2 instructions without
+ * requiring them of the rest of the library: DECORA_AVX2_BEGIN and
+ * DECORA_AVX2_END enclose the code built for AVX2, which only runs when
+ * vectorLanes is 8.
+ */
+#if defined(__GNUC__) || defined(_M_X64)
+#define DECORA_AVX2
+#include <immintrin.h>
+
+#if defined(__clang__)
+#define DECORA_AVX2_BEGIN \
+    _Pragma("clang attribute push (__attribute__((target(\"avx2\"))), apply_to = function)")
+#define DECORA_AVX2_END _Pragma("clang attribute pop")
+#elif defined(__GNUC__)
+#define DECORA_AVX2_BEGIN _Pragma("GCC push_options") _Pragma("GCC target(\"avx2\")")
+#define DECORA_AVX2_END _Pragma("GCC pop_options")
+#else
+#define DECORA_AVX2_BEGIN
+#define DECORA_AVX2_END
+#endif
+
+DECORA_AVX2_BEGIN
+
+struct VMask8 {
+    __m256 m;
+    VMask8(__m256 m) : m(m) {}
+    VMask8(bool b) : m(_mm256_castsi256_ps(_mm256_set1_epi32(b ? -1 : 0))) {}
+};
+
+static inline VMask8 operator&&(VMask8 a, VMask8 b) { return _mm256_and_ps(a.m, b.m); }
+static inline VMask8 operator||(VMask8 a, VMask8 b) { return _mm256_or_ps(a.m, b.m); }
+static inline VMask8 operator!(VMask8 a) { return _mm256_xor_ps(a.m, VMask8(true).m); }
+static inline int laneBits(VMask8 a) { return _mm256_movemask_ps(a.m); }
+static inline bool any(VMask8 a) { return laneBits(a) != 0; }
+
+struct VInt8 {
+    __m256i v;
+    VInt8(__m256i v) : v(v) {}
+    VInt8(jint i) : v(_mm256_set1_epi32(i)) {}
+    static VInt8 load(const jint *p) { return _mm256_loadu_si256((const __m256i *) p); }
+    void store(jint *p) const { _mm256_storeu_si256((__m256i *) p, v); }
+};
+
+static inline VInt8 operator&(VInt8 a, VInt8 b) { return _mm256_and_si256(a.v, b.v); }
+static inline VInt8 operator|(VInt8 a, VInt8 b) { return _mm256_or_si256(a.v, b.v); }
+static inline VInt8 operator<<(VInt8 a, int n) { return _mm256_slli_epi32(a.v, n); }
+static inline VInt8 operator>>(VInt8 a, int n) { return _mm256_srli_epi32(a.v, n); }
+static inline VMask8 operator<(VInt8 a, VInt8 b) { return _mm256_castsi256_ps(_mm256_cmpgt_epi32(b.v, a.v)); }
+static inline VMask8 operator>(VInt8 a, VInt8 b) { return _mm256_castsi256_ps(_mm256_cmpgt_epi32(a.v, b.v)); }
+static inline VMask8 operator<=(VInt8 a, VInt8 b) { return !(a > b); }
+static inline VMask8 operator>=(VInt8 a, VInt8 b) { return !(a < b); }
+
+struct VFloat8 {
+    enum { LANES = 8 };
+    __m256 v;
+    VFloat8() : v(_mm256_setzero_ps()) {}
+    VFloat8(__m256 v) : v(v) {}
+    VFloat8(float f) : v(_mm256_set1_ps(f)) {}
+    static VFloat8 load(const float *p) { return _mm256_loadu_ps(p); }
+    void store(float *p) const { _mm256_storeu_ps(p, v); }
+    VFloat8 &operator+=(VFloat8 b) { v = _mm256_add_ps(v, b.v); return *this; }
+    VFloat8 &operator-=(VFloat8 b) { v = _mm256_sub_ps(v, b.v); return *this; }
+    VFloat8 &operator*=(VFloat8 b) { v = _mm256_mul_ps(v, b.v); return *this; }
+    VFloat8 &operator/=(VFloat8 b) { v = _mm256_div_ps(v, b.v); return *this; }
+};
+
+static inline VFloat8 operator+(VFloat8 a, VFloat8 b) { return _mm256_add_ps(a.v, b.v); }
+static inline VFloat8 operator-(VFloat8 a, VFloat8 b) { return _mm256_sub_ps(a.v, b.v); }
+static inline VFloat8 operator*(VFloat8 a, VFloat8 b) { return _mm256_mul_ps(a.v, b.v); }
+static inline VFloat8 operator/(VFloat8 a, VFloat8 b) { return _mm256_div_ps(a.v, b.v); }
+static inline VFloat8 operator+(VFloat8 a) { return a; }
+static inline VFloat8 operator-(VFloat8 a) { return _mm256_xor_ps(a.v, _mm256_set1_ps(-0.f)); }
+static inline VMask8 operator<(VFloat8 a, VFloat8 b) { return _mm256_cmp_ps(a.v, b.v, _CMP_LT_OQ); }
+static inline VMask8 operator>(VFloat8 a, VFloat8 b) { return _mm256_cmp_ps(a.v, b.v, _CMP_GT_OQ); }
+static inline VMask8 operator<=(VFloat8 a, VFloat8 b) { return _mm256_cmp_ps(a.v, b.v, _CMP_LE_OQ); }
+static inline VMask8 operator>=(VFloat8 a, VFloat8 b) { return _mm256_cmp_ps(a.v, b.v, _CMP_GE_OQ); }
+static inline VMask8 operator==(VFloat8 a, VFloat8 b) { return _mm256_cmp_ps(a.v, b.v, _CMP_EQ_OQ); }
+static inline VMask8 operator!=(VFloat8 a, VFloat8 b) { return _mm256_cmp_ps(a.v, b.v, _CMP_NEQ_UQ); }
+
+static inline VFloat8 vselect(VMask8 m, VFloat8 a, VFloat8 b)
+{
+    return _mm256_blendv_ps(b.v, a.v, m.m);
+}
+
+static inline VInt8 vtrunc(VFloat8 a) { return _mm256_cvttps_epi32(a.v); }
+static inline VFloat8 vfloat(VInt8 a) { return _mm256_cvtepi32_ps(a.v); }
+
+static inline VFloat8 vfabs(VFloat8 a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.f), a.v); }
+static inline VFloat8 vsqrt(VFloat8 a) { return _mm256_sqrt_ps(a.v); }
+static inline VFloat8 vfloor(VFloat8 a) { return _mm256_floor_ps(a.v); }
+static inline VFloat8 vceil(VFloat8 a) { return _mm256_ceil_ps(a.v); }
+
+#define DECORA_VFLOAT VFloat8
+#define DECORA_VMASK VMask8
+#define DECORA_VINT VInt8
+#include "SSEVectorUtils.h"
+#undef DECORA_VFLOAT
+#undef DECORA_VMASK
+#undef DECORA_VINT
+
+DECORA_AVX2_END
+
+#endif /* __GNUC__ || _M_X64 */
+
+#endif /* DECORA_SSE2 && __cplusplus */
+
 #endif /* _Included_SSEUtils */
@@ -0,0 +1,298 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * The vector helpers that are written the same way for every lane count.
+ * SSEUtils.h includes this file once for each set of vector types, with
+ * DECORA_VFLOAT, DECORA_VMASK and DECORA_VINT naming them, so it has no
+ * include guard of its own.
+ *
+ * Each function computes on every lane what the scalar code generated for
+ * the same JSL function, or the scalar sampling function in SSEUtils.cc,
+ * computes for one pixel, in the same order.
+ */
+
+static inline DECORA_VFLOAT vmin(DECORA_VFLOAT x, DECORA_VFLOAT y)
+{
+    return vselect(x < y, x, y);
+}
+
+static inline DECORA_VFLOAT vmax(DECORA_VFLOAT x, DECORA_VFLOAT y)
+{
+    return vselect(x > y, x, y);
+}
+
+static inline DECORA_VFLOAT vclamp(DECORA_VFLOAT val, DECORA_VFLOAT min, DECORA_VFLOAT max)
+{
+    return vselect(val < min, min, vselect(val > max, max, val));
+}
+
+static inline DECORA_VFLOAT vsmoothstep(DECORA_VFLOAT min, DECORA_VFLOAT max, DECORA_VFLOAT val)
+{
+    return vselect(val < min, 0.f, vselect(val > max, 1.f, val / (max - min)));
+}
+
+static inline DECORA_VFLOAT vsign(DECORA_VFLOAT x)
+{
+    return vselect(x < 0.f, -1.f, vselect(x > 0.f, 1.f, 0.f));
+}
+
+/*
+ * The C library functions, called for one lane after the other.
+ */
+static inline DECORA_VFLOAT vsin(DECORA_VFLOAT x)
+{
+    float f[DECORA_VFLOAT::LANES];
+    x.store(f);
+    for (int i = 0; i < DECORA_VFLOAT::LANES; i++) {
+        f[i] = sin(f[i]);
+    }
+    return DECORA_VFLOAT::load(f);
+}
+
+static inline DECORA_VFLOAT vcos(DECORA_VFLOAT x)
+{
+    float f[DECORA_VFLOAT::LANES];
+    x.store(f);
+    for (int i = 0; i < DECORA_VFLOAT::LANES; i++) {
+        f[i] = cos(f[i]);
+    }
+    return DECORA_VFLOAT::load(f);
+}
+
+static inline DECORA_VFLOAT vtan(DECORA_VFLOAT x)
+{
+    float f[DECORA_VFLOAT::LANES];
+    x.store(f);
+    for (int i = 0; i < DECORA_VFLOAT::LANES; i++) {
+        f[i] = tan(f[i]);
+    }
+    return DECORA_VFLOAT::load(f);
+}
+
+static inline DECORA_VFLOAT vpow(DECORA_VFLOAT x, DECORA_VFLOAT y)
+{
+    float fx[DECORA_VFLOAT::LANES];
+    float fy[DECORA_VFLOAT::LANES];
+    x.store(fx);
+    y.store(fy);
+    for (int i = 0; i < DECORA_VFLOAT::LANES; i++) {
+        fx[i] = pow(fx[i], fy[i]);
+    }
+    return DECORA_VFLOAT::load(fx);
+}
+
+/*
+ * Splits the pixels of the lanes set in bits into their components, 0
+ * for the other lanes.
+ */
+static inline void vpixels(const jint *img, const jint *offsets, int bits,
+                           DECORA_VINT *r, DECORA_VINT *g, DECORA_VINT *b, DECORA_VINT *a)
+{
+    jint pixels[DECORA_VFLOAT::LANES];
+    for (int i = 0; i < DECORA_VFLOAT::LANES; i++) {
+        pixels[i] = (bits & (1 << i)) ? img[offsets[i]] : 0;
+    }
+    DECORA_VINT p = DECORA_VINT::load(pixels);
+    *r = (p >> 16) & 0xff;
+    *g = (p >>  8) & 0xff;
+    *b = p & 0xff;
+    *a = (p >> 24) & 0xff;
+}
+
+/*
+ * The nearest pixel sample of a sampler, as the generated scalar code
+ * takes it.
+ */
+static inline void vsample(const jint *img,
+                           DECORA_VFLOAT floc_x, DECORA_VFLOAT floc_y,
+                           jint w, jint h, jint scan,
+                           DECORA_VFLOAT *vals)
+{
+    DECORA_VINT iloc_x = vtrunc(floc_x * (float) w);
+    DECORA_VINT iloc_y = vtrunc(floc_y * (float) h);
+    // the scalar code reads out of bounds for locations too large for
+    // an int, where these lanes are left out instead
+    int bits = laneBits(floc_x >= 0.f && floc_y >= 0.f &&
+                        iloc_x >= 0 && iloc_y >= 0 &&
+                        iloc_x < w && iloc_y < h);
+    jint ix[DECORA_VFLOAT::LANES];
+    jint iy[DECORA_VFLOAT::LANES];
+    jint offsets[DECORA_VFLOAT::LANES];
+    iloc_x.store(ix);
+    iloc_y.store(iy);
+    for (int i = 0; i < DECORA_VFLOAT::LANES; i++) {
+        offsets[i] = (bits & (1 << i)) ? iy[i] * scan + ix[i] : 0;
+    }
+    DECORA_VINT r(0), g(0), b(0), a(0);
+    vpixels(img, offsets, bits, &r, &g, &b, &a);
+    vals[FVAL_R] = vfloat(r) / 255.f;
+    vals[FVAL_G] = vfloat(g) / 255.f;
+    vals[FVAL_B] = vfloat(b) / 255.f;
+    vals[FVAL_A] = vfloat(a) / 255.f;
+}
+
+/*
+ * Adds the pixels of the lanes set in bits, at offset from the offsets,
+ * weighted by mul as laccum() does in SSEUtils.cc. The other lanes add 0.
+ */
+static inline void vlaccum(const jint *img, const jint *offsets, jint offset, int bits,
+                           DECORA_VMASK m, DECORA_VFLOAT mul, DECORA_VFLOAT *vals)
+{
+    jint tap[DECORA_VFLOAT::LANES];
+    for (int i = 0; i < DECORA_VFLOAT::LANES; i++) {
+        tap[i] = offsets[i] + offset;
+    }
+    DECORA_VINT r(0), g(0), b(0), a(0);
+    vpixels(img, tap, bits, &r, &g, &b, &a);
+    mul = vselect(m, mul / 255.f, 0.f);
+    vals[FVAL_R] += vfloat(r) * mul;
+    vals[FVAL_G] += vfloat(g) * mul;
+    vals[FVAL_B] += vfloat(b) * mul;
+    vals[FVAL_A] += vfloat(a) * mul;
+}
+
+/*
+ * The bilinear sample of an lsampler, as lsample() in SSEUtils.cc takes
+ * it. Leaving a corner out and adding 0 for it give the same sums, as
+ * they never hold -0.0.
+ */
+static inline void vlsample(const jint *img,
+                            DECORA_VFLOAT floc_x, DECORA_VFLOAT floc_y,
+                            jint w, jint h, jint scan,
+                            DECORA_VFLOAT *vals)
+{
+    vals[0] = vals[1] = vals[2] = vals[3] = 0.f;
+    floc_x = floc_x * (float) w + 0.5f;
+    floc_y = floc_y * (float) h + 0.5f;
+    DECORA_VINT iloc_x = vtrunc(floc_x);
+    DECORA_VINT iloc_y = vtrunc(floc_y);
+    DECORA_VMASK in = floc_x > 0.f && floc_y > 0.f && iloc_x <= w && iloc_y <= h;
+    if (!any(in)) {
+        return;
+    }
+    floc_x -= vfloat(iloc_x);
+    floc_y -= vfloat(iloc_y);
+    jint ix[DECORA_VFLOAT::LANES];
+    jint iy[DECORA_VFLOAT::LANES];
+    jint offsets[DECORA_VFLOAT::LANES];
+    iloc_x.store(ix);
+    iloc_y.store(iy);
+    int bits = laneBits(in);
+    for (int i = 0; i < DECORA_VFLOAT::LANES; i++) {
+        offsets[i] = (bits & (1 << i)) ? iy[i] * scan + ix[i] : 0;
+    }
+    DECORA_VFLOAT fract = floc_x * floc_y;
+    DECORA_VMASK m = in && iloc_y < h && iloc_x < w;
+    vlaccum(img, offsets, 0, laneBits(m), m, fract, vals);
+    m = in && iloc_y < h && iloc_x > 0;
+    vlaccum(img, offsets, -1, laneBits(m), m, floc_y - fract, vals);
+    m = in && iloc_y > 0 && iloc_x < w;
+    vlaccum(img, offsets, -scan, laneBits(m), m, floc_x - fract, vals);
+    m = in && iloc_y > 0 && iloc_x > 0;
+    vlaccum(img, offsets, -scan-1, laneBits(m), m, 1.f - floc_x - floc_y + fract, vals);
+}
+
+/*
+ * Adds the map values of the lanes set in bits, at offset from the
+ * offsets, weighted by fract as faccum() does in SSEUtils.cc.
+ */
+static inline void vfaccum(const jfloat *map, const jint *offsets, jint offset, int bits,
+                           DECORA_VMASK m, DECORA_VFLOAT fract, DECORA_VFLOAT *vals)
+{
+    float values[4][DECORA_VFLOAT::LANES];
+    for (int i = 0; i < DECORA_VFLOAT::LANES; i++) {
+        const jfloat *v = map + offsets[i] + offset;
+        bool set = (bits & (1 << i)) != 0;
+        for (int c = 0; c < 4; c++) {
+            values[c][i] = set ? v[c] : 0.f;
+        }
+    }
+    fract = vselect(m, fract, 0.f);
+    for (int c = 0; c < 4; c++) {
+        vals[c] += DECORA_VFLOAT::load(values[c]) * fract;
+    }
+}
+
+/*
+ * The bilinear sample of an fsampler, as fsample() in SSEUtils.cc takes
+ * it.
+ */
+static inline void vfsample(const jfloat *map,
+                            DECORA_VFLOAT floc_x, DECORA_VFLOAT floc_y,
+                            jint w, jint h, jint scan,
+                            DECORA_VFLOAT *vals)
+{
+    vals[0] = vals[1] = vals[2] = vals[3] = 0.f;
+    floc_x = floc_x * (float) w + 0.5f;
+    floc_y = floc_y * (float) h + 0.5f;
+    DECORA_VINT iloc_x = vtrunc(floc_x);
+    DECORA_VINT iloc_y = vtrunc(floc_y);
+    DECORA_VMASK in = floc_x > 0.f && floc_y > 0.f && iloc_x <= w && iloc_y <= h;
+    if (!any(in)) {
+        return;
+    }
+    floc_x -= vfloat(iloc_x);
+    floc_y -= vfloat(iloc_y);
+    jint ix[DECORA_VFLOAT::LANES];
+    jint iy[DECORA_VFLOAT::LANES];
+    jint offsets[DECORA_VFLOAT::LANES];
+    iloc_x.store(ix);
+    iloc_y.store(iy);
+    int bits = laneBits(in);
+    for (int i = 0; i < DECORA_VFLOAT::LANES; i++) {
+        offsets[i] = (bits & (1 << i)) ? 4*(iy[i] * scan + ix[i]) : 0;
+    }
+    DECORA_VFLOAT fract = floc_x * floc_y;
+    DECORA_VMASK m = in && iloc_y < h && iloc_x < w;
+    vfaccum(map, offsets, 0, laneBits(m), m, fract, vals);
+    m = in && iloc_y < h && iloc_x > 0;
+    vfaccum(map, offsets, -4, laneBits(m), m, floc_y - fract, vals);
+    m = in && iloc_y > 0 && iloc_x < w;
+    vfaccum(map, offsets, -scan*4, laneBits(m), m, floc_x - fract, vals);
+    m = in && iloc_y > 0 && iloc_x > 0;
+    vfaccum(map, offsets, -scan*4-4, laneBits(m), m, 1.f - floc_x - floc_y + fract, vals);
+}
+
+/*
+ * Clamps the colors of the lanes and stores them as premultiplied ARGB
+ * pixels at dst[0] to dst[DECORA_VFLOAT::LANES - 1], as the scalar loops
+ * of the generated peers do for one pixel.
+ */
+static inline void vstoreColor(jint *dst,
+                               DECORA_VFLOAT color_x, DECORA_VFLOAT color_y,
+                               DECORA_VFLOAT color_z, DECORA_VFLOAT color_w)
+{
+    color_w = vselect(color_w < 0.f, 0.f, vselect(color_w > 1.f, 1.f, color_w));
+    color_x = vselect(color_x < 0.f, 0.f, vselect(color_x > color_w, color_w, color_x));
+    color_y = vselect(color_y < 0.f, 0.f, vselect(color_y > color_w, color_w, color_y));
+    color_z = vselect(color_z < 0.f, 0.f, vselect(color_z > color_w, color_w, color_z));
+    DECORA_VINT pixels =
+        (vtrunc(color_x * 255.f) << 16) |
+        (vtrunc(color_y * 255.f) <<  8) |
+        (vtrunc(color_z * 255.f) <<  0) |
+        (vtrunc(color_w * 255.f) << 24);
+    pixels.store(dst);
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -32,9 +32,11 @@
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <sys/mman.h>
+#include <dirent.h>
 #include <fcntl.h>
 #include <unistd.h>
 #include <limits.h>
+#include <stdint.h>
 
 #include <dlfcn.h>
 #include <fontconfig/fontconfig.h>
@@ -546,18 +548,272 @@ Java_com_sun_javafx_font_FontConfigManager_getFontConfig
 }
 
 
-JNIEXPORT jboolean JNICALL
-Java_com_sun_javafx_font_FontConfigManager_populateMapsNative
-(JNIEnv *env, jclass obj,
- jobject fontToFileMap,
- jobject fontToFamilyNameMap,
- jobject familyToFontListMap,
- jobject locale
- )
-{
-    void *libfontconfig;
-    const char *lang;
-    int langLen, f;
+/*
+ * The fonts populateMapsNative() reports are kept in a table of
+ * "file\0family\0fullname\0" records. The table can be saved to a cache
+ * file and mapped back in on the next start, which skips FcFontList()
+ * and resolving the real path of every font file.
+ *
+ * The cache is keyed by the fontconfig version and the modification
+ * times of the fontconfig configuration and cache locations. fontconfig
+ * writes a new cache file whenever it rescans a changed font directory,
+ * and getFontConfig() runs fontconfig on every start anyway, so a stale
+ * table is noticed no later than the following start.
+ */
+typedef struct {
+    char *data;
+    size_t size;
+    size_t capacity;
+    unsigned int count;
+} FontTable;
+
+#define FONT_CACHE_MAGIC "JFXFCT1"
+
+typedef struct {
+    char magic[8];
+    uint32_t count;
+    uint32_t size;
+    uint64_t key;
+} FontCacheHeader;
+
+static int appendFontTable(FontTable *table, const char *file,
+                           const char *family, const char *fullName) {
+    size_t fileLen = strlen(file) + 1;
+    size_t familyLen = strlen(family) + 1;
+    size_t fullNameLen = strlen(fullName) + 1;
+    size_t needed = table->size + fileLen + familyLen + fullNameLen;
+    if (needed > UINT32_MAX) {
+        return 0;
+    }
+    if (needed > table->capacity) {
+        size_t capacity = table->capacity ? table->capacity * 2 : 16 * 1024;
+        while (capacity < needed) {
+            capacity *= 2;
+        }
+        char *data = (char*)realloc(table->data, capacity);
+        if (data == NULL) {
+            return 0;
+        }
+        table->data = data;
+        table->capacity = capacity;
+    }
+    memcpy(table->data + table->size, file, fileLen);
+    table->size += fileLen;
+    memcpy(table->data + table->size, family, familyLen);
+    table->size += familyLen;
+    memcpy(table->data + table->size, fullName, fullNameLen);
+    table->size += fullNameLen;
+    table->count++;
+    return 1;
+}
+
+static uint64_t hashBytes(uint64_t hash, const void *bytes, size_t len) {
+    const unsigned char *p = (const unsigned char*)bytes;
+    size_t i;
+    for (i = 0; i < len; i++) {
+        hash = (hash ^ p[i]) * 1099511628211ULL;
+    }
+    return hash;
+}
+
+static uint64_t hashPathStat(uint64_t hash, const char *dir, const char *name) {
+    char path[PATH_MAX];
+    struct stat st;
+    if (dir == NULL || dir[0] == '\0') {
+        return hash;
+    }
+    if (snprintf(path, sizeof(path), "%s%s", dir, name) >= (int)sizeof(path)) {
+        return hash;
+    }
+    hash = hashBytes(hash, path, strlen(path) + 1);
+    if (stat(path, &st) == 0) {
+        int64_t values[4];
+        values[0] = (int64_t)st.st_mtim.tv_sec;
+        values[1] = (int64_t)st.st_mtim.tv_nsec;
+        values[2] = (int64_t)st.st_size;
+        values[3] = (int64_t)st.st_ino;
+        hash = hashBytes(hash, values, sizeof(values));
+    }
+    return hash;
+}
+
+/*
+ * A font added below the top of a font directory only changes the mtime
+ * of the subdirectory it is added to, so font directories are hashed with
+ * all their subdirectories, as fontconfig checks its own caches.
+ */
+#define FONT_DIR_MAX_DEPTH 8
+
+static uint64_t hashDirTree(uint64_t hash, const char *path, int depth) {
+    DIR *dir;
+    struct dirent *entry;
+    hash = hashPathStat(hash, path, "");
+    if (depth >= FONT_DIR_MAX_DEPTH || (dir = opendir(path)) == NULL) {
+        return hash;
+    }
+    while ((entry = readdir(dir)) != NULL) {
+        char sub[PATH_MAX];
+        struct stat st;
+        if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0) {
+            continue;
+        }
+        if (entry->d_type != DT_DIR && entry->d_type != DT_LNK &&
+            entry->d_type != DT_UNKNOWN) {
+            continue;
+        }
+        if (snprintf(sub, sizeof(sub), "%s/%s", path, entry->d_name) >= (int)sizeof(sub)) {
+            continue;
+        }
+        if (entry->d_type != DT_DIR && (stat(sub, &st) != 0 || !S_ISDIR(st.st_mode))) {
+            continue;
+        }
+        hash = hashDirTree(hash, sub, depth + 1);
+    }
+    closedir(dir);
+    return hash;
+}
+
+static uint64_t hashFontDir(uint64_t hash, const char *dir, const char *name) {
+    char path[PATH_MAX];
+    if (dir == NULL || dir[0] == '\0') {
+        return hash;
+    }
+    if (snprintf(path, sizeof(path), "%s%s", dir, name) >= (int)sizeof(path)) {
+        return hash;
+    }
+    return hashDirTree(hash, path, 0);
+}
+
+typedef int (*FcGetVersionFuncType)();
+
+static uint64_t fontCacheKey(void *libfontconfig) {
+    FcGetVersionFuncType FcGetVersion =
+        (FcGetVersionFuncType)dlsym(libfontconfig, "FcGetVersion");
+    const char *home = getenv("HOME");
+    const char *xdgConfig = getenv("XDG_CONFIG_HOME");
+    const char *xdgCache = getenv("XDG_CACHE_HOME");
+    const char *xdgData = getenv("XDG_DATA_HOME");
+    int version = FcGetVersion != NULL ? (*FcGetVersion)() : 0;
+    uint64_t hash = 14695981039346656037ULL;
+
+    hash = hashBytes(hash, &version, sizeof(version));
+    hash = hashPathStat(hash, getenv("FONTCONFIG_FILE"), "");
+    hash = hashPathStat(hash, getenv("FONTCONFIG_PATH"), "");
+    hash = hashPathStat(hash, "/etc/fonts/fonts.conf", "");
+    hash = hashPathStat(hash, "/etc/fonts/local.conf", "");
+    hash = hashPathStat(hash, "/etc/fonts/conf.d", "");
+    hash = hashPathStat(hash, "/var/cache/fontconfig", "");
+    hash = hashPathStat(hash, "/usr/lib/fontconfig/cache", "");
+    hash = hashFontDir(hash, "/usr/share/fonts", "");
+    hash = hashFontDir(hash, "/usr/local/share/fonts", "");
+    if (xdgConfig != NULL && xdgConfig[0] != '\0') {
+        hash = hashPathStat(hash, xdgConfig, "/fontconfig");
+        hash = hashPathStat(hash, xdgConfig, "/fontconfig/fonts.conf");
+        hash = hashPathStat(hash, xdgConfig, "/fontconfig/conf.d");
+    } else {
+        hash = hashPathStat(hash, home, "/.config/fontconfig");
+        hash = hashPathStat(hash, home, "/.config/fontconfig/fonts.conf");
+        hash = hashPathStat(hash, home, "/.config/fontconfig/conf.d");
+    }
+    if (xdgCache != NULL && xdgCache[0] != '\0') {
+        hash = hashPathStat(hash, xdgCache, "/fontconfig");
+    } else {
+        hash = hashPathStat(hash, home, "/.cache/fontconfig");
+    }
+    if (xdgData != NULL && xdgData[0] != '\0') {
+        hash = hashFontDir(hash, xdgData, "/fonts");
+    } else {
+        hash = hashFontDir(hash, home, "/.local/share/fonts");
+    }
+    hash = hashFontDir(hash, home, "/.fonts");
+    hash = hashPathStat(hash, home, "/.fonts.conf");
+    hash = hashPathStat(hash, home, "/.fontconfig");
+    return hash;
+}
+
+/*
+ * Maps the cache file and points table at its records. On success the
+ * caller must munmap() *map, *mapSize bytes once done with the table.
+ */
+static int readFontCache(const char *cacheFile, uint64_t key, FontTable *table,
+                         void **map, size_t *mapSize) {
+    struct stat st;
+    int fd = open(cacheFile, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return 0;
+    }
+    if (fstat(fd, &st) != 0 || st.st_size < (off_t)sizeof(FontCacheHeader)) {
+        close(fd);
+        return 0;
+    }
+    void *addr = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (addr == MAP_FAILED) {
+        return 0;
+    }
+
+    const FontCacheHeader *header = (const FontCacheHeader*)addr;
+    char *data = (char*)addr + sizeof(FontCacheHeader);
+    size_t size = (size_t)st.st_size - sizeof(FontCacheHeader);
+    if (memcmp(header->magic, FONT_CACHE_MAGIC, sizeof(header->magic)) != 0 ||
+        header->key != key ||
+        header->size != size ||
+        (size > 0 && data[size - 1] != '\0'))
+    {
+        munmap(addr, (size_t)st.st_size);
+        return 0;
+    }
+
+    /* Every record must be three strings within the mapped data */
+    size_t offset = 0;
+    unsigned int strings = 0;
+    while (offset < size) {
+        offset += strlen(data + offset) + 1;
+        strings++;
+    }
+    if (strings != 3 * header->count) {
+        munmap(addr, (size_t)st.st_size);
+        return 0;
+    }
+
+    table->data = data;
+    table->size = size;
+    table->capacity = 0;
+    table->count = header->count;
+    *map = addr;
+    *mapSize = (size_t)st.st_size;
+    return 1;
+}
+
+/* Writes to a temporary file first so readers never see a partial cache */
+static void writeFontCache(const char *cacheFile, uint64_t key,
+                           const FontTable *table) {
+    char tmpFile[PATH_MAX];
+    FontCacheHeader header;
+    int ok;
+
+    if (snprintf(tmpFile, sizeof(tmpFile), "%s.%d",
+                 cacheFile, (int)getpid()) >= (int)sizeof(tmpFile)) {
+        return;
+    }
+    int fd = open(tmpFile, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        return;
+    }
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, FONT_CACHE_MAGIC, sizeof(header.magic));
+    header.count = table->count;
+    header.size = (uint32_t)table->size;
+    header.key = key;
+    ok = write(fd, &header, sizeof(header)) == (ssize_t)sizeof(header) &&
+         write(fd, table->data, table->size) == (ssize_t)table->size;
+    ok = (close(fd) == 0) && ok;
+    if (!ok || rename(tmpFile, cacheFile) != 0) {
+        unlink(tmpFile);
+    }
+}
+
+static int listFonts(void *libfontconfig, FontTable *table, jboolean debugFC) {
     FcPatternBuildFuncType FcPatternBuild;
     FcObjectSetFuncType FcObjectSetBuild;
     FcFontListFuncType FcFontList;
@@ -566,28 +822,7 @@ Java_com_sun_javafx_font_FontConfigManager_populateMapsNative
     FcPattern *pattern;
     FcObjectSet *objset;
     FcFontSet *fontSet;
-    jclass classID, arrayListClass;
-    jmethodID arrayListCtr, addMID, getMID;
-    jmethodID toLowerCaseMID;
-    jmethodID putMID, containsKeyMID;
-    jboolean debugFC = getenv("PRISM_FONTCONFIG_DEBUG") != NULL;
-
-    if (fontToFileMap == NULL ||
-        fontToFamilyNameMap == NULL ||
-        familyToFontListMap == NULL ||
-        locale == NULL)
-    {
-        if (debugFC) {
-            fprintf(stderr, "Null arg to native fontconfig lookup");
-        }
-        return JNI_FALSE;
-    }
-    if ((libfontconfig = openFontConfig()) == NULL) {
-        if (debugFC) {
-            fprintf(stderr,"Could not open libfontconfig\n");
-        }
-        return JNI_FALSE;
-    }
+    int f;
 
     FcPatternBuild     =
         (FcPatternBuildFuncType)dlsym(libfontconfig, "FcPatternBuild");
@@ -608,62 +843,9 @@ Java_com_sun_javafx_font_FontConfigManager_populateMapsNative
         if (debugFC) {
            fprintf(stderr,"Could not find symbols in libfontconfig\n");
         }
-        closeFontConfig(libfontconfig, JNI_FALSE);
-        return JNI_FALSE;
+        return 0;
     }
 
-    // Deleting local refs as we go along so this should be plenty
-    // Unlikely to matter even if it fails.
-    (*env)->EnsureLocalCapacity(env, 64);
-    if ((*env)->ExceptionOccurred(env)) {
-        return JNI_FALSE;
-    }
-    classID = (*env)->FindClass(env, "java/util/HashMap");
-    if ((*env)->ExceptionOccurred(env) || classID == NULL) {
-        return JNI_FALSE;
-    }
-    getMID = (*env)->GetMethodID(env, classID, "get",
-                 "(Ljava/lang/Object;)Ljava/lang/Object;");
-    if ((*env)->ExceptionOccurred(env) || getMID == NULL) {
-        return JNI_FALSE;
-    }
-    putMID = (*env)->GetMethodID(env, classID, "put",
-                 "(Ljava/lang/Object;Ljava/lang/Object;)Ljava/lang/Object;");
-    if ((*env)->ExceptionOccurred(env) || putMID == NULL) {
-        return JNI_FALSE;
-    }
-
-    containsKeyMID = (*env)->GetMethodID(env, classID, "containsKey",
-                                             "(Ljava/lang/Object;)Z");
-    if ((*env)->ExceptionOccurred(env) || containsKeyMID == NULL) {
-        return JNI_FALSE;
-    }
-
-    arrayListClass = (*env)->FindClass(env, "java/util/ArrayList");
-    if ((*env)->ExceptionOccurred(env) || arrayListClass == NULL) {
-        return JNI_FALSE;
-    }
-    arrayListCtr = (*env)->GetMethodID(env, arrayListClass,
-                                              "<init>", "(I)V");
-    if ((*env)->ExceptionOccurred(env) || arrayListCtr == NULL) {
-        return JNI_FALSE;
-    }
-    addMID = (*env)->GetMethodID(env, arrayListClass,
-                                 "add", "(Ljava/lang/Object;)Z");
-    if ((*env)->ExceptionOccurred(env) || addMID == NULL) {
-        return JNI_FALSE;
-    }
-
-    classID = (*env)->FindClass(env, "java/lang/String");
-    if ((*env)->ExceptionOccurred(env) || classID == NULL) {
-        return JNI_FALSE;
-    }
-    toLowerCaseMID =
-        (*env)->GetMethodID(env, classID, "toLowerCase",
-                            "(Ljava/util/Locale;)Ljava/lang/String;");
-    if ((*env)->ExceptionOccurred(env) || toLowerCaseMID == NULL) {
-        return JNI_FALSE;
-    }
     pattern = (*FcPatternBuild)(NULL, FC_OUTLINE, FcTypeBool, FcTrue, NULL);
     objset = (*FcObjectSetBuild)(FC_FAMILY, FC_FAMILYLANG,
                                  FC_FULLNAME, FC_FULLNAMELANG,
@@ -685,12 +867,8 @@ Java_com_sun_javafx_font_FontConfigManager_populateMapsNative
         FcChar8 *fullNameEN = NULL;
         FcChar8 *fullNameLang = NULL;
         FcChar8 *file;
-        FcResult res;
-        jstring jFileStr;
-        jstring jFamilyStr, jFamilyStrLC;
-        jstring jFullNameStr, jFullNameStrLC;
-        jobject jList;
         FcChar8 *format = NULL;
+        char pathname[PATH_MAX+1];
 
         /* We only want TrueType & OpenType fonts for Java FX */
         format = NULL;
@@ -706,7 +884,6 @@ Java_com_sun_javafx_font_FontConfigManager_populateMapsNative
         if ((*FcPatternGetString)(fp, FC_FILE, 0, &file) != FcResultMatch) {
             continue;
         } else {
-            char pathname[PATH_MAX+1];
             char* path = realpath((char*)file, pathname);
             if (path == NULL) {
                 continue;
@@ -767,9 +944,151 @@ Java_com_sun_javafx_font_FontConfigManager_populateMapsNative
             continue;
         }
 
-        jFileStr = (*env)->NewStringUTF(env, (const char*)file);
-        jFamilyStr = (*env)->NewStringUTF(env, (const char*)familyEN);
-        jFullNameStr = (*env)->NewStringUTF(env, (const char*)fullNameEN);
+        if (!appendFontTable(table, (const char*)file,
+                             (const char*)familyEN, (const char*)fullNameEN)) {
+            (*FcFontSetDestroy)(fontSet);
+            return 0;
+        }
+    }
+    (*FcFontSetDestroy)(fontSet);
+    return 1;
+}
+
+JNIEXPORT jboolean JNICALL
+Java_com_sun_javafx_font_FontConfigManager_populateMapsNative
+(JNIEnv *env, jclass obj,
+ jobject fontToFileMap,
+ jobject fontToFamilyNameMap,
+ jobject familyToFontListMap,
+ jobject locale,
+ jstring cacheFileStr
+ )
+{
+    void *libfontconfig;
+    const char *cacheFile = NULL;
+    FontTable table = { NULL, 0, 0, 0 };
+    void *cacheMap = NULL;
+    size_t cacheMapSize = 0;
+    uint64_t cacheKey = 0;
+    const char *record;
+    unsigned int f;
+    jclass classID, arrayListClass;
+    jmethodID arrayListCtr, addMID, getMID;
+    jmethodID toLowerCaseMID;
+    jmethodID putMID, containsKeyMID;
+    jboolean debugFC = getenv("PRISM_FONTCONFIG_DEBUG") != NULL;
+    jboolean rc = JNI_FALSE;
+
+    if (fontToFileMap == NULL ||
+        fontToFamilyNameMap == NULL ||
+        familyToFontListMap == NULL ||
+        locale == NULL)
+    {
+        if (debugFC) {
+            fprintf(stderr, "Null arg to native fontconfig lookup");
+        }
+        return JNI_FALSE;
+    }
+
+    // Deleting local refs as we go along so this should be plenty
+    // Unlikely to matter even if it fails.
+    (*env)->EnsureLocalCapacity(env, 64);
+    if ((*env)->ExceptionOccurred(env)) {
+        return JNI_FALSE;
+    }
+    classID = (*env)->FindClass(env, "java/util/HashMap");
+    if ((*env)->ExceptionOccurred(env) || classID == NULL) {
+        return JNI_FALSE;
+    }
+    getMID = (*env)->GetMethodID(env, classID, "get",
+                 "(Ljava/lang/Object;)Ljava/lang/Object;");
+    if ((*env)->ExceptionOccurred(env) || getMID == NULL) {
+        return JNI_FALSE;
+    }
+    putMID = (*env)->GetMethodID(env, classID, "put",
+                 "(Ljava/lang/Object;Ljava/lang/Object;)Ljava/lang/Object;");
+    if ((*env)->ExceptionOccurred(env) || putMID == NULL) {
+        return JNI_FALSE;
+    }
+
+    containsKeyMID = (*env)->GetMethodID(env, classID, "containsKey",
+                                             "(Ljava/lang/Object;)Z");
+    if ((*env)->ExceptionOccurred(env) || containsKeyMID == NULL) {
+        return JNI_FALSE;
+    }
+
+    arrayListClass = (*env)->FindClass(env, "java/util/ArrayList");
+    if ((*env)->ExceptionOccurred(env) || arrayListClass == NULL) {
+        return JNI_FALSE;
+    }
+    arrayListCtr = (*env)->GetMethodID(env, arrayListClass,
+                                              "<init>", "(I)V");
+    if ((*env)->ExceptionOccurred(env) || arrayListCtr == NULL) {
+        return JNI_FALSE;
+    }
+    addMID = (*env)->GetMethodID(env, arrayListClass,
+                                 "add", "(Ljava/lang/Object;)Z");
+    if ((*env)->ExceptionOccurred(env) || addMID == NULL) {
+        return JNI_FALSE;
+    }
+
+    classID = (*env)->FindClass(env, "java/lang/String");
+    if ((*env)->ExceptionOccurred(env) || classID == NULL) {
+        return JNI_FALSE;
+    }
+    toLowerCaseMID =
+        (*env)->GetMethodID(env, classID, "toLowerCase",
+                            "(Ljava/util/Locale;)Ljava/lang/String;");
+    if ((*env)->ExceptionOccurred(env) || toLowerCaseMID == NULL) {
+        return JNI_FALSE;
+    }
+
+    if ((libfontconfig = openFontConfig()) == NULL) {
+        if (debugFC) {
+            fprintf(stderr,"Could not open libfontconfig\n");
+        }
+        return JNI_FALSE;
+    }
+
+    if (cacheFileStr != NULL) {
+        cacheFile = (*env)->GetStringUTFChars(env, cacheFileStr, NULL);
+    }
+    if (cacheFile != NULL) {
+        cacheKey = fontCacheKey(libfontconfig);
+        if (readFontCache(cacheFile, cacheKey, &table,
+                          &cacheMap, &cacheMapSize)) {
+            if (debugFC) {
+                fprintf(stderr,"Read %u fonts from %s\n", table.count, cacheFile);
+            }
+        }
+    }
+    if (cacheMap == NULL) {
+        if (!listFonts(libfontconfig, &table, debugFC)) {
+            goto done;
+        }
+        if (cacheFile != NULL) {
+            writeFontCache(cacheFile, cacheKey, &table);
+            if (debugFC) {
+                fprintf(stderr,"Wrote %u fonts to %s\n", table.count, cacheFile);
+            }
+        }
+    }
+
+    record = table.data;
+    for (f = 0; f < table.count; f++) {
+        const char *file = record;
+        const char *familyEN = file + strlen(file) + 1;
+        const char *fullNameEN = familyEN + strlen(familyEN) + 1;
+        jstring jFileStr;
+        jstring jFamilyStr, jFamilyStrLC;
+        jstring jFullNameStr, jFullNameStrLC;
+        jobject jList;
+
+        record = fullNameEN + strlen(fullNameEN) + 1;
+
+        jFileStr = (*env)->NewStringUTF(env, file);
+        jFamilyStr = (*env)->NewStringUTF(env, familyEN);
+        jFullNameStr = (*env)->NewStringUTF(env, fullNameEN);
 
         if (jFileStr == NULL || jFamilyStr == NULL || jFullNameStr == NULL) {
             if (debugFC) {
@@ -781,12 +1100,12 @@ Java_com_sun_javafx_font_FontConfigManager_populateMapsNative
         jFamilyStrLC = (*env)->CallObjectMethod(env, jFamilyStr,
                                                 toLowerCaseMID, locale);
         if ((*env)->ExceptionOccurred(env)) {
-            return JNI_FALSE;
+            goto done;
         }
         jFullNameStrLC = (*env)->CallObjectMethod(env, jFullNameStr,
                                                   toLowerCaseMID, locale);
         if ((*env)->ExceptionOccurred(env)) {
-            return JNI_FALSE;
+            goto done;
         }
         if (jFamilyStrLC == NULL || jFullNameStrLC == NULL) {
             if (debugFC) {
@@ -799,27 +1118,27 @@ Java_com_sun_javafx_font_FontConfigManager_populateMapsNative
         (*env)->CallObjectMethod(env, fontToFileMap, putMID,
                                  jFullNameStrLC, jFileStr);
         if ((*env)->ExceptionOccurred(env)) {
-            return JNI_FALSE;
+            goto done;
         }
         (*env)->CallObjectMethod(env, fontToFamilyNameMap, putMID,
                                  jFullNameStrLC, jFamilyStr);
         if ((*env)->ExceptionOccurred(env)) {
-            return JNI_FALSE;
+            goto done;
         }
         jList = (*env)->CallObjectMethod(env, familyToFontListMap,
                                          getMID, jFamilyStrLC);
         if ((*env)->ExceptionOccurred(env)) {
-            return JNI_FALSE;
+            goto done;
         }
         if (jList == NULL) {
             jList = (*env)->NewObject(env, arrayListClass, arrayListCtr, 4);
             if ((*env)->ExceptionOccurred(env)) {
-                return JNI_FALSE;
+                goto done;
             }
             (*env)->CallObjectMethod(env, familyToFontListMap,
                                      putMID, jFamilyStrLC, jList);
             if ((*env)->ExceptionOccurred(env)) {
-                return JNI_FALSE;
+                goto done;
             }
         }
         if (jList == NULL) {
@@ -831,7 +1150,7 @@ Java_com_sun_javafx_font_FontConfigManager_populateMapsNative
         }
         (*env)->CallObjectMethod(env, jList, addMID, jFullNameStr);
         if ((*env)->ExceptionOccurred(env)) {
-            return JNI_FALSE;
+            goto done;
         }
         /* Now referenced from the passed in maps, so can delete local refs. */
         (*env)->DeleteLocalRef(env, jFileStr);
@@ -846,10 +1165,20 @@ Java_com_sun_javafx_font_FontConfigManager_populateMapsNative
         fprintf(stderr,"Done enumerating fontconfig fonts\n");
         fflush(stderr);
     }
-    (*FcFontSetDestroy)(fontSet);
-    closeFontConfig(libfontconfig, JNI_TRUE);
+    rc = JNI_TRUE;
 
-    return JNI_TRUE;
+done:
+    if (cacheMap != NULL) {
+        munmap(cacheMap, cacheMapSize);
+    } else {
+        free(table.data);
+    }
+    if (cacheFile != NULL) {
+        (*env)->ReleaseStringUTFChars(env, cacheFileStr, cacheFile);
+    }
+    closeFontConfig(libfontconfig, rc);
+
+    return rc;
 }
 
 
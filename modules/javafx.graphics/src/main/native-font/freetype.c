@@ -31,6 +31,9 @@
 #include <dlfcn.h>
 #include <ft2build.h>
 #include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
 #include <errno.h>
 #include FT_FREETYPE_H
 #include FT_OUTLINE_H
@@ -38,6 +41,18 @@
 
 #define OS_NATIVE(func) Java_com_sun_javafx_font_freetype_OSFreetype_##func
 
+#define GLYPH_ERROR          com_sun_javafx_font_freetype_OSFreetype_GLYPH_ERROR
+#define GLYPH_PIXEL_MODE     com_sun_javafx_font_freetype_OSFreetype_GLYPH_PIXEL_MODE
+#define GLYPH_WIDTH          com_sun_javafx_font_freetype_OSFreetype_GLYPH_WIDTH
+#define GLYPH_ROWS           com_sun_javafx_font_freetype_OSFreetype_GLYPH_ROWS
+#define GLYPH_LEFT           com_sun_javafx_font_freetype_OSFreetype_GLYPH_LEFT
+#define GLYPH_TOP            com_sun_javafx_font_freetype_OSFreetype_GLYPH_TOP
+#define GLYPH_ADVANCE_X      com_sun_javafx_font_freetype_OSFreetype_GLYPH_ADVANCE_X
+#define GLYPH_ADVANCE_Y      com_sun_javafx_font_freetype_OSFreetype_GLYPH_ADVANCE_Y
+#define GLYPH_LINEAR_ADVANCE com_sun_javafx_font_freetype_OSFreetype_GLYPH_LINEAR_ADVANCE
+#define GLYPH_OFFSET         com_sun_javafx_font_freetype_OSFreetype_GLYPH_OFFSET
+#define GLYPH_METRICS_SIZE   com_sun_javafx_font_freetype_OSFreetype_GLYPH_METRICS_SIZE
+
 #define SAFE_FREE(PTR)  \
     if ((PTR) != NULL) {  \
         free(PTR);     \
@@ -374,27 +389,93 @@ JNIEXPORT jobject JNICALL OS_NATIVE(getGlyphSlot)(JNIEnv *env, jclass that, jlon
     return result;
 }
 
-JNIEXPORT jbyteArray JNICALL OS_NATIVE(getBitmapData)(JNIEnv *env, jclass that, jlong facePtr)
+/*
+ * Loads and renders count glyphs with the given size, transform and load
+ * flags. The bitmaps are packed one after another into the direct buffer
+ * atlas, each glyph width * rows bytes with no row padding, and the packed
+ * metrics of each glyph are stored in metrics (see OSFreetype). Returns
+ * the number of glyphs processed, which is less than count if the next
+ * bitmap does not fit in the atlas; its metrics are still filled in so
+ * the caller can tell how much room it needs.
+ * FT_Load_Glyph may read the font file and allocate, so the arrays are
+ * copied rather than held in a critical region while glyphs are loaded.
+ */
+JNIEXPORT jint JNICALL OS_NATIVE(renderGlyphs)
+    (JNIEnv *env, jclass that, jlong facePtr, jlong size, jobject matrixObj,
+     jint flags, jintArray glyphCodes, jint count, jobject atlas, jintArray metrics)
 {
-    if (!facePtr) return NULL;
+    if (!facePtr || !glyphCodes || !atlas || !metrics || count <= 0) return 0;
+    if ((*env)->GetArrayLength(env, glyphCodes) < count) return 0;
+    if ((*env)->GetArrayLength(env, metrics) / GLYPH_METRICS_SIZE < count) return 0;
+    unsigned char *dst = (*env)->GetDirectBufferAddress(env, atlas);
+    jlong capacity = (*env)->GetDirectBufferCapacity(env, atlas);
+    if (!dst || capacity < 0) return 0;
+
     FT_Face face = (FT_Face)facePtr;
-    FT_GlyphSlot slot = face->glyph;
-    if (!slot) return NULL;
-    FT_Bitmap bitmap = slot->bitmap;
-    unsigned char* src = bitmap.buffer;
-    if (!src) return NULL;
-    if (bitmap.pitch <= 0) return NULL;
-    if (bitmap.rows > INT_MAX / bitmap.pitch) return NULL;
-    size_t size = bitmap.pitch * bitmap.rows;
-    jbyteArray result = (*env)->NewByteArray(env, size);
-    if (result) {
-        unsigned char* dst = (*env)->GetPrimitiveArrayCritical(env, result, NULL);
-        if (dst) {
-            memcpy(dst, src, size);
-            (*env)->ReleasePrimitiveArrayCritical(env, result, dst, 0);
+    FT_Set_Char_Size(face, 0, (FT_F26Dot6)size, 72, 72);
+    if (matrixObj) {
+        FT_Matrix matrix, *lpMatrix = getFT_MatrixFields(env, matrixObj, &matrix);
+        if (lpMatrix) {
+            FT_Set_Transform(face, lpMatrix, NULL);
         }
     }
-    return result;
+
+    if ((size_t)count > INT_MAX / (GLYPH_METRICS_SIZE * sizeof(jint))) return 0;
+    jint *codes = (jint*) malloc(count * sizeof(jint));
+    jint *out = (jint*) malloc(count * GLYPH_METRICS_SIZE * sizeof(jint));
+    if (!codes || !out) {
+        free(codes);
+        free(out);
+        return 0;
+    }
+    (*env)->GetIntArrayRegion(env, glyphCodes, 0, count, codes);
+
+    size_t offset = 0;
+    jint i;
+    for (i = 0; i < count; i++) {
+        jint *m = out + i * GLYPH_METRICS_SIZE;
+        memset(m, 0, GLYPH_METRICS_SIZE * sizeof(jint));
+        FT_Error error = FT_Load_Glyph(face, (FT_UInt)codes[i], (FT_Int32)flags);
+        m[GLYPH_ERROR] = (jint)error;
+        if (error) continue;
+
+        FT_GlyphSlot slot = face->glyph;
+        FT_Bitmap *bitmap = &slot->bitmap;
+        m[GLYPH_PIXEL_MODE] = (jint)bitmap->pixel_mode;
+        m[GLYPH_WIDTH] = (jint)bitmap->width;
+        m[GLYPH_ROWS] = (jint)bitmap->rows;
+        m[GLYPH_LEFT] = (jint)slot->bitmap_left;
+        m[GLYPH_TOP] = (jint)slot->bitmap_top;
+        m[GLYPH_ADVANCE_X] = (jint)slot->advance.x;
+        m[GLYPH_ADVANCE_Y] = (jint)slot->advance.y;
+        m[GLYPH_LINEAR_ADVANCE] = (jint)slot->linearHoriAdvance;
+        m[GLYPH_OFFSET] = (jint)offset;
+
+        /* Only gray and LCD bitmaps are byte per sample, leave others empty */
+        if (bitmap->pixel_mode != FT_PIXEL_MODE_GRAY &&
+            bitmap->pixel_mode != FT_PIXEL_MODE_LCD) continue;
+        if (!bitmap->buffer || bitmap->width == 0 || bitmap->rows == 0 ||
+            bitmap->pitch < (int)bitmap->width) {
+            m[GLYPH_WIDTH] = 0;
+            m[GLYPH_ROWS] = 0;
+            continue;
+        }
+        size_t bitmapSize = (size_t)bitmap->width * bitmap->rows;
+        if (bitmapSize > (size_t)capacity - offset) break;
+        unsigned char *src = bitmap->buffer;
+        unsigned int y;
+        for (y = 0; y < bitmap->rows; y++) {
+            memcpy(dst + offset, src, bitmap->width);
+            offset += bitmap->width;
+            src += bitmap->pitch;
+        }
+    }
+
+    /* The metrics of a glyph that did not fit are written back too */
+    (*env)->SetIntArrayRegion(env, metrics, 0, (i < count ? i + 1 : count) * GLYPH_METRICS_SIZE, out);
+    free(out);
+    free(codes);
+    return i;
 }
 
 JNIEXPORT void JNICALL OS_NATIVE(FT_1Set_1Transform)
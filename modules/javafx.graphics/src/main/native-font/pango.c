@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -31,6 +31,7 @@
 #include <pango/pango.h>
 #include <pango/pangoft2.h>
 #include <dlfcn.h>
+#include <string.h>
 
 #ifdef STATIC_BUILD
 JNIEXPORT jint JNICALL
@@ -150,6 +151,272 @@ void cachePangoGlyphStringFields(JNIEnv *env)
 
 /** Custom **/
 
+/*
+ * Shaping results are cached by font, analysis and item text so that
+ * unchanged runs of a paragraph that is laid out again (for example
+ * after an edit in a TextArea) do not go through pango_shape().
+ * Entries hold a reference to their font, so a font pointer can never
+ * be reused by a different font while an entry still refers to it.
+ * The attributes that are not part of the font, such as the fallback
+ * setting or font features, are part of the key with their range in
+ * the item.
+ */
+#define SHAPE_CACHE_MAX_BYTES (1024 * 1024)
+
+typedef struct ShapeCacheEntry {
+    PangoFont *font;
+    PangoLanguage *language;
+    guint8 level, gravity, flags, script;
+    guint hash;
+    int length;
+    gchar *text;
+    /* The extra attributes of the analysis, with their indices relative
+     * to offset. Entries own copies with offset 0. */
+    GSList *attrs;
+    guint offset;
+    int num_glyphs;
+    /* num_glyphs glyph ids, followed by the widths and the char clusters */
+    jint *data;
+    GList *link;
+} ShapeCacheEntry;
+
+static GHashTable *shapeCache = NULL;
+static GQueue shapeCacheLru = G_QUEUE_INIT;
+static gsize shapeCacheBytes = 0;
+G_LOCK_DEFINE_STATIC(shapeCache);
+
+static guint shapeCacheHash(gconstpointer key)
+{
+    return ((const ShapeCacheEntry *)key)->hash;
+}
+
+static guint attrStart(const PangoAttribute *attr, guint offset, int length)
+{
+    guint start = attr->start_index > offset ? attr->start_index - offset : 0;
+    return MIN(start, (guint)length);
+}
+
+static guint attrEnd(const PangoAttribute *attr, guint offset, int length)
+{
+    guint end = attr->end_index > offset ? attr->end_index - offset : 0;
+    return MIN(end, (guint)length);
+}
+
+static gboolean shapeCacheAttrsEqual(const ShapeCacheEntry *ea, const ShapeCacheEntry *eb)
+{
+    const GSList *la = ea->attrs;
+    const GSList *lb = eb->attrs;
+    for (; la && lb; la = la->next, lb = lb->next) {
+        const PangoAttribute *a = (const PangoAttribute *)la->data;
+        const PangoAttribute *b = (const PangoAttribute *)lb->data;
+        if (!pango_attribute_equal(a, b) ||
+            attrStart(a, ea->offset, ea->length) != attrStart(b, eb->offset, eb->length) ||
+            attrEnd(a, ea->offset, ea->length) != attrEnd(b, eb->offset, eb->length)) {
+            return FALSE;
+        }
+    }
+    return la == NULL && lb == NULL;
+}
+
+static gboolean shapeCacheEqual(gconstpointer a, gconstpointer b)
+{
+    const ShapeCacheEntry *ea = (const ShapeCacheEntry *)a;
+    const ShapeCacheEntry *eb = (const ShapeCacheEntry *)b;
+    return ea->font == eb->font &&
+           ea->language == eb->language &&
+           ea->level == eb->level &&
+           ea->gravity == eb->gravity &&
+           ea->flags == eb->flags &&
+           ea->script == eb->script &&
+           ea->length == eb->length &&
+           memcmp(ea->text, eb->text, ea->length) == 0 &&
+           shapeCacheAttrsEqual(ea, eb);
+}
+
+static gsize shapeCacheEntrySize(const ShapeCacheEntry *entry)
+{
+    return sizeof(ShapeCacheEntry) + entry->length +
+           3 * (gsize)entry->num_glyphs * sizeof(jint);
+}
+
+static void shapeCacheKey(ShapeCacheEntry *key, const gchar *text, int length,
+                          guint offset, const PangoAnalysis *analysis)
+{
+    /* FNV-1a over the text and the attribute types and ranges, mixed with
+     * the analysis fields */
+    guint hash = 2166136261u;
+    const GSList *l;
+    int i;
+    for (i = 0; i < length; i++) {
+        hash = (hash ^ (guint8)text[i]) * 16777619u;
+    }
+    for (l = analysis->extra_attrs; l; l = l->next) {
+        const PangoAttribute *attr = (const PangoAttribute *)l->data;
+        hash = (hash ^ (guint)attr->klass->type) * 16777619u;
+        hash = (hash ^ attrStart(attr, offset, length)) * 16777619u;
+        hash = (hash ^ attrEnd(attr, offset, length)) * 16777619u;
+    }
+    hash ^= (guint)((guintptr)analysis->font >> 4) * 31u;
+    hash ^= ((guint)analysis->level << 24) | ((guint)analysis->script << 16) |
+            ((guint)analysis->gravity << 8) | analysis->flags;
+
+    key->font = analysis->font;
+    key->language = analysis->language;
+    key->level = analysis->level;
+    key->gravity = analysis->gravity;
+    key->flags = analysis->flags;
+    key->script = analysis->script;
+    key->hash = hash;
+    key->length = length;
+    key->text = (gchar *)text;
+    key->attrs = analysis->extra_attrs;
+    key->offset = offset;
+    key->num_glyphs = 0;
+    key->data = NULL;
+    key->link = NULL;
+}
+
+static void shapeCacheFreeEntry(ShapeCacheEntry *entry)
+{
+    g_object_unref(entry->font);
+    g_free(entry->text);
+    g_slist_free_full(entry->attrs, (GDestroyNotify)pango_attribute_destroy);
+    free(entry->data);
+    g_free(entry);
+}
+
+/* Must be called with the shapeCache lock held */
+static ShapeCacheEntry *shapeCacheLookup(const ShapeCacheEntry *key)
+{
+    if (!shapeCache) return NULL;
+    ShapeCacheEntry *entry = g_hash_table_lookup(shapeCache, key);
+    if (entry && entry->link != shapeCacheLru.head) {
+        g_queue_unlink(&shapeCacheLru, entry->link);
+        g_queue_push_head_link(&shapeCacheLru, entry->link);
+    }
+    return entry;
+}
+
+/*
+ * Takes ownership of data on success. Returns FALSE if the result was
+ * not cached, in which case the caller still owns data.
+ */
+static gboolean shapeCacheInsert(const ShapeCacheEntry *key, int count, jint *data)
+{
+    ShapeCacheEntry *entry = g_new(ShapeCacheEntry, 1);
+    const GSList *l;
+    *entry = *key;
+    entry->num_glyphs = count;
+    if (shapeCacheEntrySize(entry) > SHAPE_CACHE_MAX_BYTES / 4) {
+        g_free(entry);
+        return FALSE;
+    }
+    entry->text = g_malloc(key->length);
+    memcpy(entry->text, key->text, key->length);
+    entry->attrs = NULL;
+    for (l = key->attrs; l; l = l->next) {
+        const PangoAttribute *attr = (const PangoAttribute *)l->data;
+        PangoAttribute *copy = pango_attribute_copy(attr);
+        copy->start_index = attrStart(attr, key->offset, key->length);
+        copy->end_index = attrEnd(attr, key->offset, key->length);
+        entry->attrs = g_slist_prepend(entry->attrs, copy);
+    }
+    entry->attrs = g_slist_reverse(entry->attrs);
+    entry->offset = 0;
+    entry->data = data;
+    g_object_ref(entry->font);
+
+    G_LOCK(shapeCache);
+    if (!shapeCache) {
+        shapeCache = g_hash_table_new(shapeCacheHash, shapeCacheEqual);
+    }
+    if (g_hash_table_lookup(shapeCache, entry)) {
+        /* Another thread shaped the same run in the meantime */
+        G_UNLOCK(shapeCache);
+        entry->data = NULL;
+        shapeCacheFreeEntry(entry);
+        return FALSE;
+    }
+    g_hash_table_add(shapeCache, entry);
+    g_queue_push_head(&shapeCacheLru, entry);
+    entry->link = shapeCacheLru.head;
+    shapeCacheBytes += shapeCacheEntrySize(entry);
+    while (shapeCacheBytes > SHAPE_CACHE_MAX_BYTES) {
+        ShapeCacheEntry *last = g_queue_pop_tail(&shapeCacheLru);
+        g_hash_table_remove(shapeCache, last);
+        shapeCacheBytes -= shapeCacheEntrySize(last);
+        shapeCacheFreeEntry(last);
+    }
+    G_UNLOCK(shapeCache);
+    return TRUE;
+}
+
+/*
+ * Translates the byte index of each glyph cluster to a char index.
+ * Pango stores clusters in visual order, so they only ever increase
+ * when the glyphs are walked in logical order, and a single forward
+ * pass over the text is enough.
+ */
+static void mapClusters(const gchar *text, const PangoGlyphString *glyphString,
+                        gboolean rtl, jint *cluster)
+{
+    const gchar *p = text;
+    jint offset = 0;
+    int count = glyphString->num_glyphs;
+    int k;
+    for (k = 0; k < count; k++) {
+        int i = rtl ? count - 1 - k : k;
+        const gchar *end = text + glyphString->log_clusters[i];
+        if (end < p) {
+            /* Not monotonic, start over */
+            p = text;
+            offset = 0;
+        }
+        while (p < end) {
+            p = g_utf8_next_char(p);
+            offset++;
+        }
+        cluster[i] = offset;
+    }
+}
+
+static jobject newPangoGlyphString(JNIEnv *env, PangoItem *item, int count, const jint *data)
+{
+    jintArray glyphsArray = (*env)->NewIntArray(env, count);
+    jintArray widthsArray = (*env)->NewIntArray(env, count);
+    jintArray clusterArray = (*env)->NewIntArray(env, count);
+    if (!glyphsArray || !widthsArray || !clusterArray) return NULL;
+
+    (*env)->SetIntArrayRegion(env, glyphsArray, 0, count, data);
+    if ((*env)->ExceptionOccurred(env)) {
+        fprintf(stderr, "OS_NATIVE error: JNI exception");
+        return NULL;
+    }
+    (*env)->SetIntArrayRegion(env, widthsArray, 0, count, data + count);
+    if ((*env)->ExceptionOccurred(env)) {
+        fprintf(stderr, "OS_NATIVE error: JNI exception");
+        return NULL;
+    }
+    (*env)->SetIntArrayRegion(env, clusterArray, 0, count, data + 2 * count);
+    if ((*env)->ExceptionOccurred(env)) {
+        fprintf(stderr, "OS_NATIVE error: JNI exception");
+        return NULL;
+    }
+    if (!PangoGlyphStringFc.cached) cachePangoGlyphStringFields(env);
+    jobject result = (*env)->NewObject(env, PangoGlyphStringFc.clazz, PangoGlyphStringFc.init);
+    if (result) {
+        (*env)->SetIntField(env, result, PangoGlyphStringFc.num_glyphs, count);
+        (*env)->SetObjectField(env, result, PangoGlyphStringFc.glyphs, glyphsArray);
+        (*env)->SetObjectField(env, result, PangoGlyphStringFc.widths, widthsArray);
+        (*env)->SetObjectField(env, result, PangoGlyphStringFc.log_clusters, clusterArray);
+        (*env)->SetIntField(env, result, PangoGlyphStringFc.offset, item->offset);
+        (*env)->SetIntField(env, result, PangoGlyphStringFc.length, item->length);
+        (*env)->SetIntField(env, result, PangoGlyphStringFc.num_chars, item->num_chars);
+        (*env)->SetLongField(env, result, PangoGlyphStringFc.font, (jlong)item->analysis.font);
+    }
+    return result;
+}
+
 JNIEXPORT jobject JNICALL OS_NATIVE(pango_1shape)
     (JNIEnv *env, jclass that, jlong str, jlong pangoItem)
 {
@@ -157,77 +424,65 @@ JNIEXPORT jobject JNICALL OS_NATIVE(pango_1shape)
     if (!pangoItem) return NULL;
     PangoItem *item = (PangoItem *)pangoItem;
     PangoAnalysis analysis = item->analysis;
-    if (!pangoItem) return NULL;
     const gchar *text= (const gchar *)(str + item->offset);
+
+    jobject result = NULL;
+    ShapeCacheEntry key;
+    gboolean cacheable = analysis.font != NULL && item->length > 0;
+    if (cacheable) {
+        shapeCacheKey(&key, text, item->length, item->offset, &analysis);
+        jint *cached = NULL;
+        int cachedCount = 0;
+        G_LOCK(shapeCache);
+        ShapeCacheEntry *entry = shapeCacheLookup(&key);
+        if (entry) {
+            /* Copied out, so that no JNI call is made with the lock held */
+            cachedCount = entry->num_glyphs;
+            cached = (jint*) malloc(3 * cachedCount * sizeof(jint));
+            if (cached) {
+                memcpy(cached, entry->data, 3 * cachedCount * sizeof(jint));
+            }
+        }
+        G_UNLOCK(shapeCache);
+        if (cached) {
+            result = newPangoGlyphString(env, item, cachedCount, cached);
+            free(cached);
+            return result;
+        }
+    }
+
     PangoGlyphString *glyphString = pango_glyph_string_new();
     if (!glyphString) return NULL;
 
-    jobject result = NULL;
     pango_shape(text, item->length, &analysis, glyphString);
     int count = glyphString->num_glyphs;
-    jint *glyphs = NULL;
-    jint *widths = NULL;
-    jint *cluster = NULL;
+    jint *data = NULL;
     if (count <= 0) goto fail;
-    if ((size_t)count >= INT_MAX / sizeof(jint)) {
+    if ((size_t)count >= INT_MAX / (3 * sizeof(jint))) {
         fprintf(stderr, "OS_NATIVE error: large glyph count value in pango_1shape\n");
         goto fail;
     }
 
-    jintArray glyphsArray = (*env)->NewIntArray(env, count);
-    jintArray widthsArray = (*env)->NewIntArray(env, count);
-    jintArray clusterArray = (*env)->NewIntArray(env, count);
-    if (glyphsArray && widthsArray && clusterArray) {
-        glyphs = (jint*) malloc(count * sizeof(jint));
-        widths = (jint*) malloc(count * sizeof(jint));
-        cluster = (jint*) malloc(count * sizeof(jint));
-        if (glyphs == NULL ||
-            widths == NULL ||
-            cluster == NULL) {
-            fprintf(stderr, "OS_NATIVE error: Unable to allocate memory in pango_1shape\n");
-            goto fail;
-        }
-        int i;
-        for (i = 0; i < count; i++) {
-            glyphs[i] = glyphString->glyphs[i].glyph;
-            widths[i] = glyphString->glyphs[i].geometry.width;
-            /* translate byte index to char index */
-            cluster[i] = (jint)g_utf8_pointer_to_offset(text, text + glyphString->log_clusters[i]);
-        }
-        (*env)->SetIntArrayRegion(env, glyphsArray, 0, count, glyphs);
-        if ((*env)->ExceptionOccurred(env)) {
-            fprintf(stderr, "OS_NATIVE error: JNI exception");
-            goto fail;
-        }
-        (*env)->SetIntArrayRegion(env, widthsArray, 0, count, widths);
-        if ((*env)->ExceptionOccurred(env)) {
-            fprintf(stderr, "OS_NATIVE error: JNI exception");
-            goto fail;
-        }
-        (*env)->SetIntArrayRegion(env, clusterArray, 0, count, cluster);
-        if ((*env)->ExceptionOccurred(env)) {
-            fprintf(stderr, "OS_NATIVE error: JNI exception");
-            goto fail;
-        }
-        if (!PangoGlyphStringFc.cached) cachePangoGlyphStringFields(env);
-        result = (*env)->NewObject(env, PangoGlyphStringFc.clazz, PangoGlyphStringFc.init);
-        if (result) {
-            (*env)->SetIntField(env, result, PangoGlyphStringFc.num_glyphs, count);
-            (*env)->SetObjectField(env, result, PangoGlyphStringFc.glyphs, glyphsArray);
-            (*env)->SetObjectField(env, result, PangoGlyphStringFc.widths, widthsArray);
-            (*env)->SetObjectField(env, result, PangoGlyphStringFc.log_clusters, clusterArray);
-            (*env)->SetIntField(env, result, PangoGlyphStringFc.offset, item->offset);
-            (*env)->SetIntField(env, result, PangoGlyphStringFc.length, item->length);
-            (*env)->SetIntField(env, result, PangoGlyphStringFc.num_chars, item->num_chars);
-            (*env)->SetLongField(env, result, PangoGlyphStringFc.font, (jlong)analysis.font);
-        }
+    data = (jint*) malloc(3 * count * sizeof(jint));
+    if (data == NULL) {
+        fprintf(stderr, "OS_NATIVE error: Unable to allocate memory in pango_1shape\n");
+        goto fail;
+    }
+    int i;
+    for (i = 0; i < count; i++) {
+        data[i] = glyphString->glyphs[i].glyph;
+        data[count + i] = glyphString->glyphs[i].geometry.width;
+    }
+    mapClusters(text, glyphString, analysis.level & 1, data + 2 * count);
+
+    result = newPangoGlyphString(env, item, count, data);
+    if (result && cacheable && shapeCacheInsert(&key, count, data)) {
+        data = NULL;
     }
 
 fail:
     pango_glyph_string_free(glyphString);
-    SAFE_FREE(glyphs);
-    SAFE_FREE(widths);
-    SAFE_FREE(cluster);
+    SAFE_FREE(data);
     return result;
 }
 
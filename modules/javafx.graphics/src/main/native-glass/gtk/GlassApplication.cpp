@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -47,6 +47,13 @@
 
 GdkEventFunc process_events_prev;
 static void process_events(GdkEvent*, gpointer);
+static void flush_pending_event();
+
+// The merged scroll being dispatched, whose deltas are in steps
+static GdkEvent* merged_scroll_event = NULL;
+
+// Whether consecutive motion and scroll events are merged, see coalesce_event
+static gboolean coalesceEvents = TRUE;
 
 JNIEnv* mainEnv; // Use only with main loop thread!!!
 PlatformSupport* platformSupport = NULL;
@@ -170,16 +177,17 @@ JNIEXPORT jint JNICALL Java_com_sun_glass_ui_gtk_GtkApplication__1queryLibrary
 /*
  * Class:     com_sun_glass_ui_gtk_GtkApplication
  * Method:    _init
- * Signature: ()V
+ * Signature: (JZZ)V
  */
 JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkApplication__1init
-  (JNIEnv * env, jobject obj, jlong handler, jboolean _disableGrab)
+  (JNIEnv * env, jobject obj, jlong handler, jboolean _disableGrab, jboolean _coalesceEvents)
 {
     (void)obj;
 
     mainEnv = env;
     process_events_prev = (GdkEventFunc) handler;
     disableGrab = (gboolean) _disableGrab;
+    coalesceEvents = (gboolean) _coalesceEvents;
 
     glass_gdk_x11_display_set_window_scale(gdk_display_get_default(), 1);
     gdk_event_handler_set(process_events, NULL, NULL);
@@ -465,7 +473,7 @@ bool is_window_enabled_for_event(GdkWindow * window, WindowContext *ctx, gint ev
     return TRUE;
 }
 
-static void process_events(GdkEvent* event, gpointer data)
+static void dispatch_event(GdkEvent* event, gpointer data)
 {
     GdkWindow* window = event->any.window;
     WindowContext *ctx = window != NULL ? (WindowContext*)
@@ -525,7 +533,7 @@ static void process_events(GdkEvent* event, gpointer data)
                     gdk_event_request_motions(&event->motion);
                     break;
                 case GDK_SCROLL:
-                    ctx->process_mouse_scroll(&event->scroll);
+                    ctx->process_mouse_scroll(&event->scroll, event == merged_scroll_event);
                     break;
                 case GDK_ENTER_NOTIFY:
                 case GDK_LEAVE_NOTIFY:
@@ -575,6 +583,158 @@ static void process_events(GdkEvent* event, gpointer data)
     }
 }
 
+/*
+ * Motion and discrete scroll events are held back while more events are
+ * queued and merged with the ones that follow for the same window: a motion
+ * keeps only the latest pointer position, discrete scrolls add up their
+ * steps into a GDK_SCROLL_SMOOTH event. Native smooth scrolls, delivered
+ * because of GDK_SMOOTH_SCROLL_MASK, are never held or merged. Any other
+ * event delivers the held one first, so button, crossing and key events
+ * keep their order. Whatever is still held when the queue runs dry is
+ * delivered from an idle callback that runs before the next pulse.
+ */
+static GdkEvent* pending_event = NULL;
+static guint pending_event_source = 0;
+
+static void get_scroll_deltas(GdkEventScroll* event, gdouble* dx, gdouble* dy)
+{
+    *dx = 0;
+    *dy = 0;
+    switch (event->direction) {
+        case GDK_SCROLL_SMOOTH:
+            // the steps merged so far
+            *dx = event->delta_x;
+            *dy = event->delta_y;
+            break;
+        case GDK_SCROLL_UP:
+            *dy = -1;
+            break;
+        case GDK_SCROLL_DOWN:
+            *dy = 1;
+            break;
+        case GDK_SCROLL_LEFT:
+            *dx = -1;
+            break;
+        case GDK_SCROLL_RIGHT:
+            *dx = 1;
+            break;
+    }
+}
+
+static bool merge_event(GdkEvent* pending, GdkEvent* event)
+{
+    if (pending->type != event->type
+            || pending->any.window != event->any.window
+            || gdk_event_get_device(pending) != gdk_event_get_device(event)) {
+        return false;
+    }
+
+    if (event->type == GDK_MOTION_NOTIFY) {
+        if (pending->motion.state != event->motion.state) {
+            return false;
+        }
+        pending->motion.time = event->motion.time;
+        pending->motion.x = event->motion.x;
+        pending->motion.y = event->motion.y;
+        pending->motion.x_root = event->motion.x_root;
+        pending->motion.y_root = event->motion.y_root;
+        return true;
+    }
+
+    if (pending->scroll.state != event->scroll.state) {
+        return false;
+    }
+    gdouble pdx, pdy, dx, dy;
+    get_scroll_deltas(&pending->scroll, &pdx, &pdy);
+    get_scroll_deltas(&event->scroll, &dx, &dy);
+    pending->scroll.direction = GDK_SCROLL_SMOOTH;
+    pending->scroll.delta_x = pdx + dx;
+    pending->scroll.delta_y = pdy + dy;
+    pending->scroll.time = event->scroll.time;
+    pending->scroll.x = event->scroll.x;
+    pending->scroll.y = event->scroll.y;
+    pending->scroll.x_root = event->scroll.x_root;
+    pending->scroll.y_root = event->scroll.y_root;
+    return true;
+}
+
+static gboolean flush_pending_event_callback(gpointer data)
+{
+    (void)data;
+
+    pending_event_source = 0;
+    flush_pending_event();
+    return FALSE;
+}
+
+static void flush_pending_event()
+{
+    if (pending_event == NULL) {
+        return;
+    }
+    GdkEvent* event = pending_event;
+    pending_event = NULL;
+
+    // The window may have lost its context while the event was held
+    if (g_object_get_data(G_OBJECT(event->any.window), GDK_WINDOW_DATA_CONTEXT) != NULL) {
+        // Native smooth scrolls are never held, so a smooth one was merged
+        if (event->type == GDK_SCROLL && event->scroll.direction == GDK_SCROLL_SMOOTH) {
+            merged_scroll_event = event;
+        }
+        dispatch_event(event, NULL);
+        merged_scroll_event = NULL;
+    }
+    gdk_event_free(event);
+}
+
+static bool coalesce_event(GdkEvent* event)
+{
+    if (!coalesceEvents
+            || (event->type != GDK_MOTION_NOTIFY && event->type != GDK_SCROLL)
+            || (event->type == GDK_SCROLL && event->scroll.direction == GDK_SCROLL_SMOOTH)
+            || event->any.window == NULL
+            || g_object_get_data(G_OBJECT(event->any.window), GDK_WINDOW_DATA_CONTEXT) == NULL) {
+        return false;
+    }
+
+    if (event->type == GDK_MOTION_NOTIFY) {
+        gdk_event_request_motions(&event->motion);
+    }
+
+    if (pending_event != NULL) {
+        if (merge_event(pending_event, event)) {
+            if (!gdk_events_pending()) {
+                // Nothing queued that could still be merged into it
+                flush_pending_event();
+            }
+            return true;
+        }
+        flush_pending_event();
+    }
+
+    if (!gdk_events_pending()) {
+        // An event that nothing follows yet is dispatched without delay
+        return false;
+    }
+
+    pending_event = gdk_event_copy(event);
+    if (pending_event_source == 0) {
+        // Just below the priority of GDK events, well above the pulse runnables
+        pending_event_source = gdk_threads_add_idle_full(G_PRIORITY_DEFAULT + 1,
+                flush_pending_event_callback, NULL, NULL);
+    }
+    return true;
+}
+
+static void process_events(GdkEvent* event, gpointer data)
+{
+    if (coalesce_event(event)) {
+        return;
+    }
+    flush_pending_event();
+    dispatch_event(event, data);
+}
+
 /*
  * Class:       com_sun_glass_ui_gtk_GtkApplication
  * Method:      _openURI
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,9 +25,15 @@
 #include <X11/Xlib.h>
 #include <X11/Xutil.h>
 #include <X11/extensions/XTest.h>
+#include <X11/extensions/XShm.h>
 #include <assert.h>
 #include <stdlib.h>
 #include <math.h>
+#include <sys/ipc.h>
+#include <sys/shm.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 #include <gdk/gdk.h>
 #include <gdk/gdkx.h>
 
@@ -245,50 +251,248 @@ JNIEXPORT jint JNICALL Java_com_sun_glass_ui_gtk_GtkRobot__1getMouseY
 }
 
 /*
- * Class:     com_sun_glass_ui_gtk_GtkRobot
- * Method:    _getScreenCapture
- * Signature: (IIII[I)V
+ * Screen captures read the root window into an MIT-SHM image, so the X
+ * server writes the pixels straight into memory shared with us. The image
+ * is kept while the capture size stays the same if capture streaming is
+ * on, until the toolkit shuts down, and released after each capture
+ * otherwise. Captures fall back to GdkPixbuf when the extension or a
+ * matching visual is not available, or when the area is not fully on the
+ * screen.
  */
-JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkRobot__1getScreenCapture
-  (JNIEnv * env, jobject obj, jint x, jint y, jint width, jint height, jintArray data)
-{
-    (void)obj;
+static XImage* capture_image = NULL;
+static XShmSegmentInfo capture_shm_info;
+static int capture_shm_supported = -1;
 
-    if (!data) {
+static void release_capture_image()
+{
+    if (capture_image == NULL) {
         return;
     }
-    if (width <= 0 || height <= 0) {
-        return;
+    Display* display = gdk_x11_get_default_xdisplay();
+    XShmDetach(display, &capture_shm_info);
+    XSync(display, False);
+    shmdt(capture_shm_info.shmaddr);
+    // The data belongs to the shared segment, not to Xlib
+    capture_image->data = NULL;
+    XDestroyImage(capture_image);
+    capture_image = NULL;
+}
+
+static XImage* get_capture_image(Display* display, jint width, jint height)
+{
+    if (capture_image != NULL) {
+        if (capture_image->width == width && capture_image->height == height) {
+            return capture_image;
+        }
+        release_capture_image();
     }
-    const int maxPixels = INT_MAX / 4;
-    if (width >= maxPixels / height) {
-        return;
+
+    if (capture_shm_supported < 0) {
+        capture_shm_supported = XShmQueryExtension(display) ? 1 : 0;
+    }
+    if (!capture_shm_supported) {
+        return NULL;
     }
 
-    const int numPixels = width * height;
-    if (numPixels > env->GetArrayLength(data)) {
-        return;
+    int screen = DefaultScreen(display);
+    Visual* visual = DefaultVisual(display, screen);
+    int depth = DefaultDepth(display, screen);
+    if ((depth != 24 && depth != 32)
+            || visual->red_mask != 0xff0000
+            || visual->green_mask != 0xff00
+            || visual->blue_mask != 0xff) {
+        return NULL;
+    }
+
+    XImage* image = XShmCreateImage(display, visual, depth, ZPixmap, NULL,
+                                    &capture_shm_info, width, height);
+    if (image == NULL) {
+        return NULL;
+    }
+    if (image->bits_per_pixel != 32
+            || image->byte_order != (G_BYTE_ORDER == G_LITTLE_ENDIAN ? LSBFirst : MSBFirst)) {
+        XDestroyImage(image);
+        return NULL;
     }
 
+    capture_shm_info.shmid = shmget(IPC_PRIVATE, (size_t) image->bytes_per_line * image->height,
+                                    IPC_CREAT | 0600);
+    if (capture_shm_info.shmid < 0) {
+        XDestroyImage(image);
+        return NULL;
+    }
+    capture_shm_info.shmaddr = (char*) shmat(capture_shm_info.shmid, NULL, 0);
+    if (capture_shm_info.shmaddr == (char*) -1) {
+        shmctl(capture_shm_info.shmid, IPC_RMID, NULL);
+        XDestroyImage(image);
+        return NULL;
+    }
+    capture_shm_info.readOnly = False;
+
+    GdkDisplay* gdk_display = gdk_display_get_default();
+    gdk_x11_display_error_trap_push(gdk_display);
+    Status attached = XShmAttach(display, &capture_shm_info);
+    XSync(display, False);
+    bool failed = gdk_x11_display_error_trap_pop(gdk_display) != 0 || !attached;
+
+    // The segment goes away once both sides have detached from it
+    shmctl(capture_shm_info.shmid, IPC_RMID, NULL);
+
+    if (failed) {
+        // Typically a remote X server, which cannot map our memory
+        shmdt(capture_shm_info.shmaddr);
+        XDestroyImage(image);
+        capture_shm_supported = 0;
+        return NULL;
+    }
+
+    image->data = capture_shm_info.shmaddr;
+    capture_image = image;
+    return image;
+}
+
+/*
+ * Reads the area of the screen into the capture image. Returns NULL if
+ * the caller has to fall back to GdkPixbuf.
+ */
+static XImage* capture_screen_shm(jint x, jint y, jint width, jint height)
+{
+    GdkWindow* root_window = gdk_get_default_root_window();
+    if (x < 0 || y < 0
+            || width > gdk_window_get_width(root_window) - x
+            || height > gdk_window_get_height(root_window) - y) {
+        return NULL;
+    }
+
+    Display* display = gdk_x11_get_default_xdisplay();
+    XImage* image = get_capture_image(display, width, height);
+    if (image == NULL) {
+        return NULL;
+    }
+
+    GdkDisplay* gdk_display = gdk_display_get_default();
+    gdk_x11_display_error_trap_push(gdk_display);
+    Bool captured = XShmGetImage(display, GDK_WINDOW_XID(root_window), image, x, y, AllPlanes);
+    if (gdk_x11_display_error_trap_pop(gdk_display) != 0 || !captured) {
+        release_capture_image();
+        return NULL;
+    }
+    return image;
+}
+
+/*
+ * Copies the captured pixels to INT_ARGB, with the unused top byte of
+ * the X pixels set to opaque.
+ */
+static void copy_capture_pixels(const XImage* image, jint* dst)
+{
+    const jint width = image->width;
+    const jint height = image->height;
+    for (jint y = 0; y < height; y++) {
+        const guint32* src = (const guint32*) (image->data + (size_t) y * image->bytes_per_line);
+        jint* row = dst + (size_t) y * width;
+        jint x = 0;
+#ifdef __SSE2__
+        const __m128i alpha = _mm_set1_epi32((int) 0xff000000);
+        for (; x + 4 <= width; x += 4) {
+            __m128i p = _mm_loadu_si128((const __m128i*) (src + x));
+            _mm_storeu_si128((__m128i*) (row + x), _mm_or_si128(p, alpha));
+        }
+#endif
+        for (; x < width; x++) {
+            row[x] = (jint) (src[x] | 0xff000000);
+        }
+    }
+}
+
+/*
+ * Captures through GdkPixbuf. Returns the INT_ARGB pixels, to be freed
+ * with g_free, or NULL.
+ */
+static jint* capture_screen_pixbuf(jint x, jint y, jint width, jint height)
+{
     GdkPixbuf *screenshot, *tmp;
     GdkWindow *root_window = gdk_get_default_root_window();
 
     tmp = glass_pixbuf_from_window(root_window, x, y, width, height);
     if (!tmp) {
-        return;
+        return NULL;
     }
     screenshot = gdk_pixbuf_add_alpha(tmp, FALSE, 0, 0, 0);
     g_object_unref(tmp);
     if (!screenshot) {
-        return;
+        return NULL;
     }
 
     jint *pixels = (jint *)convert_BGRA_to_RGBA((int*)gdk_pixbuf_get_pixels(screenshot), width * 4, height);
+    g_object_unref(screenshot);
+    return pixels;
+}
+
+static bool check_capture_size(jint width, jint height)
+{
+    if (width <= 0 || height <= 0) {
+        return false;
+    }
+    const int maxPixels = INT_MAX / 4;
+    return width < maxPixels / height;
+}
+
+/*
+ * Class:     com_sun_glass_ui_gtk_GtkRobot
+ * Method:    _getScreenCapture
+ * Signature: (IIII[IZZ)V
+ */
+JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkRobot__1getScreenCapture
+  (JNIEnv * env, jobject obj, jint x, jint y, jint width, jint height, jintArray data,
+   jboolean shm, jboolean streaming)
+{
+    (void)obj;
+
+    if (!data) {
+        return;
+    }
+    if (!check_capture_size(width, height)) {
+        return;
+    }
+
+    const int numPixels = width * height;
+    if (numPixels > env->GetArrayLength(data)) {
+        return;
+    }
+
+    XImage* image = shm ? capture_screen_shm(x, y, width, height) : NULL;
+    if (image != NULL) {
+        jint* dst = (jint*) env->GetPrimitiveArrayCritical(data, NULL);
+        if (dst != NULL) {
+            copy_capture_pixels(image, dst);
+            env->ReleasePrimitiveArrayCritical(data, dst, 0);
+        }
+        if (!streaming) {
+            release_capture_image();
+        }
+        return;
+    }
+
+    jint *pixels = capture_screen_pixbuf(x, y, width, height);
     if (pixels) {
         env->SetIntArrayRegion(data, 0, numPixels, pixels);
         g_free(pixels);
     }
-    g_object_unref(screenshot);
+}
+
+/*
+ * Class:     com_sun_glass_ui_gtk_GtkRobot
+ * Method:    _releaseScreenCapture
+ * Signature: ()V
+ */
+JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkRobot__1releaseScreenCapture
+  (JNIEnv * env, jclass cls)
+{
+    (void)env;
+    (void)cls;
+
+    release_capture_image();
 }
 
 } // extern "C"
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -28,33 +28,220 @@
 #include <glib.h>
 #include <gdk/gdk.h>
 #include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/timerfd.h>
 
-static gboolean call_runnable_in_timer
-  (gpointer);
+/*
+ * The timer is a GSource on the main context that fires at the absolute
+ * deadlines start + n * period of CLOCK_MONOTONIC. The period is kept in
+ * nanoseconds, so a 60 Hz pulse really comes every 16.67 ms, and lateness
+ * of one tick does not shift the following ones. Deadlines the main loop
+ * has already missed are skipped rather than fired back to back.
+ *
+ * The source waits on a timerfd. If one cannot be created, it falls back
+ * to the ready time of the source, which GLib only honors to the
+ * millisecond.
+ */
+typedef struct {
+    GSource source;
+    jobject runnable;
+    JNIEnv* env;
+    int fd;
+    gpointer fd_tag;
+    gboolean frame_clock;
+    gint64 period;
+    gint64 start;
+    gint64 index;
+} TimerSource;
+
+/*
+ * Jitter statistics of all timers, in nanoseconds. Jitter is how late a
+ * tick was dispatched after its deadline.
+ */
+static struct {
+    jlong ticks;
+    jlong missed;
+    jlong total_jitter;
+    jlong max_jitter;
+} timer_stats;
+
+G_LOCK_DEFINE_STATIC(timer_stats);
+
+static gint64 monotonic_nanos()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (gint64) ts.tv_sec * G_GINT64_CONSTANT(1000000000) + ts.tv_nsec;
+}
+
+static void arm_timer(TimerSource* timer)
+{
+    gint64 deadline = timer->start + timer->index * timer->period;
+    if (timer->fd >= 0) {
+        struct itimerspec spec = {};
+        spec.it_value.tv_sec = deadline / G_GINT64_CONSTANT(1000000000);
+        spec.it_value.tv_nsec = deadline % G_GINT64_CONSTANT(1000000000);
+        timerfd_settime(timer->fd, TFD_TIMER_ABSTIME, &spec, NULL);
+    } else {
+        // g_get_monotonic_time() is CLOCK_MONOTONIC in microseconds
+        g_source_set_ready_time(&timer->source, (deadline + 999) / 1000);
+    }
+}
+
+/*
+ * In frame clock mode the deadlines follow the presentation times that
+ * GDK reports for a visible FX window, once it has any, so that pulses
+ * come at the refresh rate of the display and in phase with it.
+ */
+static void sync_to_frame_clock(TimerSource* timer, gint64 now)
+{
+    GdkFrameClock* clock = NULL;
+    GList* windows = gdk_screen_get_toplevel_windows(gdk_screen_get_default());
+    for (GList* l = windows; l != NULL; l = l->next) {
+        GdkWindow* window = GDK_WINDOW(l->data);
+        if (gdk_window_is_visible(window)
+                && g_object_get_data(G_OBJECT(window), GDK_WINDOW_DATA_CONTEXT) != NULL) {
+            clock = gdk_window_get_frame_clock(window);
+            if (clock != NULL) {
+                break;
+            }
+        }
+    }
+    g_list_free(windows);
+
+    if (clock == NULL) {
+        return;
+    }
+
+    gint64 interval = 0;
+    gint64 presentation = 0;
+    gdk_frame_clock_get_refresh_info(clock, now / 1000, &interval, &presentation);
+    if (presentation == 0 || interval <= 0) {
+        return;
+    }
+
+    timer->period = interval * 1000;
+    timer->start = presentation * 1000;
+    timer->index = now < timer->start ? 0 : (now - timer->start) / timer->period + 1;
+}
+
+static gboolean timer_dispatch(GSource* source, GSourceFunc callback, gpointer data)
+{
+    (void)callback;
+    (void)data;
+
+    TimerSource* timer = (TimerSource*) source;
+    if (timer->runnable == NULL) {
+        return G_SOURCE_REMOVE;
+    }
+
+    if (timer->fd >= 0) {
+        if (!(g_source_query_unix_fd(source, timer->fd_tag) & G_IO_IN)) {
+            return G_SOURCE_CONTINUE;
+        }
+        guint64 expirations;
+        if (read(timer->fd, &expirations, sizeof(expirations)) != sizeof(expirations)) {
+            return G_SOURCE_CONTINUE;
+        }
+    }
+
+    gint64 now = monotonic_nanos();
+    gint64 late = now - (timer->start + timer->index * timer->period);
+    if (late < 0) {
+        // Woken up early by the rounding of the ready time
+        arm_timer(timer);
+        return G_SOURCE_CONTINUE;
+    }
+
+    gint64 missed = late / timer->period;
+    gint64 jitter = late - missed * timer->period;
+    timer->index += missed + 1;
+
+    G_LOCK(timer_stats);
+    timer_stats.ticks++;
+    timer_stats.missed += missed;
+    timer_stats.total_jitter += jitter;
+    if (jitter > timer_stats.max_jitter) {
+        timer_stats.max_jitter = jitter;
+    }
+    G_UNLOCK(timer_stats);
+
+    gdk_threads_enter();
+
+    if (timer->frame_clock) {
+        sync_to_frame_clock(timer, now);
+    }
+    arm_timer(timer);
+
+    if (timer->env == NULL) {
+        // The main loop thread normally is a Java thread already. Otherwise
+        // it is attached once, and stays attached for the next ticks.
+        if (javaVM->GetEnv((void **)&timer->env, JNI_VERSION_1_6) == JNI_EDETACHED) {
+            javaVM->AttachCurrentThreadAsDaemon((void **)&timer->env, NULL);
+        }
+    }
+
+    timer->env->CallVoidMethod(timer->runnable, jRunnableRun, NULL);
+    LOG_EXCEPTION(timer->env);
+    gdk_threads_leave();
+
+    return G_SOURCE_CONTINUE;
+}
+
+static void timer_finalize(GSource* source)
+{
+    TimerSource* timer = (TimerSource*) source;
+    if (timer->fd >= 0) {
+        close(timer->fd);
+    }
+}
+
+static GSourceFuncs timer_source_funcs = {
+    NULL,
+    NULL,
+    timer_dispatch,
+    timer_finalize,
+    NULL,
+    NULL
+};
 
 extern "C" {
 
 /*
  * Class:     com_sun_glass_ui_gtk_GtkTimer
- * Method:    _start
- * Signature: (Ljava/lang/Runnable;I)J
+ * Method:    _startTimer
+ * Signature: (Ljava/lang/Runnable;JZ)J
  */
-JNIEXPORT jlong JNICALL Java_com_sun_glass_ui_gtk_GtkTimer__1start
-  (JNIEnv * env, jobject obj, jobject runnable, jint period)
+JNIEXPORT jlong JNICALL Java_com_sun_glass_ui_gtk_GtkTimer__1startTimer
+  (JNIEnv * env, jclass clazz, jobject runnable, jlong period, jboolean frameClock)
 {
-    (void)obj;
+    (void)clazz;
 
-    RunnableContext* context = (RunnableContext*) malloc(sizeof(RunnableContext));
-    if (context != NULL) {
-        context->runnable = env->NewGlobalRef(runnable);
-        context->flag = 0;
-        gdk_threads_add_timeout_full(G_PRIORITY_HIGH_IDLE, period, call_runnable_in_timer, context, NULL);
-        return PTR_TO_JLONG(context);
-    } else {
-        // we throw RuntimeException on Java side when we can't
-        // start the timer
-        return 0L;
+    if (period <= 0) {
+        // A zero period means as often as possible
+        period = 1;
+    }
+
+    TimerSource* timer = (TimerSource*) g_source_new(&timer_source_funcs, sizeof(TimerSource));
+    timer->runnable = env->NewGlobalRef(runnable);
+    timer->env = NULL;
+    timer->frame_clock = frameClock;
+    timer->period = period;
+    timer->start = monotonic_nanos() + period;
+    timer->index = 0;
+
+    timer->fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    if (timer->fd >= 0) {
+        timer->fd_tag = g_source_add_unix_fd(&timer->source, timer->fd, G_IO_IN);
     }
+
+    g_source_set_priority(&timer->source, G_PRIORITY_HIGH_IDLE);
+    g_source_set_can_recurse(&timer->source, FALSE);
+    arm_timer(timer);
+    g_source_attach(&timer->source, NULL);
+
+    return PTR_TO_JLONG(timer);
 }
 
 /*
@@ -67,37 +254,32 @@ JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkTimer__1stop
 {
     (void)obj;
 
-    RunnableContext* context = (RunnableContext*) JLONG_TO_PTR(ptr);
-    context->flag = 1;
-    env->DeleteGlobalRef(context->runnable);
-    context->runnable = NULL;
+    TimerSource* timer = (TimerSource*) JLONG_TO_PTR(ptr);
+    env->DeleteGlobalRef(timer->runnable);
+    timer->runnable = NULL;
+    g_source_destroy(&timer->source);
+    g_source_unref(&timer->source);
 }
 
-} // extern "C"
-
-
-static gboolean call_runnable_in_timer
-  (gpointer data)
+/*
+ * Class:     com_sun_glass_ui_gtk_GtkTimer
+ * Method:    _getStatistics
+ * Signature: ([J)V
+ */
+JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkTimer__1getStatistics
+  (JNIEnv * env, jclass clazz, jlongArray stats)
 {
-    RunnableContext* context = (RunnableContext*) data;
-    if (context->flag) {
-        free(context);
-        return FALSE;
-    }
-    else if (context->runnable) {
-        JNIEnv *env;
-        int envStatus = javaVM->GetEnv((void **)&env, JNI_VERSION_1_6);
-        if (envStatus == JNI_EDETACHED) {
-            javaVM->AttachCurrentThread((void **)&env, NULL);
-        }
+    (void)clazz;
 
-        env->CallVoidMethod(context->runnable, jRunnableRun, NULL);
-        LOG_EXCEPTION(env);
+    jlong values[4];
+    G_LOCK(timer_stats);
+    values[0] = timer_stats.ticks;
+    values[1] = timer_stats.missed;
+    values[2] = timer_stats.ticks > 0 ? timer_stats.total_jitter / timer_stats.ticks : 0;
+    values[3] = timer_stats.max_jitter;
+    G_UNLOCK(timer_stats);
 
-        if (envStatus == JNI_EDETACHED) {
-            javaVM->DetachCurrentThread();
-        }
-    }
-    return TRUE;
+    env->SetLongArrayRegion(stats, 0, MIN(4, env->GetArrayLength(stats)), values);
 }
 
+} // extern "C"
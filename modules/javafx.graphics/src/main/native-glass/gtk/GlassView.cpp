@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -175,98 +175,124 @@ JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkView__1scheduleRepaint
     (void)ptr;
 }
 
+/*
+ * Class:     com_sun_glass_ui_gtk_GtkView
+ * Method:    _setShmEnabled
+ * Signature: (Z)V
+ */
+JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkView__1setShmEnabled
+  (JNIEnv * env, jclass clazz, jboolean enabled)
+{
+    (void)env;
+    (void)clazz;
+
+    WindowContextBase::set_shm_enabled(enabled);
+}
+
 /*
  * Class:     com_sun_glass_ui_gtk_GtkView
  * Method:    _uploadPixelsDirect
- * Signature: (JLjava/nio/Buffer;II)V
+ * Signature: (JLjava/nio/Buffer;IIIIII)J
  */
-JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkView__1uploadPixelsDirect
-(JNIEnv *env, jobject jView, jlong ptr, jobject buffer, jint width, jint height)
+JNIEXPORT jlong JNICALL Java_com_sun_glass_ui_gtk_GtkView__1uploadPixelsDirect
+(JNIEnv *env, jobject jView, jlong ptr, jobject buffer, jint width, jint height,
+ jint dirtyX, jint dirtyY, jint dirtyWidth, jint dirtyHeight)
 {
     (void)jView;
 
-    if (!ptr) return;
-    if (!buffer) return;
+    if (!ptr) return 0;
+    if (!buffer) return 0;
 
+    jlong bytes = 0;
     GlassView* view = JLONG_TO_GLASSVIEW(ptr);
     if (view->current_window) {
         void *data = env->GetDirectBufferAddress(buffer);
 
-        view->current_window->paint(data, width, height);
+        bytes = view->current_window->paint(data, width, height,
+                dirtyX, dirtyY, dirtyWidth, dirtyHeight);
     }
+    return bytes;
 }
 
 /*
  * Class:     com_sun_glass_ui_gtk_GtkView
  * Method:    _uploadPixelsIntArray
- * Signature:  (J[IIII)V
+ * Signature:  (J[IIIIIII)J
  */
-JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkView__1uploadPixelsIntArray
-  (JNIEnv * env, jobject obj, jlong ptr, jintArray array, jint offset, jint width, jint height)
+JNIEXPORT jlong JNICALL Java_com_sun_glass_ui_gtk_GtkView__1uploadPixelsIntArray
+  (JNIEnv * env, jobject obj, jlong ptr, jintArray array, jint offset, jint width, jint height,
+ jint dirtyX, jint dirtyY, jint dirtyWidth, jint dirtyHeight)
 {
     (void)obj;
 
-    if (!ptr) return;
-    if (!array) return;
-    if (offset < 0) return;
-    if (width <= 0 || height <= 0) return;
+    if (!ptr) return 0;
+    if (!array) return 0;
+    if (offset < 0) return 0;
+    if (width <= 0 || height <= 0) return 0;
 
     if (width > ((INT_MAX - offset) / height))
     {
-        return;
+        return 0;
     }
 
     if ((width * height + offset) > env->GetArrayLength(array))
     {
-        return;
+        return 0;
     }
 
+    jlong bytes = 0;
     GlassView* view = JLONG_TO_GLASSVIEW(ptr);
     if (view->current_window) {
         int *data = NULL;
         data = (int*)env->GetPrimitiveArrayCritical(array, 0);
 
-        view->current_window->paint(data + offset, width, height);
+        bytes = view->current_window->paint(data + offset, width, height,
+                dirtyX, dirtyY, dirtyWidth, dirtyHeight);
 
         env->ReleasePrimitiveArrayCritical(array, data, JNI_ABORT);
     }
+    return bytes;
 }
 
 /*
  * Class:     com_sun_glass_ui_gtk_GtkView
  * Method:    _uploadPixelsByteArray
- * Signature:  (J[BIII)V
+ * Signature:  (J[BIIIIII)J
  */
-JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkView__1uploadPixelsByteArray
-  (JNIEnv * env, jobject obj, jlong ptr, jbyteArray array, jint offset, jint width, jint height)
+JNIEXPORT jlong JNICALL Java_com_sun_glass_ui_gtk_GtkView__1uploadPixelsByteArray
+  (JNIEnv * env, jobject obj, jlong ptr, jbyteArray array, jint offset, jint width, jint height,
+ jint dirtyX, jint dirtyY, jint dirtyWidth, jint dirtyHeight)
 {
     (void)obj;
 
-    if (!ptr) return;
-    if (!array) return;
-    if (offset < 0) return;
-    if (width <= 0 || height <= 0) return;
+    if (!ptr) return 0;
+    if (!array) return 0;
+    if (offset < 0) return 0;
+    if (width <= 0 || height <= 0) return 0;
 
     if (width > (((INT_MAX - offset) / 4) / height))
     {
-        return;
+        return 0;
     }
 
     if ((4 * width * height + offset) > env->GetArrayLength(array))
     {
-        return;
+        return 0;
     }
 
+    jlong bytes = 0;
     GlassView* view = JLONG_TO_GLASSVIEW(ptr);
     if (view->current_window) {
         unsigned char *data = NULL;
 
         data = (unsigned char*)env->GetPrimitiveArrayCritical(array, 0);
 
-        view->current_window->paint(data + offset, width, height);
+        bytes = view->current_window->paint(data + offset, width, height,
+                dirtyX, dirtyY, dirtyWidth, dirtyHeight);
 
         env->ReleasePrimitiveArrayCritical(array, data, JNI_ABORT);
     }
+    return bytes;
 }
 
 /*
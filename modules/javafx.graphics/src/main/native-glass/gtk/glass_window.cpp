@@ -46,6 +46,8 @@
 #endif
 
 #include <string.h>
+#include <sys/ipc.h>
+#include <sys/shm.h>
 
 #include <algorithm>
 
@@ -389,17 +391,21 @@ void WindowContextBase::process_mouse_motion(GdkEventMotion* event) {
     }
 }
 
-void WindowContextBase::process_mouse_scroll(GdkEventScroll* event) {
+void WindowContextBase::process_mouse_scroll(GdkEventScroll* event, bool merged) {
     jdouble dx = 0;
     jdouble dy = 0;
 
     // converting direction to change in pixels
     switch (event->direction) {
-#if GTK_CHECK_VERSION(3, 4, 0)
         case GDK_SCROLL_SMOOTH:
-            //FIXME 3.4 ???
+            // Only the sum of merged discrete scrolls is translated, in
+            // steps, see coalesce_event in GlassApplication.cpp. Native
+            // smooth scrolls are not.
+            if (merged) {
+                dx = -event->delta_x;
+                dy = -event->delta_y;
+            }
             break;
-#endif
         case GDK_SCROLL_UP:
             dy = 1;
             break;
@@ -503,9 +509,199 @@ void WindowContextBase::process_key(GdkEventKey* event) {
     }
 }
 
-void WindowContextBase::paint(void* data, jint width, jint height) {
+/*
+ * Whether MIT-SHM images can be used, decided once for the display. Remote
+ * X servers report the extension but fail to attach the shared segment.
+ */
+static int shm_supported = -1;
+
+// Lets tests force the Cairo path on displays that support MIT-SHM
+static bool shm_enabled = true;
+
+void WindowContextBase::set_shm_enabled(bool enabled) {
+    shm_enabled = enabled;
+}
+
+// The event code of ShmCompletion events on the display
+static int shm_completion_type;
+
+Bool WindowContextBase::is_shm_completion(Display* display, XEvent* xevent, XPointer arg) {
+    (void)display;
+    WindowContextBase* ctx = (WindowContextBase*) arg;
+    return xevent->type == shm_completion_type &&
+           ((XShmCompletionEvent*) xevent)->drawable == GDK_WINDOW_XID(ctx->gdk_window);
+}
+
+/*
+ * GDK reads every event from the connection, so the completion of a put
+ * may be dispatched before the window waits for it.
+ */
+GdkFilterReturn WindowContextBase::filter_shm_completion(GdkXEvent* gdk_xevent, GdkEvent* event, gpointer data) {
+    (void)event;
+    WindowContextBase* ctx = (WindowContextBase*) data;
+    if (is_shm_completion(NULL, (XEvent*) gdk_xevent, (XPointer) ctx)) {
+        ctx->shm_pending = false;
+        return GDK_FILTER_REMOVE;
+    }
+    return GDK_FILTER_CONTINUE;
+}
+
+/*
+ * Waits until the server has read the last put from the shared segment,
+ * so that it can be overwritten. Other events stay queued for GDK.
+ */
+void WindowContextBase::wait_shm_completion(Display* display) {
+    if (shm_pending) {
+        XEvent xevent;
+        XIfEvent(display, &xevent, is_shm_completion, (XPointer) this);
+        shm_pending = false;
+    }
+}
+
+bool WindowContextBase::ensure_shm_image(jint width, jint height) {
+    if (!shm_enabled) {
+        destroy_shm_image();
+        return false;
+    }
+    if (shm_image != NULL) {
+        if (shm_image->width == width && shm_image->height == height) {
+            return true;
+        }
+        destroy_shm_image();
+    }
+    if (shm_supported == 0 || gdk_window == NULL) {
+        return false;
+    }
+
+    GdkDisplay *gdk_display = gdk_window_get_display(gdk_window);
+    Display *display = GDK_DISPLAY_XDISPLAY(gdk_display);
+    if (shm_supported < 0) {
+        shm_supported = XShmQueryExtension(display) ? 1 : 0;
+        if (!shm_supported) {
+            return false;
+        }
+        shm_completion_type = XShmGetEventBase(display) + ShmCompletion;
+    }
+
+    // The pixels are premultiplied ARGB in native byte order, which a 24 or
+    // 32 bit TrueColor visual with the usual masks takes without conversion
+    GdkVisual *visual = gdk_window_get_visual(gdk_window);
+    int depth = gdk_visual_get_depth(visual);
+    Visual *xvisual = gdk_x11_visual_get_xvisual(visual);
+    if (gdk_window_get_scale_factor(gdk_window) != 1 ||
+        (depth != 24 && depth != 32) ||
+        xvisual->red_mask != 0xff0000 ||
+        xvisual->green_mask != 0xff00 ||
+        xvisual->blue_mask != 0xff) {
+        return false;
+    }
+
+    XImage *image = XShmCreateImage(display, xvisual, depth, ZPixmap, NULL,
+                                    &shm_info, width, height);
+    if (image == NULL) {
+        return false;
+    }
+    if (image->bits_per_pixel != 32 ||
+        image->byte_order != (G_BYTE_ORDER == G_LITTLE_ENDIAN ? LSBFirst : MSBFirst)) {
+        XDestroyImage(image);
+        return false;
+    }
+
+    shm_info.shmid = shmget(IPC_PRIVATE, (size_t)image->bytes_per_line * image->height,
+                            IPC_CREAT | 0600);
+    if (shm_info.shmid < 0) {
+        XDestroyImage(image);
+        return false;
+    }
+    shm_info.shmaddr = (char *)shmat(shm_info.shmid, NULL, 0);
+    if (shm_info.shmaddr == (char *)-1) {
+        shmctl(shm_info.shmid, IPC_RMID, NULL);
+        XDestroyImage(image);
+        return false;
+    }
+    shm_info.readOnly = False;
+
+    gdk_x11_display_error_trap_push(gdk_display);
+    Status attached = XShmAttach(display, &shm_info);
+    XSync(display, False);
+    bool failed = gdk_x11_display_error_trap_pop(gdk_display) != 0 || !attached;
+
+    // The segment goes away once both sides have detached from it
+    shmctl(shm_info.shmid, IPC_RMID, NULL);
+
+    if (failed) {
+        shmdt(shm_info.shmaddr);
+        XDestroyImage(image);
+        shm_supported = 0;
+        return false;
+    }
+
+    image->data = shm_info.shmaddr;
+    shm_image = image;
+    shm_gc = XCreateGC(display, GDK_WINDOW_XID(gdk_window), 0, NULL);
+    gdk_window_add_filter(NULL, filter_shm_completion, this);
+    return true;
+}
+
+void WindowContextBase::destroy_shm_image() {
+    if (shm_image == NULL) {
+        return;
+    }
+    Display *display = GDK_DISPLAY_XDISPLAY(gdk_window_get_display(gdk_window));
+    gdk_window_remove_filter(NULL, filter_shm_completion, this);
+    // The server reads the segment before it handles the detach
+    XShmDetach(display, &shm_info);
+    XSync(display, False);
+    shm_pending = false;
+    if (shm_gc != NULL) {
+        XFreeGC(display, shm_gc);
+        shm_gc = NULL;
+    }
+    shmdt(shm_info.shmaddr);
+    // The data belongs to the shared segment, not to Xlib
+    shm_image->data = NULL;
+    XDestroyImage(shm_image);
+    shm_image = NULL;
+}
+
+/*
+ * Presents the dirty rectangle of the uploaded pixels, which hold the
+ * whole frame. Returns the number of pixel bytes sent to the X server.
+ */
+jlong WindowContextBase::paint(void* data, jint width, jint height,
+                               jint dirtyX, jint dirtyY, jint dirtyWidth, jint dirtyHeight) {
+    jint x0 = MAX(dirtyX, 0);
+    jint y0 = MAX(dirtyY, 0);
+    jint x1 = MIN(dirtyX + dirtyWidth, width);
+    jint y1 = MIN(dirtyY + dirtyHeight, height);
+    if (x1 <= x0 || y1 <= y0) {
+        return 0;
+    }
+    jint w = x1 - x0;
+    jint h = y1 - y0;
+
+    applyShapeMask(data, width, height);
+
+    if (ensure_shm_image(width, height)) {
+        Display *display = GDK_DISPLAY_XDISPLAY(gdk_window_get_display(gdk_window));
+        wait_shm_completion(display);
+        char *src = (char *)data + ((size_t)y0 * width + x0) * 4;
+        char *dst = shm_image->data + (size_t)y0 * shm_image->bytes_per_line + x0 * 4;
+        for (jint y = 0; y < h; y++) {
+            memcpy(dst, src, (size_t)w * 4);
+            src += (size_t)width * 4;
+            dst += shm_image->bytes_per_line;
+        }
+        // The completion event tells when the segment can be written again
+        XShmPutImage(display, GDK_WINDOW_XID(gdk_window), shm_gc, shm_image,
+                     x0, y0, x0, y0, w, h, True);
+        XFlush(display);
+        shm_pending = true;
+        return (jlong)w * h * 4;
+    }
+
 #ifdef GLASS_GTK3
-    cairo_rectangle_int_t rect = {0, 0, width, height};
+    cairo_rectangle_int_t rect = {x0, y0, w, h};
     cairo_region_t *region = cairo_region_create_rectangle(&rect);
     gdk_window_begin_paint_region(gdk_window, region);
 #endif
@@ -517,11 +713,10 @@ void WindowContextBase::paint(void* data, jint width, jint height) {
             CAIRO_FORMAT_ARGB32,
             width, height, width * 4);
 
-    applyShapeMask(data, width, height);
-
     cairo_set_source_surface(context, cairo_surface, 0, 0);
     cairo_set_operator(context, CAIRO_OPERATOR_SOURCE);
-    cairo_paint(context);
+    cairo_rectangle(context, x0, y0, w, h);
+    cairo_fill(context);
 
 #ifdef GLASS_GTK3
     gdk_window_end_paint(gdk_window);
@@ -530,6 +725,7 @@ void WindowContextBase::paint(void* data, jint width, jint height) {
 
     cairo_destroy(context);
     cairo_surface_destroy(cairo_surface);
+    return (jlong)w * h * 4;
 }
 
 void WindowContextBase::add_child(WindowContextTop* child) {
@@ -673,6 +869,7 @@ bool WindowContextBase::get_window_edge(int x, int y, GdkWindowEdge* window_edge
 }
 
 WindowContextBase::~WindowContextBase() {
+    destroy_shm_image();
     disableIME();
     gtk_widget_destroy(gtk_widget);
 }
@@ -27,6 +27,7 @@
 
 #include <gtk/gtk.h>
 #include <X11/Xlib.h>
+#include <X11/extensions/XShm.h>
 
 #include <jni.h>
 #include <set>
@@ -109,7 +110,8 @@ public:
     virtual void setOnPreEdit(bool) = 0;
     virtual void commitIME(gchar *) = 0;
 
-    virtual void paint(void* data, jint width, jint height) = 0;
+    virtual jlong paint(void* data, jint width, jint height,
+                        jint dirtyX, jint dirtyY, jint dirtyWidth, jint dirtyHeight) = 0;
     virtual WindowGeometry get_geometry() = 0;
 
     virtual void show_system_menu(int x, int y) = 0;
@@ -151,7 +153,7 @@ public:
     virtual void process_expose(GdkEventExpose*) = 0;
     virtual void process_mouse_button(GdkEventButton*, bool synthesized = false) = 0;
     virtual void process_mouse_motion(GdkEventMotion*) = 0;
-    virtual void process_mouse_scroll(GdkEventScroll*) = 0;
+    virtual void process_mouse_scroll(GdkEventScroll*, bool merged) = 0;
     virtual void process_mouse_cross(GdkEventCrossing*) = 0;
     virtual void process_key(GdkEventKey*) = 0;
     virtual void process_state(GdkEventWindowState*) = 0;
@@ -206,6 +208,16 @@ protected:
     bool is_mouse_entered;
     bool is_disabled;
 
+    /*
+     * MIT-SHM image the software pipeline presents through, kept while the
+     * size of the uploaded pixels stays the same.
+     */
+    XImage* shm_image = NULL;
+    XShmSegmentInfo shm_info;
+    GC shm_gc = NULL;
+    // Whether the server may still be reading the last XShmPutImage
+    bool shm_pending = false;
+
     /*
      * sm_grab_window points to WindowContext holding a mouse grab.
      * It is mostly used for popup windows.
@@ -233,7 +245,8 @@ public:
     void commitIME(gchar *);
     void updateCaretPos();
     void disableIME();
-    void paint(void*, jint, jint);
+    jlong paint(void*, jint, jint, jint, jint, jint, jint);
+    static void set_shm_enabled(bool);
     GdkWindow *get_gdk_window();
     jobject get_jwindow();
     jobject get_jview();
@@ -259,7 +272,7 @@ public:
     void process_expose(GdkEventExpose*);
     void process_mouse_button(GdkEventButton*, bool synthesized = false);
     void process_mouse_motion(GdkEventMotion*);
-    void process_mouse_scroll(GdkEventScroll*);
+    void process_mouse_scroll(GdkEventScroll*, bool merged);
     void process_mouse_cross(GdkEventCrossing*);
     void process_key(GdkEventKey*);
     void process_state(GdkEventWindowState*);
@@ -275,6 +288,12 @@ public:
     ~WindowContextBase();
 protected:
     virtual void applyShapeMask(void*, uint width, uint height) = 0;
+private:
+    bool ensure_shm_image(jint width, jint height);
+    void destroy_shm_image();
+    void wait_shm_completion(Display*);
+    static Bool is_shm_completion(Display*, XEvent*, XPointer);
+    static GdkFilterReturn filter_shm_completion(GdkXEvent*, GdkEvent*, gpointer);
 };
 
 class WindowContextTop: public WindowContextBase {
@@ -0,0 +1,286 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "com_sun_glass_ui_monocle_Compositor.h"
+#include "Monocle.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define COMPOSITOR_NEON
+#endif
+
+/*
+ * Pixel operations of the software framebuffer screens. All pixels are
+ * 32-bit premultiplied ARGB in native byte order, that is BGRA in memory on
+ * the little-endian systems Monocle runs on. Offsets and strides are in
+ * bytes.
+ */
+
+/* Exact x / 255, rounded to nearest, for x in 0 .. 255 * 255 */
+#define DIV255(x) ((((x) + 128) + (((x) + 128) >> 8)) >> 8)
+
+/*
+ * Source-over of one premultiplied pixel, with the source scaled by
+ * alpha / 256. Framebuffer.blend32 computes the same in Java.
+ */
+static inline uint32_t blendPixel(uint32_t src, uint32_t dst, uint32_t alpha) {
+    uint32_t srcA = (((src >> 24) & 0xff) * alpha) >> 8;
+    uint32_t inv = 255 - srcA;
+    uint32_t result = 0;
+    int shift;
+    for (shift = 0; shift < 32; shift += 8) {
+        uint32_t s = (((src >> shift) & 0xff) * alpha) >> 8;
+        uint32_t d = (dst >> shift) & 0xff;
+        uint32_t c = s + DIV255(d * inv);
+        result |= (c > 255 ? 255 : c) << shift;
+    }
+    return result;
+}
+
+static void blendRow(const uint32_t *src, uint32_t *dst, int width, uint32_t alpha) {
+    int x = 0;
+#if defined(__SSE2__)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i a16 = _mm_set1_epi16((short) alpha);
+    const __m128i c255 = _mm_set1_epi16(255);
+    const __m128i c128 = _mm_set1_epi16(128);
+    for (; x + 4 <= width; x += 4) {
+        __m128i s = _mm_loadu_si128((const __m128i *) (src + x));
+        __m128i d = _mm_loadu_si128((const __m128i *) (dst + x));
+        __m128i half[2];
+        int i;
+        for (i = 0; i < 2; i++) {
+            __m128i s16 = i == 0 ? _mm_unpacklo_epi8(s, zero) : _mm_unpackhi_epi8(s, zero);
+            __m128i d16 = i == 0 ? _mm_unpacklo_epi8(d, zero) : _mm_unpackhi_epi8(d, zero);
+            s16 = _mm_srli_epi16(_mm_mullo_epi16(s16, a16), 8);
+            // Alpha is the fourth 16-bit lane of each pixel
+            __m128i sa = _mm_shufflehi_epi16(_mm_shufflelo_epi16(s16, 0xff), 0xff);
+            __m128i t = _mm_add_epi16(_mm_mullo_epi16(d16, _mm_sub_epi16(c255, sa)), c128);
+            t = _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+            half[i] = _mm_adds_epu16(s16, t);
+        }
+        _mm_storeu_si128((__m128i *) (dst + x), _mm_packus_epi16(half[0], half[1]));
+    }
+#elif defined(COMPOSITOR_NEON)
+    const uint16x8_t c255 = vdupq_n_u16(255);
+    for (; x + 8 <= width; x += 8) {
+        uint8x8x4_t s = vld4_u8((const uint8_t *) (src + x));
+        uint8x8x4_t d = vld4_u8((const uint8_t *) (dst + x));
+        uint8x8x4_t out;
+        uint16x8_t sa = vshrq_n_u16(vmulq_n_u16(vmovl_u8(s.val[3]), (uint16_t) alpha), 8);
+        uint16x8_t inv = vsubq_u16(c255, sa);
+        int i;
+        for (i = 0; i < 4; i++) {
+            uint16x8_t s16 = vshrq_n_u16(vmulq_n_u16(vmovl_u8(s.val[i]), (uint16_t) alpha), 8);
+            uint16x8_t t = vaddq_u16(vmulq_u16(vmovl_u8(d.val[i]), inv), vdupq_n_u16(128));
+            t = vshrq_n_u16(vaddq_u16(t, vshrq_n_u16(t, 8)), 8);
+            out.val[i] = vqmovn_u16(vqaddq_u16(s16, t));
+        }
+        vst4_u8((uint8_t *) (dst + x), out);
+    }
+#endif
+    for (; x < width; x++) {
+        dst[x] = blendPixel(src[x], dst[x], alpha);
+    }
+}
+
+/* 4x4 ordered dither matrix, in 1/16 steps of the quantization interval */
+static const uint8_t bayer4[4][4] = {
+    {  0,  8,  2, 10 },
+    { 12,  4, 14,  6 },
+    {  3, 11,  1,  9 },
+    { 15,  7, 13,  5 }
+};
+
+/*
+ * Adds the dither offset for a quantization step of the given size to an
+ * 8-bit component.
+ */
+static inline uint32_t ditherComponent(uint32_t c, uint32_t offset, uint32_t step) {
+    c += (offset * step) >> 4;
+    return c > 255 ? 255 : c;
+}
+
+static void convertRow565(const uint32_t *src, uint16_t *dst, int width, int x0, int y, jboolean dither) {
+    int x = 0;
+    if (dither) {
+        const uint8_t *row = bayer4[y & 3];
+        for (; x < width; x++) {
+            uint32_t p = src[x];
+            uint32_t o = row[(x0 + x) & 3];
+            uint32_t r = ditherComponent((p >> 16) & 0xff, o, 8);
+            uint32_t g = ditherComponent((p >> 8) & 0xff, o, 4);
+            uint32_t b = ditherComponent(p & 0xff, o, 8);
+            dst[x] = (uint16_t) (((r << 8) & 0xf800) | ((g << 3) & 0x07e0) | (b >> 3));
+        }
+        return;
+    }
+#if defined(__SSE2__)
+    const __m128i maskR = _mm_set1_epi32(0xf800);
+    const __m128i maskG = _mm_set1_epi32(0x07e0);
+    const __m128i maskB = _mm_set1_epi32(0x001f);
+    for (; x + 8 <= width; x += 8) {
+        __m128i p0 = _mm_loadu_si128((const __m128i *) (src + x));
+        __m128i p1 = _mm_loadu_si128((const __m128i *) (src + x + 4));
+        __m128i q0 = _mm_or_si128(_mm_or_si128(
+                _mm_and_si128(_mm_srli_epi32(p0, 8), maskR),
+                _mm_and_si128(_mm_srli_epi32(p0, 5), maskG)),
+                _mm_and_si128(_mm_srli_epi32(p0, 3), maskB));
+        __m128i q1 = _mm_or_si128(_mm_or_si128(
+                _mm_and_si128(_mm_srli_epi32(p1, 8), maskR),
+                _mm_and_si128(_mm_srli_epi32(p1, 5), maskG)),
+                _mm_and_si128(_mm_srli_epi32(p1, 3), maskB));
+        // Sign-extend the 16-bit values so that the signed pack keeps them
+        q0 = _mm_srai_epi32(_mm_slli_epi32(q0, 16), 16);
+        q1 = _mm_srai_epi32(_mm_slli_epi32(q1, 16), 16);
+        _mm_storeu_si128((__m128i *) (dst + x), _mm_packs_epi32(q0, q1));
+    }
+#elif defined(COMPOSITOR_NEON)
+    for (; x + 8 <= width; x += 8) {
+        uint8x8x4_t p = vld4_u8((const uint8_t *) (src + x));
+        uint16x8_t r = vshll_n_u8(vshr_n_u8(p.val[2], 3), 8);
+        uint16x8_t g = vshll_n_u8(vshr_n_u8(p.val[1], 2), 5);
+        uint16x8_t b = vmovl_u8(vshr_n_u8(p.val[0], 3));
+        vst1q_u16(dst + x, vorrq_u16(vorrq_u16(r, g), b));
+    }
+#endif
+    for (; x < width; x++) {
+        uint32_t p = src[x];
+        dst[x] = (uint16_t) (((p >> 8) & 0xf800) | ((p >> 5) & 0x07e0) | ((p >> 3) & 0x001f));
+    }
+}
+
+/*
+ * Rec. 709 luma in 16-bit fixed point. FramebufferY8 computes the same in
+ * Java.
+ */
+#define LUMA_R 13933
+#define LUMA_G 46871
+#define LUMA_B 4732
+
+static void convertRowY8(const uint32_t *src, uint8_t *dst, int width, int x0, int y, jboolean dither) {
+    int x = 0;
+    if (dither) {
+        // The panels this is for show 16 levels of gray
+        const uint8_t *row = bayer4[y & 3];
+        for (; x < width; x++) {
+            uint32_t p = src[x];
+            uint32_t luma = (LUMA_R * ((p >> 16) & 0xff) + LUMA_G * ((p >> 8) & 0xff)
+                    + LUMA_B * (p & 0xff)) >> 16;
+            dst[x] = (uint8_t) ditherComponent(luma, row[(x0 + x) & 3], 16);
+        }
+        return;
+    }
+#if defined(COMPOSITOR_NEON)
+    for (; x + 8 <= width; x += 8) {
+        uint8x8x4_t p = vld4_u8((const uint8_t *) (src + x));
+        uint32x4_t lo = vmull_n_u16(vget_low_u16(vmovl_u8(p.val[2])), LUMA_R);
+        uint32x4_t hi = vmull_n_u16(vget_high_u16(vmovl_u8(p.val[2])), LUMA_R);
+        lo = vmlal_n_u16(lo, vget_low_u16(vmovl_u8(p.val[1])), LUMA_G);
+        hi = vmlal_n_u16(hi, vget_high_u16(vmovl_u8(p.val[1])), LUMA_G);
+        lo = vmlal_n_u16(lo, vget_low_u16(vmovl_u8(p.val[0])), LUMA_B);
+        hi = vmlal_n_u16(hi, vget_high_u16(vmovl_u8(p.val[0])), LUMA_B);
+        vst1_u8(dst + x, vmovn_u16(vcombine_u16(vshrn_n_u32(lo, 16), vshrn_n_u32(hi, 16))));
+    }
+#endif
+    // GCC vectorizes this loop for SSE2 by itself
+    for (; x < width; x++) {
+        uint32_t p = src[x];
+        dst[x] = (uint8_t) ((LUMA_R * ((p >> 16) & 0xff) + LUMA_G * ((p >> 8) & 0xff)
+                + LUMA_B * (p & 0xff)) >> 16);
+    }
+}
+
+/*
+ * Class:     com_sun_glass_ui_monocle_Compositor
+ * Method:    isSupported
+ * Signature: ()Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_sun_glass_ui_monocle_Compositor_isSupported
+  (JNIEnv *UNUSED(env), jclass UNUSED(clazz)) {
+    return JNI_TRUE;
+}
+
+/*
+ * Class:     com_sun_glass_ui_monocle_Compositor
+ * Method:    blend
+ * Signature: (Ljava/nio/ByteBuffer;IILjava/nio/Buffer;IIIII)V
+ */
+JNIEXPORT void JNICALL Java_com_sun_glass_ui_monocle_Compositor_blend
+  (JNIEnv *env, jclass UNUSED(clazz), jobject dstBuffer, jint dstOffset, jint dstStride,
+   jobject srcBuffer, jint srcOffset, jint srcStride, jint width, jint height, jint alpha) {
+    uint8_t *dst = (uint8_t *) (*env)->GetDirectBufferAddress(env, dstBuffer);
+    uint8_t *src = (uint8_t *) (*env)->GetDirectBufferAddress(env, srcBuffer);
+    int y;
+    if (dst == NULL || src == NULL) {
+        return;
+    }
+    dst += dstOffset;
+    src += srcOffset;
+    for (y = 0; y < height; y++) {
+        blendRow((const uint32_t *) (src + (size_t) y * srcStride),
+                 (uint32_t *) (dst + (size_t) y * dstStride),
+                 width, (uint32_t) alpha);
+    }
+}
+
+/*
+ * Class:     com_sun_glass_ui_monocle_Compositor
+ * Method:    convert
+ * Signature: (Ljava/nio/ByteBuffer;IIILjava/nio/ByteBuffer;IIIIIIZ)V
+ */
+JNIEXPORT void JNICALL Java_com_sun_glass_ui_monocle_Compositor_convert
+  (JNIEnv *env, jclass UNUSED(clazz), jobject dstBuffer, jint dstOffset, jint dstStride,
+   jint dstBytesPerPixel, jobject srcBuffer, jint srcOffset, jint srcStride,
+   jint x, jint y, jint width, jint height, jboolean dither) {
+    uint8_t *dst = (uint8_t *) (*env)->GetDirectBufferAddress(env, dstBuffer);
+    uint8_t *src = (uint8_t *) (*env)->GetDirectBufferAddress(env, srcBuffer);
+    int i;
+    if (dst == NULL || src == NULL) {
+        return;
+    }
+    dst += dstOffset;
+    src += srcOffset;
+    for (i = 0; i < height; i++) {
+        const uint32_t *srcRow = (const uint32_t *) (src + (size_t) i * srcStride);
+        uint8_t *dstRow = dst + (size_t) i * dstStride;
+        switch (dstBytesPerPixel) {
+            case 1:
+                convertRowY8(srcRow, dstRow, width, x, y + i, dither);
+                break;
+            case 2:
+                convertRow565(srcRow, (uint16_t *) dstRow, width, x, y + i, dither);
+                break;
+            case 4:
+                memcpy(dstRow, srcRow, (size_t) width * 4);
+                break;
+        }
+    }
+}
@@ -0,0 +1,295 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "com_sun_glass_ui_monocle_LinuxInputReader.h"
+#include "Monocle.h"
+
+#include <errno.h>
+#include <linux/input.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <unistd.h>
+
+/*
+ * Reads all evdev devices on one thread. Events are split into frames at
+ * SYN_REPORT, frames cut short by SYN_DROPPED are discarded, and repeated
+ * axis events within a frame are merged. Complete frames are written to a
+ * direct buffer shared with LinuxInputReader.java as a header of two ints,
+ * the device id and the number of events, followed by the events as a
+ * short type, short code and int value. A count of -1 reports that the
+ * device was disconnected.
+ */
+
+#define MAX_PENDING_EVENTS 256
+#define MAX_READY_DEVICES 16
+#define HEADER_SIZE 8
+#define EVENT_SIZE 8
+/* Room kept at the end of the buffer to report removed devices */
+#define REMOVAL_RESERVE (MAX_READY_DEVICES * HEADER_SIZE)
+
+typedef struct ReaderDevice {
+    int fd;
+    jint id;
+    /* Events read from the device and not yet written to Java */
+    struct input_event pending[MAX_PENDING_EVENTS];
+    int count;
+    /* Set after SYN_DROPPED until the next SYN_REPORT */
+    int dropping;
+    /* Set when complete frames did not fit in the output buffer */
+    int backlog;
+    struct ReaderDevice *nextBacklog;
+} ReaderDevice;
+
+typedef struct {
+    int epfd;
+    /* Devices with frames left over from the last call, in arrival order */
+    ReaderDevice *backlogHead;
+    ReaderDevice *backlogTail;
+} Reader;
+
+typedef struct {
+    uint8_t *data;
+    jint position;
+    /* The limit for frames, short of the capacity by REMOVAL_RESERVE */
+    jint limit;
+} Output;
+
+static void putInt(Output *out, jint value) {
+    memcpy(out->data + out->position, &value, sizeof(jint));
+    out->position += sizeof(jint);
+}
+
+static void putEvent(uint8_t *p, uint16_t type, uint16_t code, int32_t value) {
+    memcpy(p, &type, sizeof(type));
+    memcpy(p + 2, &code, sizeof(code));
+    memcpy(p + 4, &value, sizeof(value));
+}
+
+/*
+ * Writes one frame with repeated EV_ABS and EV_REL events merged. Relative
+ * motion is summed and the last absolute value wins. Merging restarts after
+ * every key, sync or slot event, so that touch points and button presses
+ * keep their order.
+ */
+static void writeFrame(Output *out, jint id, const struct input_event *events, int n) {
+    jint headerPosition = out->position;
+    uint8_t *first;
+    int segment = 0;
+    int count = 0;
+    int i;
+    putInt(out, id);
+    putInt(out, 0);
+    first = out->data + out->position;
+    for (i = 0; i < n; i++) {
+        const struct input_event *ev = &events[i];
+        int merged = 0;
+        if (ev->type == EV_ABS || ev->type == EV_REL) {
+            int j;
+            for (j = segment; j < count; j++) {
+                uint8_t *p = first + j * EVENT_SIZE;
+                uint16_t type, code;
+                int32_t value;
+                memcpy(&type, p, sizeof(type));
+                memcpy(&code, p + 2, sizeof(code));
+                if (type == ev->type && code == ev->code) {
+                    memcpy(&value, p + 4, sizeof(value));
+                    value = ev->type == EV_REL ? value + ev->value : ev->value;
+                    memcpy(p + 4, &value, sizeof(value));
+                    merged = 1;
+                    break;
+                }
+            }
+        }
+        if (merged) {
+            continue;
+        }
+        if (ev->type != EV_ABS && ev->type != EV_REL) {
+            segment = count + 1;
+        } else if (ev->type == EV_ABS && ev->code == ABS_MT_SLOT) {
+            segment = count + 1;
+        }
+        putEvent(first + count * EVENT_SIZE, ev->type, ev->code, ev->value);
+        count++;
+    }
+    memcpy(out->data + headerPosition + sizeof(jint), &count, sizeof(jint));
+    out->position += count * EVENT_SIZE;
+}
+
+/*
+ * Writes the complete frames pending on the device. Returns 0 if the output
+ * buffer filled up before all of them were written.
+ */
+static int writeFrames(ReaderDevice *dev, Output *out) {
+    int start = 0;
+    int i;
+    int complete = 1;
+    for (i = 0; i < dev->count; i++) {
+        const struct input_event *ev = &dev->pending[i];
+        if (ev->type != EV_SYN) {
+            continue;
+        }
+        if (ev->code == SYN_DROPPED) {
+            // The kernel buffer overflowed: drop the partial frame and
+            // everything up to the next SYN_REPORT
+            dev->dropping = 1;
+            start = i + 1;
+        } else if (ev->code == SYN_REPORT) {
+            int n = i + 1 - start;
+            if (dev->dropping) {
+                dev->dropping = 0;
+            } else if (out->limit - out->position < HEADER_SIZE + n * EVENT_SIZE) {
+                complete = 0;
+                break;
+            } else {
+                writeFrame(out, dev->id, &dev->pending[start], n);
+            }
+            start = i + 1;
+        }
+    }
+    if (start == 0 && dev->count == MAX_PENDING_EVENTS) {
+        // A frame too long to buffer is treated as dropped
+        dev->dropping = 1;
+        start = dev->count;
+    }
+    dev->count -= start;
+    memmove(dev->pending, &dev->pending[start], dev->count * sizeof(struct input_event));
+    return complete;
+}
+
+static void addBacklog(Reader *reader, ReaderDevice *dev) {
+    dev->backlog = 1;
+    dev->nextBacklog = NULL;
+    if (reader->backlogTail == NULL) {
+        reader->backlogHead = dev;
+    } else {
+        reader->backlogTail->nextBacklog = dev;
+    }
+    reader->backlogTail = dev;
+}
+
+JNIEXPORT jlong JNICALL Java_com_sun_glass_ui_monocle_LinuxInputReader__1open
+  (JNIEnv *UNUSED(env), jclass UNUSED(cls)) {
+    Reader *reader = calloc(1, sizeof(Reader));
+    if (reader == NULL) {
+        return 0l;
+    }
+    reader->epfd = epoll_create1(EPOLL_CLOEXEC);
+    if (reader->epfd == -1) {
+        free(reader);
+        return 0l;
+    }
+    return asJLong(reader);
+}
+
+JNIEXPORT jboolean JNICALL Java_com_sun_glass_ui_monocle_LinuxInputReader__1addDevice
+  (JNIEnv *UNUSED(env), jclass UNUSED(cls), jlong readerL, jlong fdL, jint id) {
+    Reader *reader = (Reader *) asPtr(readerL);
+    ReaderDevice *dev = calloc(1, sizeof(ReaderDevice));
+    struct epoll_event ev;
+    if (dev == NULL) {
+        return JNI_FALSE;
+    }
+    dev->fd = (int) fdL;
+    dev->id = id;
+    memset(&ev, 0, sizeof(ev));
+    ev.events = EPOLLIN;
+    ev.data.ptr = dev;
+    if (epoll_ctl(reader->epfd, EPOLL_CTL_ADD, dev->fd, &ev) == -1) {
+        free(dev);
+        return JNI_FALSE;
+    }
+    return JNI_TRUE;
+}
+
+/*
+ * Waits for input on any device and writes the complete frames read to the
+ * buffer. Returns the number of bytes written, or -1 on error.
+ */
+JNIEXPORT jint JNICALL Java_com_sun_glass_ui_monocle_LinuxInputReader__1read
+  (JNIEnv *env, jclass UNUSED(cls), jlong readerL, jobject buffer) {
+    Reader *reader = (Reader *) asPtr(readerL);
+    struct epoll_event events[MAX_READY_DEVICES];
+    ReaderDevice *dev = reader->backlogHead;
+    Output out;
+    int n, i;
+
+    out.data = (*env)->GetDirectBufferAddress(env, buffer);
+    out.limit = (jint) (*env)->GetDirectBufferCapacity(env, buffer) - REMOVAL_RESERVE;
+    out.position = 0;
+    if (out.data == NULL || out.limit <= 0) {
+        return -1;
+    }
+
+    // Frames left over from the last call go first
+    reader->backlogHead = NULL;
+    reader->backlogTail = NULL;
+    while (dev != NULL) {
+        ReaderDevice *next = dev->nextBacklog;
+        dev->backlog = 0;
+        if (!writeFrames(dev, &out)) {
+            addBacklog(reader, dev);
+        }
+        dev = next;
+    }
+
+    do {
+        n = epoll_wait(reader->epfd, events, MAX_READY_DEVICES,
+                       out.position > 0 || reader->backlogHead != NULL ? 0 : -1);
+    } while (n == -1 && errno == EINTR);
+    if (n == -1) {
+        return -1;
+    }
+
+    for (i = 0; i < n; i++) {
+        ssize_t bytes;
+        dev = (ReaderDevice *) events[i].data.ptr;
+        if (dev->backlog) {
+            // Read more once the pending frames are written
+            continue;
+        }
+        do {
+            bytes = read(dev->fd, &dev->pending[dev->count],
+                         (MAX_PENDING_EVENTS - dev->count) * sizeof(struct input_event));
+        } while (bytes == -1 && errno == EINTR);
+        if (bytes == -1 && errno == EAGAIN) {
+            continue;
+        }
+        if (bytes <= 0) {
+            // The device was removed. Java closes the file descriptor.
+            epoll_ctl(reader->epfd, EPOLL_CTL_DEL, dev->fd, NULL);
+            putInt(&out, dev->id);
+            putInt(&out, -1);
+            free(dev);
+            continue;
+        }
+        dev->count += (int) (bytes / sizeof(struct input_event));
+        if (!writeFrames(dev, &out)) {
+            addBacklog(reader, dev);
+        }
+    }
+    return out.position;
+}
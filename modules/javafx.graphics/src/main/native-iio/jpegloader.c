@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -1246,7 +1246,7 @@ JNIEXPORT void JNICALL Java_com_sun_javafx_iio_jpeg_JPEGImageLoader_initJPEGMeth
     JPEGImageLoader_setOutputAttributesID = (*env)->GetMethodID(env,
             cls,
             "setOutputAttributes",
-            "(II)V");
+            "(III)V");
     if ((*env)->ExceptionCheck(env)) {
         return;
     }
@@ -1275,6 +1275,11 @@ JNIEXPORT void JNICALL Java_com_sun_javafx_iio_jpeg_JPEGImageLoader_disposeNativ
     disposeIIO(env, data);
 }
 
+JNIEXPORT jboolean JNICALL Java_com_sun_javafx_iio_jpeg_JPEGImageLoader_setSSE2Enabled
+(JNIEnv *env, jclass cls, jboolean enabled) {
+    return jpeg_enable_sse2(enabled == JNI_TRUE) ? JNI_TRUE : JNI_FALSE;
+}
+
 #define JPEG_APP1  (JPEG_APP0 + 1)  /* EXIF APP1 marker code  */
 
 /*
@@ -1532,9 +1537,7 @@ JNIEXPORT jint JNICALL Java_com_sun_javafx_iio_jpeg_JPEGImageLoader_startDecompr
     struct jpeg_source_mgr *src = cinfo->src;
     sun_jpeg_error_ptr jerr;
 
-    jfloat x_scale;
-    jfloat y_scale;
-    jfloat max_scale;
+    unsigned int scale_num;
 
     if (GET_ARRAYS(env, data, &cinfo->src->next_input_byte) == NOT_OK) {
         ThrowByName(env,
@@ -1563,34 +1566,28 @@ JNIEXPORT jint JNICALL Java_com_sun_javafx_iio_jpeg_JPEGImageLoader_startDecompr
 
     cinfo->out_color_space = outCS;
 
-    /* decide how much we want to sub-sample the incoming jpeg image.
-     * The libjpeg docs say:
-     *
-     *     unsigned int scale_num, scale_denom
-     *
-     *     Scale the image by the fraction scale_num/scale_denom.  Default is
-     *     1/1, or no scaling.  Currently, the only supported scaling ratios
-     *     are 1/1, 1/2, 1/4, and 1/8.  (The library design allows for arbitrary
-     *     scaling ratios but this is not likely to be implemented any time soon.)
-     *     Smaller scaling ratios permit significantly faster decoding since
-     *     fewer pixels need be processed and a simpler IDCT method can be used.
+    /* Decide how much we want to sub-sample the incoming jpeg image.
+     * libjpeg can scale by N/8 for any N from 1 to 16 directly in the
+     * inverse DCT, which is much cheaper than decoding at full size and
+     * resampling afterwards. Pick the smallest N/8 that still yields at
+     * least the requested size in both dimensions, so that any remaining
+     * resampling on the Java side only ever shrinks the image slightly.
+     * libjpeg rounds the scaled size up to ceil(size * N / 8), so that
+     * rounding is applied here as well.
      */
 
-    cinfo->scale_num = 1;
-
-    x_scale = (jfloat) dest_width / (jfloat) cinfo->image_width;
-    y_scale = (jfloat) dest_height / (jfloat) cinfo->image_height;
-    max_scale = x_scale > y_scale ? x_scale : y_scale;
-
-    if (max_scale > 0.5) {
-        cinfo->scale_denom = 1;
-    } else if (max_scale > 0.25) {
-        cinfo->scale_denom = 2;
-    } else if (max_scale > 0.125) {
-        cinfo->scale_denom = 4;
-    } else {
-        cinfo->scale_denom = 8;
+    scale_num = 8;
+    if (dest_width > 0 && dest_height > 0) {
+        for (scale_num = 1; scale_num < 8; scale_num++) {
+            if (((jlong) cinfo->image_width * scale_num + 7) / 8 >= dest_width &&
+                ((jlong) cinfo->image_height * scale_num + 7) / 8 >= dest_height)
+            {
+                break;
+            }
+        }
     }
+    cinfo->scale_num = scale_num;
+    cinfo->scale_denom = 8;
 
     jpeg_start_decompress(cinfo);
 
@@ -1598,7 +1595,8 @@ JNIEXPORT jint JNICALL Java_com_sun_javafx_iio_jpeg_JPEGImageLoader_startDecompr
     (*env)->CallVoidMethod(env, this,
             JPEGImageLoader_setOutputAttributesID,
             cinfo->output_width,
-            cinfo->output_height);
+            cinfo->output_height,
+            scale_num);
 
     return cinfo->output_components;
 }
@@ -1610,15 +1608,41 @@ JNIEXPORT jint JNICALL Java_com_sun_javafx_iio_jpeg_JPEGImageLoader_startDecompr
         (PTR) = NULL;     \
     }
 
+/*
+ * Scanlines are decoded in batches of about this many bytes (but at least
+ * one row group) before being copied into the destination array.
+ */
+#define SCANLINE_BATCH_BYTES (64 * 1024)
+
+/*
+ * Returns the first scanline after scanline at which another
+ * 1 / progress_updates of the image height has been decoded.
+ */
+static JDIMENSION next_progress_scanline(JDIMENSION scanline, JDIMENSION height,
+                                         jint progress_updates) {
+    long long k = (long long) scanline * progress_updates / height + 1;
+    return (JDIMENSION) ((k * height + progress_updates - 1) / progress_updates);
+}
+
+/*
+ * progress_updates is the number of evenly spaced progress reports the
+ * loader wants while the scanlines are decoded, 0 for none. Batches end
+ * on those scanlines, so each report is made exactly where its fraction
+ * of the image is reached. One more report follows the last scanline.
+ */
 JNIEXPORT jboolean JNICALL Java_com_sun_javafx_iio_jpeg_JPEGImageLoader_decompressIndirect
-(JNIEnv *env, jobject this, jlong ptr, jboolean report_progress, jbyteArray barray) {
+(JNIEnv *env, jobject this, jlong ptr, jint progress_updates, jbyteArray barray) {
     imageIODataPtr data = (imageIODataPtr) jlong_to_ptr(ptr);
     j_decompress_ptr cinfo = (j_decompress_ptr) data->jpegObj;
     struct jpeg_source_mgr *src = cinfo->src;
     sun_jpeg_error_ptr jerr;
     int bytes_per_row = cinfo->output_width * cinfo->output_components;
     int offset = 0;
+    int batch_rows;
+    int i;
+    JDIMENSION next_progress = 0;
     JSAMPROW scanline_ptr = NULL;
+    JSAMPARRAY scanline_rows = NULL;
 
     if (!SAFE_TO_MULT(cinfo->output_width, cinfo->output_components) ||
         !SAFE_TO_MULT(bytes_per_row, cinfo->output_height) ||
@@ -1651,32 +1675,60 @@ JNIEXPORT jboolean JNICALL Java_com_sun_javafx_iio_jpeg_JPEGImageLoader_decompre
             ThrowByName(env, "java/io/IOException", buffer);
         }
         SAFE_FREE(scanline_ptr);
+        SAFE_FREE(scanline_rows);
         RELEASE_ARRAYS(env, data, cinfo->src->next_input_byte);
         return JNI_FALSE;
     }
 
-    scanline_ptr = (JSAMPROW) malloc(bytes_per_row * sizeof(JSAMPLE));
-    if (scanline_ptr == NULL) {
+    /*
+     * The source manager calls back into Java to refill its buffer, so the
+     * destination array cannot stay pinned while decoding. Decode a batch
+     * of rows into a scratch buffer instead and copy the whole batch with
+     * a single pin.
+     */
+    batch_rows = SCANLINE_BATCH_BYTES / bytes_per_row;
+    batch_rows = MAX(batch_rows, cinfo->rec_outbuf_height);
+    batch_rows = MAX(batch_rows, 1);
+    if ((JDIMENSION) batch_rows > cinfo->output_height) {
+        batch_rows = cinfo->output_height;
+    }
+
+    scanline_ptr = (JSAMPROW) malloc(batch_rows * bytes_per_row * sizeof(JSAMPLE));
+    scanline_rows = (JSAMPARRAY) malloc(batch_rows * sizeof(JSAMPROW));
+    if (scanline_ptr == NULL || scanline_rows == NULL) {
+        SAFE_FREE(scanline_ptr);
+        SAFE_FREE(scanline_rows);
         RELEASE_ARRAYS(env, data, cinfo->src->next_input_byte);
         ThrowByName(env,
                 "java/lang/OutOfMemoryError",
                 "Reading JPEG Stream");
         return JNI_FALSE;
     }
+    for (i = 0; i < batch_rows; i++) {
+        scanline_rows[i] = scanline_ptr + i * bytes_per_row;
+    }
 
     while (cinfo->output_scanline < cinfo->output_height) {
-        int num_scanlines;
-        if (report_progress == JNI_TRUE) {
+        int num_scanlines = 0;
+        int max_scanlines = batch_rows;
+        if (progress_updates > 0 &&
+            cinfo->output_scanline >= next_progress)
+        {
+            next_progress = next_progress_scanline(cinfo->output_scanline,
+                                                   cinfo->output_height,
+                                                   progress_updates);
             RELEASE_ARRAYS(env, data, cinfo->src->next_input_byte);
             (*env)->CallVoidMethod(env, this,
                     JPEGImageLoader_updateImageProgressID,
                     cinfo->output_scanline);
             if ((*env)->ExceptionCheck(env)) {
                 SAFE_FREE(scanline_ptr);
+                SAFE_FREE(scanline_rows);
                 return JNI_FALSE;
             }
             if (GET_ARRAYS(env, data, &cinfo->src->next_input_byte) == NOT_OK) {
                 SAFE_FREE(scanline_ptr);
+                SAFE_FREE(scanline_rows);
                 ThrowByName(env,
                           "java/io/IOException",
                           "Array pin failed");
@@ -1684,23 +1736,40 @@ JNIEXPORT jboolean JNICALL Java_com_sun_javafx_iio_jpeg_JPEGImageLoader_decompre
             }
         }
 
-        num_scanlines = jpeg_read_scanlines(cinfo, &scanline_ptr, 1);
-        if (num_scanlines == 1) {
+        if (progress_updates > 0 &&
+            next_progress - cinfo->output_scanline < (JDIMENSION) max_scanlines)
+        {
+            max_scanlines = next_progress - cinfo->output_scanline;
+        }
+        while (num_scanlines < max_scanlines &&
+               cinfo->output_scanline < cinfo->output_height)
+        {
+            JDIMENSION n = jpeg_read_scanlines(cinfo,
+                                               scanline_rows + num_scanlines,
+                                               max_scanlines - num_scanlines);
+            if (n == 0) {
+                break;
+            }
+            num_scanlines += n;
+        }
+        if (num_scanlines > 0) {
             jbyte *body = (*env)->GetPrimitiveArrayCritical(env, barray, NULL);
             if (body == NULL) {
                 RELEASE_ARRAYS(env, data, cinfo->src->next_input_byte);
                 fprintf(stderr, "decompressIndirect: GetPrimitiveArrayCritical returns NULL: out of memory\n");
                 SAFE_FREE(scanline_ptr);
+                SAFE_FREE(scanline_rows);
                 return JNI_FALSE;
             }
-            memcpy(body+offset,scanline_ptr, bytes_per_row);
+            memcpy(body+offset, scanline_ptr, num_scanlines * bytes_per_row);
             (*env)->ReleasePrimitiveArrayCritical(env, barray, body, JNI_ABORT);
-            offset += bytes_per_row;
+            offset += num_scanlines * bytes_per_row;
         }
     }
     SAFE_FREE(scanline_ptr);
+    SAFE_FREE(scanline_rows);
 
-    if (report_progress == JNI_TRUE) {
+    if (progress_updates > 0) {
         RELEASE_ARRAYS(env, data, cinfo->src->next_input_byte);
         (*env)->CallVoidMethod(env, this,
                 JPEGImageLoader_updateImageProgressID,
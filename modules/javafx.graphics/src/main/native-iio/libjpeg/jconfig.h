@@ -101,3 +101,11 @@ typedef unsigned char boolean;
 
 #endif /* JPEG_CJPEG_DJPEG */
 #endif /* ! Win32 */
+
+/* JavaFX: use the SSE2 versions of jpeg_idct_islow and of the YCbCr->RGB
+ * color converter wherever SSE2 is part of the target instruction set.
+ */
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define JPEG_USE_SSE2
+#endif
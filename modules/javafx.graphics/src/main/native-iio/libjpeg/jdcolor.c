@@ -228,6 +228,139 @@ ycc_rgb_convert (j_decompress_ptr cinfo,
 }
 
 
+#if defined(JPEG_USE_SSE2) && BITS_IN_JSAMPLE == 8 && RGB_PIXELSIZE == 3
+#define YCC_RGB_SSE2
+
+#include <emmintrin.h>
+
+/*
+ * SSE2 version of ycc_rgb_convert for sYCC, added for JavaFX.
+ * Sixteen pixels are converted at a time with exactly the fixed-point
+ * arithmetic that build_ycc_rgb_table precomputes: each constant is split
+ * into a multiple of 2^16, applied to the integral part directly, and a
+ * remainder that fits a 16-bit multiply-add together with the rounding
+ * term.  The saturating packs then do the range-limiting.
+ * Leftover columns go through the tables as before.
+ */
+
+#define SSE2_PAIR(c0,c1)  _mm_set_epi16((short) (c1), (short) (c0), \
+                                        (short) (c1), (short) (c0), \
+                                        (short) (c1), (short) (c0), \
+                                        (short) (c1), (short) (c0))
+
+METHODDEF(void)
+ycc_rgb_convert_sse2 (j_decompress_ptr cinfo,
+              JSAMPIMAGE input_buf, JDIMENSION input_row,
+              JSAMPARRAY output_buf, int num_rows)
+{
+  my_cconvert_ptr cconvert = (my_cconvert_ptr) cinfo->cconvert;
+  register int y, cb, cr;
+  register JSAMPROW outptr;
+  register JSAMPROW inptr0, inptr1, inptr2;
+  register JDIMENSION col;
+  JDIMENSION num_cols = cinfo->output_width;
+  register JSAMPLE * range_limit = cinfo->sample_range_limit;
+  register int * Crrtab = cconvert->Cr_r_tab;
+  register int * Cbbtab = cconvert->Cb_b_tab;
+  register INT32 * Crgtab = cconvert->Cr_g_tab;
+  register INT32 * Cbgtab = cconvert->Cb_g_tab;
+  /* 1.402 = 1 + r, 1.772 = 2 - b, -0.714136286 = -1 + g */
+  const __m128i k_r = SSE2_PAIR(FIX(1.402) - ((INT32) 1 << SCALEBITS), ONE_HALF >> 1);
+  const __m128i k_b = SSE2_PAIR(FIX(1.772) - ((INT32) 2 << SCALEBITS), ONE_HALF >> 1);
+  const __m128i k_g = SSE2_PAIR(- FIX(0.344136286),
+                                ((INT32) 1 << SCALEBITS) - FIX(0.714136286));
+  const __m128i one_half = _mm_set1_epi32(ONE_HALF);
+  const __m128i two = _mm_set1_epi16(2);
+  const __m128i center = _mm_set1_epi16(CENTERJSAMPLE);
+  const __m128i zero = _mm_setzero_si128();
+  JSAMPLE rgbx[16 * 4];
+  int h, i;
+  SHIFT_TEMPS
+
+  while (--num_rows >= 0) {
+    inptr0 = input_buf[0][input_row];
+    inptr1 = input_buf[1][input_row];
+    inptr2 = input_buf[2][input_row];
+    input_row++;
+    outptr = *output_buf++;
+    for (col = 0; col + 16 <= num_cols; col += 16) {
+      __m128i y8 = _mm_loadu_si128((const __m128i *) (inptr0 + col));
+      __m128i cb8 = _mm_loadu_si128((const __m128i *) (inptr1 + col));
+      __m128i cr8 = _mm_loadu_si128((const __m128i *) (inptr2 + col));
+      __m128i r16[2], g16[2], b16[2];
+
+      for (h = 0; h < 2; h++) {
+        /* Pixels 8*h .. 8*h+7, with Cb and Cr less CENTERJSAMPLE */
+        __m128i y16 = h ? _mm_unpackhi_epi8(y8, zero)
+                        : _mm_unpacklo_epi8(y8, zero);
+        __m128i x_cb = _mm_sub_epi16(h ? _mm_unpackhi_epi8(cb8, zero)
+                                       : _mm_unpacklo_epi8(cb8, zero), center);
+        __m128i x_cr = _mm_sub_epi16(h ? _mm_unpackhi_epi8(cr8, zero)
+                                       : _mm_unpacklo_epi8(cr8, zero), center);
+        __m128i cr_2 = _mm_unpacklo_epi16(x_cr, two);
+        __m128i cr_2h = _mm_unpackhi_epi16(x_cr, two);
+        __m128i cb_2 = _mm_unpacklo_epi16(x_cb, two);
+        __m128i cb_2h = _mm_unpackhi_epi16(x_cb, two);
+        __m128i cb_cr = _mm_unpacklo_epi16(x_cb, x_cr);
+        __m128i cb_crh = _mm_unpackhi_epi16(x_cb, x_cr);
+        __m128i r, g, b;
+
+        r = _mm_packs_epi32(
+          _mm_srai_epi32(_mm_madd_epi16(cr_2, k_r), SCALEBITS),
+          _mm_srai_epi32(_mm_madd_epi16(cr_2h, k_r), SCALEBITS));
+        b = _mm_packs_epi32(
+          _mm_srai_epi32(_mm_madd_epi16(cb_2, k_b), SCALEBITS),
+          _mm_srai_epi32(_mm_madd_epi16(cb_2h, k_b), SCALEBITS));
+        g = _mm_packs_epi32(
+          _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(cb_cr, k_g), one_half),
+                         SCALEBITS),
+          _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(cb_crh, k_g), one_half),
+                         SCALEBITS));
+        r16[h] = _mm_add_epi16(_mm_add_epi16(y16, x_cr), r);
+        g16[h] = _mm_sub_epi16(_mm_add_epi16(y16, g), x_cr);
+        b16[h] = _mm_add_epi16(_mm_add_epi16(y16, _mm_add_epi16(x_cb, x_cb)), b);
+      }
+      {
+        /* Interleave into four-byte pixels, then drop the padding byte
+         * by letting each pixel's store overlap the next one.
+         */
+        __m128i r8 = _mm_packus_epi16(r16[0], r16[1]);
+        __m128i g8 = _mm_packus_epi16(g16[0], g16[1]);
+        __m128i b8 = _mm_packus_epi16(b16[0], b16[1]);
+        __m128i c0 = _mm_unpacklo_epi8(RGB_RED == 0 ? r8 : b8, g8);
+        __m128i c1 = _mm_unpackhi_epi8(RGB_RED == 0 ? r8 : b8, g8);
+        __m128i c2 = _mm_unpacklo_epi8(RGB_RED == 0 ? b8 : r8, zero);
+        __m128i c3 = _mm_unpackhi_epi8(RGB_RED == 0 ? b8 : r8, zero);
+
+        _mm_storeu_si128((__m128i *) (rgbx + 0), _mm_unpacklo_epi16(c0, c2));
+        _mm_storeu_si128((__m128i *) (rgbx + 16), _mm_unpackhi_epi16(c0, c2));
+        _mm_storeu_si128((__m128i *) (rgbx + 32), _mm_unpacklo_epi16(c1, c3));
+        _mm_storeu_si128((__m128i *) (rgbx + 48), _mm_unpackhi_epi16(c1, c3));
+        for (i = 0; i < 15; i++) {
+          MEMCOPY(outptr, rgbx + 4 * i, 4);
+          outptr += RGB_PIXELSIZE;
+        }
+        MEMCOPY(outptr, rgbx + 4 * 15, 3);
+        outptr += RGB_PIXELSIZE;
+      }
+    }
+    for (; col < num_cols; col++) {
+      y  = GETJSAMPLE(inptr0[col]);
+      cb = GETJSAMPLE(inptr1[col]);
+      cr = GETJSAMPLE(inptr2[col]);
+      outptr[RGB_RED]   = range_limit[y + Crrtab[cr]];
+      outptr[RGB_GREEN] = range_limit[y +
+                  ((int) RIGHT_SHIFT(Cbgtab[cb] + Crgtab[cr],
+                         SCALEBITS))];
+      outptr[RGB_BLUE]  = range_limit[y + Cbbtab[cb]];
+      outptr += RGB_PIXELSIZE;
+    }
+  }
+}
+
+#endif /* YCC_RGB_SSE2 */
+
+
 /**************** Cases other than YCC -> RGB ****************/
 
 
@@ -798,7 +931,12 @@ jinit_color_deconverter (j_decompress_ptr cinfo)
       cconvert->pub.color_convert = gray_rgb_convert;
       break;
     case JCS_YCbCr:
+#ifdef YCC_RGB_SSE2
+      cconvert->pub.color_convert = jpeg_use_sse2 ? ycc_rgb_convert_sse2
+                                                  : ycc_rgb_convert;
+#else
       cconvert->pub.color_convert = ycc_rgb_convert;
+#endif
       build_ycc_rgb_table(cinfo);
       break;
     case JCS_BG_YCC:
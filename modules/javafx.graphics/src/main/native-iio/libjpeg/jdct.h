@@ -130,6 +130,7 @@ typedef FAST_FLOAT FLOAT_MULT_TYPE; /* preferred floating type */
 #define jpeg_idct_islow        jRDislow
 #define jpeg_idct_ifast        jRDifast
 #define jpeg_idct_float        jRDfloat
+#define jpeg_idct_islow_sse2    jRDislowsse2
 #define jpeg_idct_7x7        jRD7x7
 #define jpeg_idct_6x6        jRD6x6
 #define jpeg_idct_5x5        jRD5x5
@@ -243,6 +244,11 @@ EXTERN(void) jpeg_idct_ifast
 EXTERN(void) jpeg_idct_float
     JPP((j_decompress_ptr cinfo, jpeg_component_info * compptr,
      JCOEFPTR coef_block, JSAMPARRAY output_buf, JDIMENSION output_col));
+#if defined(JPEG_USE_SSE2) && BITS_IN_JSAMPLE == 8
+EXTERN(void) jpeg_idct_islow_sse2
+    JPP((j_decompress_ptr cinfo, jpeg_component_info * compptr,
+     JCOEFPTR coef_block, JSAMPARRAY output_buf, JDIMENSION output_col));
+#endif
 EXTERN(void) jpeg_idct_7x7
     JPP((j_decompress_ptr cinfo, jpeg_component_info * compptr,
      JCOEFPTR coef_block, JSAMPARRAY output_buf, JDIMENSION output_col));
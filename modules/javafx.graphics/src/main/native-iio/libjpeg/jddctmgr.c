@@ -80,6 +80,31 @@ typedef union {
 #endif
 
 
+#if defined(JPEG_USE_SSE2) && BITS_IN_JSAMPLE == 8
+
+/*
+ * jpeg_idct_islow_sse2 multiplies by the quantizers as signed 16-bit
+ * values.  16-bit quantization tables may hold entries above 32767,
+ * and components using such a table are left to jpeg_idct_islow.
+ */
+
+LOCAL(boolean)
+quant_table_fits_sse2 (JQUANT_TBL * qtbl)
+{
+  int i;
+
+  if (qtbl != NULL) {
+    for (i = 0; i < DCTSIZE2; i++) {
+      if (qtbl->quantval[i] > 32767)
+    return FALSE;
+    }
+  }
+  return TRUE;
+}
+
+#endif
+
+
 /*
  * Prepare for an output pass.
  * Here we select the proper IDCT routine for each component and build
@@ -230,7 +255,12 @@ start_pass (j_decompress_ptr cinfo)
       switch (cinfo->dct_method) {
 #ifdef DCT_ISLOW_SUPPORTED
       case JDCT_ISLOW:
+#if defined(JPEG_USE_SSE2) && BITS_IN_JSAMPLE == 8
+    method_ptr = jpeg_use_sse2 && quant_table_fits_sse2(compptr->quant_table) ?
+      jpeg_idct_islow_sse2 : jpeg_idct_islow;
+#else
     method_ptr = jpeg_idct_islow;
+#endif
     method = JDCT_ISLOW;
     break;
 #endif
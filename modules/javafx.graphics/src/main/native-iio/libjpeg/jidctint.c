@@ -163,6 +163,221 @@
 #define DEQUANTIZE(coef,quantval)  (((ISLOW_MULT_TYPE) (coef)) * (quantval))
 
 
+#if defined(JPEG_USE_SSE2) && BITS_IN_JSAMPLE == 8
+
+#include <emmintrin.h>
+
+/*
+ * SSE2 version of jpeg_idct_islow, added for JavaFX.
+ *
+ * Each pass runs the C kernel below on eight columns (or rows) at a time.
+ * Following the assumption spelled out for MULTIPLY above, the inputs and
+ * the workspace values are kept in 16-bit lanes.  Every output of the
+ * kernel is a linear combination of the inputs, so the rotations are
+ * folded into pairs of 16x16->32 bit multiply-adds with the constants
+ * combined below; the 32-bit sums are exactly the ones the C code forms.
+ * The final range-limit is done with saturating packs, which matches the
+ * sample_range_limit table lookup for every masked value.
+ */
+
+#define SSE2_PAIR(c0,c1)  _mm_set_epi16((short) (c1), (short) (c0), \
+                                        (short) (c1), (short) (c0), \
+                                        (short) (c1), (short) (c0), \
+                                        (short) (c1), (short) (c0))
+
+/* Even part: (z2 + z3) * c6 folded into the c2-c6 and c2+c6 terms */
+#define SSE2_C2_C6    SSE2_PAIR(FIX_0_541196100 + FIX_0_765366865, \
+                                FIX_0_541196100)
+#define SSE2_C6_C2    SSE2_PAIR(FIX_0_541196100, \
+                                FIX_0_541196100 - FIX_1_847759065)
+/* Odd part: the c3 rotation and the four output rotations combined,
+ * applied to the (y7, y3) and (y5, y1) input pairs.
+ */
+#define SSE2_ODD0_73  SSE2_PAIR(FIX_0_298631336 - FIX_0_899976223 + \
+                                FIX_1_175875602 - FIX_1_961570560, \
+                                FIX_1_175875602 - FIX_1_961570560)
+#define SSE2_ODD0_51  SSE2_PAIR(FIX_1_175875602, \
+                                FIX_1_175875602 - FIX_0_899976223)
+#define SSE2_ODD1_73  SSE2_PAIR(FIX_1_175875602, \
+                                FIX_1_175875602 - FIX_2_562915447)
+#define SSE2_ODD1_51  SSE2_PAIR(FIX_2_053119869 - FIX_2_562915447 + \
+                                FIX_1_175875602 - FIX_0_390180644, \
+                                FIX_1_175875602 - FIX_0_390180644)
+#define SSE2_ODD2_73  SSE2_PAIR(FIX_1_175875602 - FIX_1_961570560, \
+                                FIX_3_072711026 - FIX_2_562915447 + \
+                                FIX_1_175875602 - FIX_1_961570560)
+#define SSE2_ODD2_51  SSE2_PAIR(FIX_1_175875602 - FIX_2_562915447, \
+                                FIX_1_175875602)
+#define SSE2_ODD3_73  SSE2_PAIR(FIX_1_175875602 - FIX_0_899976223, \
+                                FIX_1_175875602)
+#define SSE2_ODD3_51  SSE2_PAIR(FIX_1_175875602 - FIX_0_390180644, \
+                                FIX_1_501321110 - FIX_0_899976223 + \
+                                FIX_1_175875602 - FIX_0_390180644)
+
+/* Transpose an 8x8 block of 16-bit values held one row per register. */
+LOCAL(void)
+sse2_transpose8x8 (__m128i r[8])
+{
+  __m128i a0 = _mm_unpacklo_epi16(r[0], r[1]);
+  __m128i a1 = _mm_unpackhi_epi16(r[0], r[1]);
+  __m128i a2 = _mm_unpacklo_epi16(r[2], r[3]);
+  __m128i a3 = _mm_unpackhi_epi16(r[2], r[3]);
+  __m128i a4 = _mm_unpacklo_epi16(r[4], r[5]);
+  __m128i a5 = _mm_unpackhi_epi16(r[4], r[5]);
+  __m128i a6 = _mm_unpacklo_epi16(r[6], r[7]);
+  __m128i a7 = _mm_unpackhi_epi16(r[6], r[7]);
+  __m128i b0 = _mm_unpacklo_epi32(a0, a2);
+  __m128i b1 = _mm_unpackhi_epi32(a0, a2);
+  __m128i b2 = _mm_unpacklo_epi32(a1, a3);
+  __m128i b3 = _mm_unpackhi_epi32(a1, a3);
+  __m128i b4 = _mm_unpacklo_epi32(a4, a6);
+  __m128i b5 = _mm_unpackhi_epi32(a4, a6);
+  __m128i b6 = _mm_unpacklo_epi32(a5, a7);
+  __m128i b7 = _mm_unpackhi_epi32(a5, a7);
+
+  r[0] = _mm_unpacklo_epi64(b0, b4);
+  r[1] = _mm_unpackhi_epi64(b0, b4);
+  r[2] = _mm_unpacklo_epi64(b1, b5);
+  r[3] = _mm_unpackhi_epi64(b1, b5);
+  r[4] = _mm_unpacklo_epi64(b2, b6);
+  r[5] = _mm_unpackhi_epi64(b2, b6);
+  r[6] = _mm_unpacklo_epi64(b3, b7);
+  r[7] = _mm_unpackhi_epi64(b3, b7);
+}
+
+/*
+ * 1-D islow IDCT of eight lanes.  'bias' is added to the DC term after
+ * scaling it up by CONST_BITS; the outputs are shifted right by 'shift'
+ * and returned as 32-bit values, lanes 0..3 in lo[] and 4..7 in hi[].
+ */
+LOCAL(void)
+sse2_idct_islow_1d (const __m128i in[8], __m128i bias, int shift,
+            __m128i lo[8], __m128i hi[8])
+{
+  const __m128i k_sum = SSE2_PAIR(ONE << CONST_BITS, ONE << CONST_BITS);
+  const __m128i k_diff = SSE2_PAIR(ONE << CONST_BITS, - (ONE << CONST_BITS));
+  __m128i p[2][4];        /* (y0,y4), (y2,y6), (y7,y3), (y5,y1) pairs */
+  int h;
+
+  p[0][0] = _mm_unpacklo_epi16(in[0], in[4]);
+  p[1][0] = _mm_unpackhi_epi16(in[0], in[4]);
+  p[0][1] = _mm_unpacklo_epi16(in[2], in[6]);
+  p[1][1] = _mm_unpackhi_epi16(in[2], in[6]);
+  p[0][2] = _mm_unpacklo_epi16(in[7], in[3]);
+  p[1][2] = _mm_unpackhi_epi16(in[7], in[3]);
+  p[0][3] = _mm_unpacklo_epi16(in[5], in[1]);
+  p[1][3] = _mm_unpackhi_epi16(in[5], in[1]);
+
+  for (h = 0; h < 2; h++) {
+    __m128i tmp0, tmp1, tmp2, tmp3;
+    __m128i tmp10, tmp11, tmp12, tmp13;
+    __m128i * out = h ? hi : lo;
+
+    /* Even part */
+
+    tmp0 = _mm_add_epi32(_mm_madd_epi16(p[h][0], k_sum), bias);
+    tmp1 = _mm_add_epi32(_mm_madd_epi16(p[h][0], k_diff), bias);
+    tmp2 = _mm_madd_epi16(p[h][1], SSE2_C2_C6);
+    tmp3 = _mm_madd_epi16(p[h][1], SSE2_C6_C2);
+
+    tmp10 = _mm_add_epi32(tmp0, tmp2);
+    tmp13 = _mm_sub_epi32(tmp0, tmp2);
+    tmp11 = _mm_add_epi32(tmp1, tmp3);
+    tmp12 = _mm_sub_epi32(tmp1, tmp3);
+
+    /* Odd part */
+
+    tmp0 = _mm_add_epi32(_mm_madd_epi16(p[h][2], SSE2_ODD0_73),
+                         _mm_madd_epi16(p[h][3], SSE2_ODD0_51));
+    tmp1 = _mm_add_epi32(_mm_madd_epi16(p[h][2], SSE2_ODD1_73),
+                         _mm_madd_epi16(p[h][3], SSE2_ODD1_51));
+    tmp2 = _mm_add_epi32(_mm_madd_epi16(p[h][2], SSE2_ODD2_73),
+                         _mm_madd_epi16(p[h][3], SSE2_ODD2_51));
+    tmp3 = _mm_add_epi32(_mm_madd_epi16(p[h][2], SSE2_ODD3_73),
+                         _mm_madd_epi16(p[h][3], SSE2_ODD3_51));
+
+    /* Final output stage */
+
+    out[0] = _mm_srai_epi32(_mm_add_epi32(tmp10, tmp3), shift);
+    out[7] = _mm_srai_epi32(_mm_sub_epi32(tmp10, tmp3), shift);
+    out[1] = _mm_srai_epi32(_mm_add_epi32(tmp11, tmp2), shift);
+    out[6] = _mm_srai_epi32(_mm_sub_epi32(tmp11, tmp2), shift);
+    out[2] = _mm_srai_epi32(_mm_add_epi32(tmp12, tmp1), shift);
+    out[5] = _mm_srai_epi32(_mm_sub_epi32(tmp12, tmp1), shift);
+    out[3] = _mm_srai_epi32(_mm_add_epi32(tmp13, tmp0), shift);
+    out[4] = _mm_srai_epi32(_mm_sub_epi32(tmp13, tmp0), shift);
+  }
+}
+
+GLOBAL(void)
+jpeg_idct_islow_sse2 (j_decompress_ptr cinfo, jpeg_component_info * compptr,
+         JCOEFPTR coef_block,
+         JSAMPARRAY output_buf, JDIMENSION output_col)
+{
+  ISLOW_MULT_TYPE * quantptr = (ISLOW_MULT_TYPE *) compptr->dct_table;
+  __m128i ws[DCTSIZE];        /* buffers data between passes */
+  __m128i lo[DCTSIZE], hi[DCTSIZE];
+  __m128i ac = _mm_setzero_si128();
+  int ctr;
+
+  /* Pass 1: process all eight columns from input, store into work array.
+   * Note results are scaled up by sqrt(8) compared to a true IDCT;
+   * furthermore, we scale the results by 2**PASS1_BITS.
+   */
+
+  for (ctr = 0; ctr < DCTSIZE; ctr++) {
+    __m128i coef = _mm_loadu_si128((const __m128i *) (coef_block + DCTSIZE*ctr));
+    __m128i quant = _mm_packs_epi32(
+      _mm_loadu_si128((const __m128i *) (quantptr + DCTSIZE*ctr)),
+      _mm_loadu_si128((const __m128i *) (quantptr + DCTSIZE*ctr + 4)));
+    if (ctr > 0)
+      ac = _mm_or_si128(ac, coef);
+    ws[ctr] = _mm_mullo_epi16(coef, quant);
+  }
+
+  if (_mm_movemask_epi8(_mm_cmpeq_epi16(ac, _mm_setzero_si128())) == 0xFFFF) {
+    /* AC terms all zero in every column */
+    __m128i dcval = _mm_slli_epi16(ws[0], PASS1_BITS);
+
+    for (ctr = 0; ctr < DCTSIZE; ctr++)
+      ws[ctr] = dcval;
+  } else {
+    sse2_idct_islow_1d(ws, _mm_set1_epi32(ONE << (CONST_BITS-PASS1_BITS-1)),
+               CONST_BITS-PASS1_BITS, lo, hi);
+    for (ctr = 0; ctr < DCTSIZE; ctr++)
+      ws[ctr] = _mm_packs_epi32(lo[ctr], hi[ctr]);
+  }
+
+  /* Pass 2: process rows from work array, store into output array.
+   * Note that we must descale the results by a factor of 8 == 2**3,
+   * and also undo the PASS1_BITS scaling.
+   */
+
+  sse2_transpose8x8(ws);
+  sse2_idct_islow_1d(ws,
+             _mm_set1_epi32(((((INT32) RANGE_CENTER) << (PASS1_BITS+3)) +
+                             (ONE << (PASS1_BITS+2))) << CONST_BITS),
+             CONST_BITS+PASS1_BITS+3, lo, hi);
+
+  /* Range-limit: the table maps masked values to clamp(x - RANGE_SUBSET). */
+  {
+    __m128i mask = _mm_set1_epi32(RANGE_MASK);
+    __m128i subset = _mm_set1_epi32(RANGE_SUBSET);
+
+    for (ctr = 0; ctr < DCTSIZE; ctr++)
+      ws[ctr] = _mm_packs_epi32(
+        _mm_sub_epi32(_mm_and_si128(lo[ctr], mask), subset),
+        _mm_sub_epi32(_mm_and_si128(hi[ctr], mask), subset));
+  }
+  sse2_transpose8x8(ws);
+  for (ctr = 0; ctr < DCTSIZE; ctr++)
+    _mm_storel_epi64((__m128i *) (output_buf[ctr] + output_col),
+                     _mm_packus_epi16(ws[ctr], ws[ctr]));
+}
+
+#endif /* JPEG_USE_SSE2 && BITS_IN_JSAMPLE == 8 */
+
+
 /*
  * Perform dequantization and inverse DCT on one block of coefficients.
  *
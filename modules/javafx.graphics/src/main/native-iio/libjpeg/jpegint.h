@@ -352,6 +352,7 @@ struct jpeg_color_quantizer {
 #define jpeg_natural_order3    jZAG3Table
 #define jpeg_natural_order2    jZAG2Table
 #define jpeg_aritab        jAriTab
+#define jpeg_use_sse2        jUseSSE2
 #endif /* NEED_SHORT_EXTERNAL_NAMES */
 
 
@@ -435,6 +436,11 @@ extern const int jpeg_natural_order2[]; /* zz to natural order for 2x2 block */
 /* Arithmetic coding probability estimation tables in jaricom.c */
 extern const INT32 jpeg_aritab[];
 
+#ifdef JPEG_USE_SSE2
+/* JavaFX: set by jpeg_enable_sse2 in jutils.c */
+extern boolean jpeg_use_sse2;
+#endif
+
 /* Suppress undefined-structure complaints if necessary. */
 
 #ifdef INCOMPLETE_TYPES_BROKEN
@@ -942,6 +942,7 @@ typedef JMETHOD(boolean, jpeg_marker_parser_method, (j_decompress_ptr cinfo));
 #define jpeg_abort        jAbort
 #define jpeg_destroy        jDestroy
 #define jpeg_resync_to_restart    jResyncRestart
+#define jpeg_enable_sse2    jEnableSSE2
 #endif /* NEED_SHORT_EXTERNAL_NAMES */
 
 
@@ -1118,6 +1119,12 @@ EXTERN(void) jpeg_destroy JPP((j_common_ptr cinfo));
 EXTERN(boolean) jpeg_resync_to_restart JPP((j_decompress_ptr cinfo,
                         int desired));
 
+/* JavaFX: selects the SSE2 or the C versions of the decoding methods
+ * that have both (see jconfig.h) for images started from now on.
+ * Returns whether the SSE2 versions are selected.
+ */
+EXTERN(boolean) jpeg_enable_sse2 JPP((boolean enable));
+
 
 /* These marker codes are exported since applications and data source modules
  * are likely to want to use them.
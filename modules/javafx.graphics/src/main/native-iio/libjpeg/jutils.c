@@ -223,3 +223,23 @@ jcopy_block_row (JBLOCKROW input_row, JBLOCKROW output_row,
   }
 #endif
 }
+
+
+/*
+ * JavaFX: the SSE2 decoding methods are selected unless disabled here.
+ */
+
+#ifdef JPEG_USE_SSE2
+boolean jpeg_use_sse2 = TRUE;
+#endif
+
+GLOBAL(boolean)
+jpeg_enable_sse2 (boolean enable)
+{
+#ifdef JPEG_USE_SSE2
+  jpeg_use_sse2 = enable;
+  return jpeg_use_sse2;
+#else
+  return FALSE;
+#endif
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -31,6 +31,7 @@
 
 #include <PiscesBlit.h>
 #include <PiscesSysutils.h>
+#include <PiscesWorkers.h>
 
 #include <PiscesRenderer.inl>
 
@@ -40,6 +41,13 @@
 #define RENDERER_SURFACE 1
 #define RENDERER_LAST RENDERER_SURFACE
 
+// Rows per band when a fill is split among worker threads. Multiple of
+// NUM_ALPHA_ROWS so that bands generate paint in the same chunks as the
+// single threaded loop.
+#define BAND_HEIGHT (8 * NUM_ALPHA_ROWS)
+// Fills smaller than this many pixels are not worth splitting
+#define MIN_PARALLEL_PIXELS (256 * 256)
+
 #define SURFACE_FROM_RENDERER(surface, env, surfaceHandle, rendererHandle)     \
         (surfaceHandle) = (*(env))->GetObjectField((env), (rendererHandle),    \
                                                    fieldIds[RENDERER_SURFACE]  \
@@ -50,7 +58,17 @@ static jfieldID fieldIds[RENDERER_LAST + 1];
 static jboolean fieldIdsInitialized = JNI_FALSE;
 static jboolean initializeRendererFieldIds(JNIEnv *env, jobject objectHandle);
 
+typedef struct _RowBands {
+    Renderer* rdr;
+    jint x_from;
+    jint y_from;
+    jint rows;
+    jint rowNum;
+    jint scanlineStride;
+} RowBands;
+
 static int toPiscesCoords(unsigned int ff);
+static void renderRowBand(void *arg, jint index);
 static void fillAlphaMask(Renderer* rdr, jint minX, jint minY, jint maxX, jint maxY,
     JNIEnv *env, jobject this, jint maskType, jbyteArray jmask, jint x, jint y,
     jint maskWidth, jint maskHeight, jint offset, jint stride);
@@ -507,6 +525,27 @@ fillRect(JNIEnv *env, jobject this, Renderer* rdr,
         }
 
         // emit "full" lines that are in the middle
+        if (workers_getCount() > 1 &&
+            rows_to_render_by_loop > BAND_HEIGHT &&
+            (x_to - x_from + 1) * rows_to_render_by_loop >= MIN_PARALLEL_PIXELS)
+        {
+            RowBands bands;
+            bands.rdr = rdr;
+            bands.x_from = x_from;
+            bands.y_from = rdr->_currY;
+            bands.rows = rows_to_render_by_loop;
+            bands.rowNum = rdr->_rowNum;
+            bands.scanlineStride = surface->width;
+
+            workers_run(renderRowBand, &bands,
+                (rows_to_render_by_loop + BAND_HEIGHT - 1) / BAND_HEIGHT);
+
+            rdr->_currX = x_from;
+            rdr->_currY += rows_to_render_by_loop;
+            rdr->_currImageOffset = rdr->_currY * surface->width;
+            rdr->_rowNum += rows_to_render_by_loop;
+            rows_to_render_by_loop = 0;
+        }
         while (rows_to_render_by_loop > 0) {
             rows_being_rendered = MIN(rows_to_render_by_loop, NUM_ALPHA_ROWS);
 
@@ -559,6 +598,105 @@ JNIEXPORT void JNICALL Java_com_sun_pisces_PiscesRenderer_fillRectImpl
         IMAGE_FRAC_EDGE_KEEP, IMAGE_FRAC_EDGE_KEEP);
 }
 
+static void emitAndClearAlphaRow(Renderer* rdr, Surface* surface, jbyte* alphaMap,
+    jint* alphaRow, jint y, jint x_from, jint x_to, jint rowNum)
+{
+    x_from = MAX(x_from, rdr->_clip_bbMinX);
+    x_to = MIN(x_to, rdr->_clip_bbMaxX);
+
+    if (x_to >= x_from &&
+        y >= rdr->_clip_bbMinY &&
+        y <= rdr->_clip_bbMaxY)
+    {
+        rdr->_minTouched = x_from;
+        rdr->_maxTouched = x_to;
+        rdr->_currX = x_from;
+        rdr->_currY = y;
+
+        rdr->_rowNum = rowNum;
+
+        rdr->alphaMap = alphaMap;
+        rdr->_rowAAInt = alphaRow;
+        rdr->_alphaWidth = x_to - x_from + 1;
+
+        rdr->_currImageOffset = y * surface->width;
+        rdr->_imageScanlineStride = surface->width;
+        rdr->_imagePixelStride = 1;
+
+        if (rdr->_genPaint) {
+            size_t l = (x_to - x_from + 1);
+            ALLOC3(rdr->_paint, jint, l);
+            rdr->_genPaint(rdr, 1);
+        }
+        rdr->_emitRows(rdr, 1);
+        rdr->_rowAAInt = NULL;
+    }
+}
+
+/*
+ * Renders one band of "full" lines of fillRect() on a worker thread. Works on
+ * a copy of the renderer with its own paint buffer, so bands do not share any
+ * mutable state. Only touches rows of its own band of the surface.
+ */
+static void
+renderRowBand(void *arg, jint index)
+{
+    RowBands* bands = (RowBands*)arg;
+    Renderer band;
+    jint first = index * BAND_HEIGHT;
+    jint rows_to_render = MIN(BAND_HEIGHT, bands->rows - first);
+    jint rows_being_rendered;
+
+    memcpy(&band, bands->rdr, sizeof(Renderer));
+    band._paint = NULL;
+    band._paint_length = 0;
+    band._currX = bands->x_from;
+    band._currY = bands->y_from + first;
+    band._currImageOffset = band._currY * bands->scanlineStride;
+    band._rowNum = bands->rowNum + first;
+
+    while (rows_to_render > 0) {
+        rows_being_rendered = MIN(rows_to_render, NUM_ALPHA_ROWS);
+
+        if (band._genPaint) {
+            size_t l = (band._maxTouched - band._minTouched + 1) * rows_being_rendered;
+            ALLOC3(band._paint, jint, l);
+            band._genPaint(&band, rows_being_rendered);
+        }
+        band._emitLine(&band, rows_being_rendered, 0x10000);
+
+        rows_to_render -= rows_being_rendered;
+        band._currX = bands->x_from;
+        band._currY += rows_being_rendered;
+        band._currImageOffset = band._currY * bands->scanlineStride;
+        band._rowNum += rows_being_rendered;
+    }
+
+    my_free(band._paint);
+}
+
+/*
+ * Class:     com_sun_pisces_PiscesRenderer
+ * Method:    setWorkerThreadsImpl
+ * Signature: (I)V
+ */
+JNIEXPORT void JNICALL Java_com_sun_pisces_PiscesRenderer_setWorkerThreadsImpl
+  (JNIEnv *env, jclass cls, jint count)
+{
+    workers_setCount(count);
+}
+
+/*
+ * Class:     com_sun_pisces_PiscesRenderer
+ * Method:    setSIMDEnabledImpl
+ * Signature: (Z)Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_sun_pisces_PiscesRenderer_setSIMDEnabledImpl
+  (JNIEnv *env, jclass cls, jboolean enabled)
+{
+    return setSIMDEnabled(enabled);
+}
+
 /*
  * Class:     com_sun_pisces_PiscesRenderer
  * Method:    emitAndClearAlphaRowImpl
@@ -586,37 +724,70 @@ JNIEXPORT void JNICALL Java_com_sun_pisces_PiscesRenderer_emitAndClearAlphaRowIm
         jint* alphaRow = (jint*)(*env)->GetPrimitiveArrayCritical(env, jAlphaDeltas, NULL);
         if (alphaRow != NULL)
         {
-            x_from = MAX(x_from, rdr->_clip_bbMinX);
-            x_to = MIN(x_to, rdr->_clip_bbMaxX);
+            /* add offset in alpha buffer */
+            emitAndClearAlphaRow(rdr, surface, alphaMap, alphaRow + x_off, y, x_from, x_to, rowNum);
+            (*env)->ReleasePrimitiveArrayCritical(env, jAlphaDeltas, alphaRow, 0);
+        } else {
+            setMemErrorFlag();
+        }
+        (*env)->ReleasePrimitiveArrayCritical(env, jAlphaMap, alphaMap, 0);
+    } else {
+        setMemErrorFlag();
+    }
 
-            if (x_to >= x_from &&
-                y >= rdr->_clip_bbMinY &&
-                y <= rdr->_clip_bbMaxY)
-            {
-                rdr->_minTouched = x_from;
-                rdr->_maxTouched = x_to;
-                rdr->_currX = x_from;
-                rdr->_currY = y;
+    RELEASE_SURFACE(surface, env, surfaceHandle);
 
-                rdr->_rowNum = rowNum;
+    if (JNI_TRUE == readAndClearMemErrorFlag()) {
+        JNI_ThrowNew(env, "java/lang/OutOfMemoryError",
+            "Allocation of internal renderer buffer failed.");
+    }
+}
+
+/*
+ * Class:     com_sun_pisces_PiscesRenderer
+ * Method:    emitAndClearAlphaRowsImpl
+ * Signature: ([B[II[III)V
+ *
+ * Emits rowCount rows with a single acquisition of the surface and the arrays.
+ * Deltas of row i start at i * deltaStride, row i is described by
+ * (y, x_from, x_to) at rows[3 * i].
+ */
+JNIEXPORT void JNICALL Java_com_sun_pisces_PiscesRenderer_emitAndClearAlphaRowsImpl
+  (JNIEnv *env, jobject this, jbyteArray jAlphaMap, jintArray jAlphaDeltas, jint deltaStride,
+   jintArray jRows, jint rowCount, jint rowNum)
+{
+    Renderer* rdr;
+    Surface* surface;
+    jobject surfaceHandle;
+    jbyte* alphaMap;
 
-                rdr->alphaMap = alphaMap;
-                rdr->_rowAAInt = alphaRow + x_off; /* add offset in alpha buffer */
-                rdr->_alphaWidth = x_to - x_from + 1;
+    rdr = (Renderer*)JLongToPointer((*env)->GetLongField(env, this, fieldIds[RENDERER_NATIVE_PTR]));
 
-                rdr->_currImageOffset = y * surface->width;
-                rdr->_imageScanlineStride = surface->width;
-                rdr->_imagePixelStride = 1;
+    SURFACE_FROM_RENDERER(surface, env, surfaceHandle, this);
+    ACQUIRE_SURFACE(surface, env, surfaceHandle);
+    INVALIDATE_RENDERER_SURFACE(rdr);
+    VALIDATE_BLITTING(rdr);
 
-                if (rdr->_genPaint) {
-                    size_t l = (x_to - x_from + 1);
-                    ALLOC3(rdr->_paint, jint, l);
-                    rdr->_genPaint(rdr, 1);
+    alphaMap = (jbyte*)(*env)->GetPrimitiveArrayCritical(env, jAlphaMap, NULL);
+    if (alphaMap != NULL)
+    {
+        jint* alphaRows = (jint*)(*env)->GetPrimitiveArrayCritical(env, jAlphaDeltas, NULL);
+        if (alphaRows != NULL)
+        {
+            jint* rows = (jint*)(*env)->GetPrimitiveArrayCritical(env, jRows, NULL);
+            if (rows != NULL)
+            {
+                jint i;
+                for (i = 0; i < rowCount; i++) {
+                    jint* row = rows + 3 * i;
+                    emitAndClearAlphaRow(rdr, surface, alphaMap, alphaRows + i * deltaStride,
+                        row[0], row[1], row[2], rowNum + i);
                 }
-                rdr->_emitRows(rdr, 1);
-                rdr->_rowAAInt = NULL;
+                (*env)->ReleasePrimitiveArrayCritical(env, jRows, rows, JNI_ABORT);
+            } else {
+                setMemErrorFlag();
             }
-            (*env)->ReleasePrimitiveArrayCritical(env, jAlphaDeltas, alphaRow, 0);
+            (*env)->ReleasePrimitiveArrayCritical(env, jAlphaDeltas, alphaRows, 0);
         } else {
             setMemErrorFlag();
         }
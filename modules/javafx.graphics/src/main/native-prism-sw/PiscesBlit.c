@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2014, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -32,11 +32,25 @@
 #include <PiscesMath.h>
 
 #include <limits.h>
+#include <string.h>
+
+#if defined(PISCES_SSE2)
+#include <emmintrin.h>
+#elif defined(PISCES_NEON)
+#include <arm_neon.h>
+#endif
 
 #define HALF_ALPHA (MAX_ALPHA >> 1)
 #define ALPHA_SHIFT 8
 #define HALF_1_SHIFT_23 (jint)(1L << 23)
 
+// Selects red and blue (or alpha and green after >> 8) as two 16-bit lanes
+#define LANE_MASK 0x00FF00FF
+
+#ifdef PISCES_SIMD
+static jboolean simdEnabled = XNI_TRUE;
+#endif
+
 static jfloat currentGamma = -1;
 static jint gammaArray[256];
 static jint invGammaArray[256];
@@ -62,6 +76,25 @@ static INLINE jint div255(jint x) {
     return (x*257 + 257) >> 16;
 }
 
+/*
+ * div255() applied to both 16-bit lanes of x at once. Each lane must not
+ * exceed 255 * 255. Gives the same result as div255() on every lane since
+ * (x*257 + 257) >> 16 == ((x+1) + ((x+1) >> 8)) >> 8.
+ */
+static INLINE unsigned int div255x2(unsigned int x) {
+    x += 0x00010001;
+    return ((x + ((x >> 8) & LANE_MASK)) >> 8) & LANE_MASK;
+}
+
+/*
+ * Returns true if next 4 coverage values of the mask are all zero.
+ */
+static INLINE jboolean isEmptyMask4(jbyte *a) {
+    jint a4;
+    memcpy(&a4, a, sizeof(a4));
+    return a4 == 0;
+}
+
 static INLINE jint A(jint x) {
     return (x >> 24) & 0xFF;
 }
@@ -75,6 +108,213 @@ static INLINE jint B(jint x) {
     return x & 0xFF;
 }
 
+jboolean setSIMDEnabled(jboolean enabled) {
+#ifdef PISCES_SIMD
+    simdEnabled = enabled;
+    return enabled;
+#else
+    return XNI_FALSE;
+#endif
+}
+
+jboolean isSIMDEnabled(void) {
+#ifdef PISCES_SIMD
+    return simdEnabled;
+#else
+    return XNI_FALSE;
+#endif
+}
+
+/*
+ * Four pixel versions of blendSrcOver8888_pre() and blendSrcOver8888_pre_pre().
+ * cov points to the mask coverage of the four pixels. Components are widened
+ * to 16 bits and every product stays below 65536, so each component gets the
+ * same value as in the scalar loops: pixels the scalar loops skip because
+ * their alpha is 0 come out unchanged, and pixels they overwrite because
+ * their alpha is MAX_ALPHA get the source color.
+ */
+#if defined(PISCES_SSE2)
+
+// div255() of every 16-bit lane of x, each at most 255 * 255
+static INLINE __m128i div255_sse2(__m128i x) {
+    x = _mm_add_epi16(x, _mm_set1_epi16(1));
+    return _mm_srli_epi16(_mm_add_epi16(x, _mm_srli_epi16(x, 8)), 8);
+}
+
+// coverage of two pixels, each repeated over the 4 lanes of its pixel
+static INLINE void loadCoverage4_sse2(jbyte *cov, __m128i *lo, __m128i *hi) {
+    const __m128i zero = _mm_setzero_si128();
+    jint c;
+    __m128i m;
+    memcpy(&c, cov, sizeof(c));
+    m = _mm_cvtsi32_si128(c);
+    m = _mm_unpacklo_epi8(m, m);
+    m = _mm_unpacklo_epi16(m, m);
+    *lo = _mm_unpacklo_epi8(m, zero);
+    *hi = _mm_unpackhi_epi8(m, zero);
+}
+
+/*
+ * color holds sblue, sgreen, sred, MAX_ALPHA of two pixels, calpha the
+ * color alpha in all lanes.
+ */
+static INLINE void blendSrcOver4_pre(jint *intData, jbyte *cov,
+                                     __m128i color, __m128i calpha) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i one = _mm_set1_epi16(1);
+    const __m128i max = _mm_set1_epi16(MAX_ALPHA);
+    __m128i alo, ahi, dlo, dhi;
+    __m128i d = _mm_loadu_si128((__m128i *)intData);
+
+    loadCoverage4_sse2(cov, &alo, &ahi);
+    // aval = ((coverage + 1) * calpha) >> 8
+    alo = _mm_srli_epi16(_mm_mullo_epi16(_mm_add_epi16(alo, one), calpha), 8);
+    ahi = _mm_srli_epi16(_mm_mullo_epi16(_mm_add_epi16(ahi, one), calpha), 8);
+
+    dlo = _mm_unpacklo_epi8(d, zero);
+    dhi = _mm_unpackhi_epi8(d, zero);
+    dlo = div255_sse2(_mm_add_epi16(_mm_mullo_epi16(color, alo),
+                                    _mm_mullo_epi16(_mm_sub_epi16(max, alo), dlo)));
+    dhi = div255_sse2(_mm_add_epi16(_mm_mullo_epi16(color, ahi),
+                                    _mm_mullo_epi16(_mm_sub_epi16(max, ahi), dhi)));
+
+    _mm_storeu_si128((__m128i *)intData, _mm_packus_epi16(dlo, dhi));
+}
+
+// SrcOver of two premultiplied paint pixels s, frac being coverage + 1
+static INLINE __m128i blendSrcOver2_pre_pre_sse2(__m128i d, __m128i s, __m128i frac) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i max = _mm_set1_epi16(MAX_ALPHA);
+    __m128i aval, skip;
+
+    s = _mm_srli_epi16(_mm_mullo_epi16(s, frac), 8);
+    aval = _mm_shufflelo_epi16(s, _MM_SHUFFLE(3, 3, 3, 3));
+    aval = _mm_shufflehi_epi16(aval, _MM_SHUFFLE(3, 3, 3, 3));
+    skip = _mm_cmpeq_epi16(aval, zero);
+    s = _mm_add_epi16(s, div255_sse2(_mm_mullo_epi16(_mm_sub_epi16(max, aval), d)));
+    return _mm_or_si128(_mm_and_si128(skip, d), _mm_andnot_si128(skip, s));
+}
+
+static INLINE void blendSrcOver4_pre_pre(jint *intData, jbyte *cov, jint *paint) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i one = _mm_set1_epi16(1);
+    __m128i flo, fhi;
+    __m128i d = _mm_loadu_si128((__m128i *)intData);
+    __m128i s = _mm_loadu_si128((__m128i *)paint);
+
+    loadCoverage4_sse2(cov, &flo, &fhi);
+    flo = blendSrcOver2_pre_pre_sse2(_mm_unpacklo_epi8(d, zero),
+                                     _mm_unpacklo_epi8(s, zero),
+                                     _mm_add_epi16(flo, one));
+    fhi = blendSrcOver2_pre_pre_sse2(_mm_unpackhi_epi8(d, zero),
+                                     _mm_unpackhi_epi8(s, zero),
+                                     _mm_add_epi16(fhi, one));
+
+    _mm_storeu_si128((__m128i *)intData, _mm_packus_epi16(flo, fhi));
+}
+
+#define SIMD_COLOR __m128i
+#define SIMD_ALPHA __m128i
+
+static INLINE __m128i simdColor(jint sred, jint sgreen, jint sblue) {
+    return _mm_set_epi16(MAX_ALPHA, (short)sred, (short)sgreen, (short)sblue,
+                         MAX_ALPHA, (short)sred, (short)sgreen, (short)sblue);
+}
+
+static INLINE __m128i simdAlpha(jint calpha) {
+    return _mm_set1_epi16((short)calpha);
+}
+
+#elif defined(PISCES_NEON)
+
+// div255() of every 16-bit lane of x, each at most 255 * 255
+static INLINE uint16x8_t div255_neon(uint16x8_t x) {
+    x = vaddq_u16(x, vdupq_n_u16(1));
+    return vshrq_n_u16(vsraq_n_u16(x, x, 8), 8);
+}
+
+// coverage of two pixels, each repeated over the 4 lanes of its pixel
+static INLINE void loadCoverage4_neon(jbyte *cov, uint16x8_t *lo, uint16x8_t *hi) {
+    static const uint8_t loIndex[8] = { 0, 0, 0, 0, 1, 1, 1, 1 };
+    static const uint8_t hiIndex[8] = { 2, 2, 2, 2, 3, 3, 3, 3 };
+    uint32_t c;
+    uint8x8_t m;
+    memcpy(&c, cov, sizeof(c));
+    m = vreinterpret_u8_u32(vdup_n_u32(c));
+    *lo = vmovl_u8(vtbl1_u8(m, vld1_u8(loIndex)));
+    *hi = vmovl_u8(vtbl1_u8(m, vld1_u8(hiIndex)));
+}
+
+/*
+ * color holds sblue, sgreen, sred, MAX_ALPHA of two pixels, calpha the
+ * color alpha in all lanes.
+ */
+static INLINE void blendSrcOver4_pre(jint *intData, jbyte *cov,
+                                     uint16x8_t color, uint16x8_t calpha) {
+    const uint16x8_t one = vdupq_n_u16(1);
+    const uint16x8_t max = vdupq_n_u16(MAX_ALPHA);
+    uint16x8_t alo, ahi, dlo, dhi;
+    uint8x16_t d = vld1q_u8((uint8_t *)intData);
+
+    loadCoverage4_neon(cov, &alo, &ahi);
+    // aval = ((coverage + 1) * calpha) >> 8
+    alo = vshrq_n_u16(vmulq_u16(vaddq_u16(alo, one), calpha), 8);
+    ahi = vshrq_n_u16(vmulq_u16(vaddq_u16(ahi, one), calpha), 8);
+
+    dlo = vmovl_u8(vget_low_u8(d));
+    dhi = vmovl_u8(vget_high_u8(d));
+    dlo = div255_neon(vmlaq_u16(vmulq_u16(color, alo), vsubq_u16(max, alo), dlo));
+    dhi = div255_neon(vmlaq_u16(vmulq_u16(color, ahi), vsubq_u16(max, ahi), dhi));
+
+    vst1q_u8((uint8_t *)intData, vcombine_u8(vqmovn_u16(dlo), vqmovn_u16(dhi)));
+}
+
+// SrcOver of two premultiplied paint pixels s, frac being coverage + 1
+static INLINE uint16x8_t blendSrcOver2_pre_pre_neon(uint16x8_t d, uint8x8_t s8, uint16x8_t frac) {
+    static const uint8_t alphaIndex[8] = { 3, 3, 3, 3, 7, 7, 7, 7 };
+    const uint16x8_t max = vdupq_n_u16(MAX_ALPHA);
+    uint16x8_t s, aval, skip;
+
+    s = vshrq_n_u16(vmulq_u16(vmovl_u8(s8), frac), 8);
+    aval = vshrq_n_u16(vmulq_u16(vmovl_u8(vtbl1_u8(s8, vld1_u8(alphaIndex))), frac), 8);
+    skip = vceqq_u16(aval, vdupq_n_u16(0));
+    s = vaddq_u16(s, div255_neon(vmulq_u16(vsubq_u16(max, aval), d)));
+    return vbslq_u16(skip, d, s);
+}
+
+static INLINE void blendSrcOver4_pre_pre(jint *intData, jbyte *cov, jint *paint) {
+    const uint16x8_t one = vdupq_n_u16(1);
+    uint16x8_t flo, fhi;
+    uint8x16_t d = vld1q_u8((uint8_t *)intData);
+    uint8x16_t s = vld1q_u8((uint8_t *)paint);
+
+    loadCoverage4_neon(cov, &flo, &fhi);
+    flo = blendSrcOver2_pre_pre_neon(vmovl_u8(vget_low_u8(d)), vget_low_u8(s),
+                                     vaddq_u16(flo, one));
+    fhi = blendSrcOver2_pre_pre_neon(vmovl_u8(vget_high_u8(d)), vget_high_u8(s),
+                                     vaddq_u16(fhi, one));
+
+    vst1q_u8((uint8_t *)intData, vcombine_u8(vqmovn_u16(flo), vqmovn_u16(fhi)));
+}
+
+#define SIMD_COLOR uint16x8_t
+#define SIMD_ALPHA uint16x8_t
+
+static INLINE uint16x8_t simdColor(jint sred, jint sgreen, jint sblue) {
+    uint16_t c[8];
+    c[0] = c[4] = (uint16_t)sblue;
+    c[1] = c[5] = (uint16_t)sgreen;
+    c[2] = c[6] = (uint16_t)sred;
+    c[3] = c[7] = MAX_ALPHA;
+    return vld1q_u16(c);
+}
+
+static INLINE uint16x8_t simdAlpha(jint calpha) {
+    return vdupq_n_u16((uint16_t)calpha);
+}
+
+#endif
+
 void
 emitLineSource8888_pre(Renderer *rdr, jint height, jint frac) {
     jint j, minX, maxX, w, iidx;
@@ -575,6 +815,14 @@ blitSrcOver8888_pre(Renderer *rdr, jint height) {
     jint cblue = rdr->_cblue;
     jbyte *alphaMap = rdr->alphaMap;
 
+#ifdef PISCES_SIMD
+    jboolean simd = simdEnabled && imagePixelStride == 1;
+    SIMD_COLOR scolor = simdColor(cred, cgreen, cblue);
+    SIMD_ALPHA salpha = simdAlpha(calpha);
+    jbyte cov[4];
+    jint k;
+#endif
+
     minX = rdr->_minTouched;
     maxX = rdr->_maxTouched;
     w = (maxX >= minX) ? (maxX - minX + 1) : 0;
@@ -586,6 +834,21 @@ blitSrcOver8888_pre(Renderer *rdr, jint height) {
         a = alpha;
         am = a + w;
         while (a < am) {
+#ifdef PISCES_SIMD
+            if (simd && am - a >= 4) {
+                for (k = 0; k < 4; k++) {
+                    aval_relative += a[k];
+                    a[k] = 0;
+                    cov[k] = aval_relative ? alphaMap[aval_relative] : 0;
+                }
+                if (!isEmptyMask4(cov)) {
+                    blendSrcOver4_pre(&intData[iidx], cov, scolor, salpha);
+                }
+                a += 4;
+                iidx += 4;
+                continue;
+            }
+#endif
             aval_relative += *a;
             *a++ = 0;
             if (aval_relative) {
@@ -626,6 +889,12 @@ blitSrcOverMask8888_pre(Renderer *rdr, jint height) {
     jint cgreen = rdr->_cgreen;
     jint cblue = rdr->_cblue;
 
+#ifdef PISCES_SIMD
+    jboolean simd = simdEnabled && imagePixelStride == 1;
+    SIMD_COLOR scolor = simdColor(cred, cgreen, cblue);
+    SIMD_ALPHA salpha = simdAlpha(calpha);
+#endif
+
     minX = rdr->_minTouched;
     maxX = rdr->_maxTouched;
     w = (maxX >= minX) ? (maxX - minX + 1) : 0;
@@ -636,6 +905,19 @@ blitSrcOverMask8888_pre(Renderer *rdr, jint height) {
         a = alpha + alphaOffset;
         am = a + w;
         while (a < am) {
+            if (am - a >= 4 && isEmptyMask4(a)) {
+                a += 4;
+                iidx += 4 * imagePixelStride;
+                continue;
+            }
+#ifdef PISCES_SIMD
+            if (simd && am - a >= 4) {
+                blendSrcOver4_pre(&intData[iidx], a, scolor, salpha);
+                a += 4;
+                iidx += 4;
+                continue;
+            }
+#endif
             if (*a) {
                 aval = *a & 0xff;
                 // run in integers otherwise it overflows
@@ -729,6 +1011,12 @@ blitPTSrcOver8888_pre(Renderer *rdr, jint height) {
     jint* paint = rdr->_paint;
     jint palpha, malpha;
 
+#ifdef PISCES_SIMD
+    jboolean simd = simdEnabled && imagePixelStride == 1;
+    jbyte cov[4];
+    jint k;
+#endif
+
     minX = rdr->_minTouched;
     maxX = rdr->_maxTouched;
     w = (maxX >= minX) ? (maxX - minX + 1) : 0;
@@ -741,6 +1029,23 @@ blitPTSrcOver8888_pre(Renderer *rdr, jint height) {
         a = alpha;
         am = a + w;
         while (a < am) {
+#ifdef PISCES_SIMD
+            if (simd && am - a >= 4) {
+                assert(aidx + 4 <= rdr->_paint_length);
+                for (k = 0; k < 4; k++) {
+                    aval_relative += a[k];
+                    a[k] = 0;
+                    cov[k] = aval_relative ? alphaMap[aval_relative] : 0;
+                }
+                if (!isEmptyMask4(cov)) {
+                    blendSrcOver4_pre_pre(&intData[iidx], cov, &paint[aidx]);
+                }
+                a += 4;
+                iidx += 4;
+                aidx += 4;
+                continue;
+            }
+#endif
             assert(aidx >= 0);
             assert(aidx < rdr->_paint_length);
 
@@ -785,6 +1090,10 @@ blitPTSrcOverMask8888_pre(Renderer *rdr, jint height) {
     jint* paint = rdr->_paint;
     jint palpha, malpha;
 
+#ifdef PISCES_SIMD
+    jboolean simd = simdEnabled && imagePixelStride == 1;
+#endif
+
     minX = rdr->_minTouched;
     maxX = rdr->_maxTouched;
     w = (maxX >= minX) ? (maxX - minX + 1) : 0;
@@ -796,6 +1105,21 @@ blitPTSrcOverMask8888_pre(Renderer *rdr, jint height) {
         a = alpha + alphaOffset;
         am = a + w;
         while (a < am) {
+            if (am - a >= 4 && isEmptyMask4(a)) {
+                a += 4;
+                iidx += 4 * imagePixelStride;
+                aidx += 4;
+                continue;
+            }
+#ifdef PISCES_SIMD
+            if (simd && am - a >= 4) {
+                blendSrcOver4_pre_pre(&intData[iidx], a, &paint[aidx]);
+                a += 4;
+                iidx += 4;
+                aidx += 4;
+                continue;
+            }
+#endif
             if (*a) {
                 cval = paint[aidx];
                 palpha = A(cval);
@@ -865,22 +1189,17 @@ static void
 blendSrcOver8888_pre(jint *intData,
                              jint aval,
                              jint sred, jint sgreen, jint sblue) {
-    jint ival = *intData;
-    //destination alpha
-    jint dalpha = (ival >> 24) & 0xff;
-    //destination components premultiplied by dalpha
-    jint dred = (ival >> 16) & 0xff;
-    jint dgreen = (ival >> 8) & 0xff;
-    jint dblue = ival & 0xff;
+    unsigned int ival = (unsigned int)*intData;
+    //destination components premultiplied by dalpha, alpha|green and red|blue
+    unsigned int dag = (ival >> 8) & LANE_MASK;
+    unsigned int drb = ival & LANE_MASK;
 
-    jint oneminusaval = (255 - aval);
+    unsigned int oneminusaval = (255 - aval);
 
-    jint oalpha  = div255(255 * aval    + oneminusaval * dalpha);
-    jint ored    = div255(sred * aval   + oneminusaval * dred);
-    jint ogreen  = div255(sgreen * aval + oneminusaval * dgreen);
-    jint oblue   = div255(sblue * aval  + oneminusaval * dblue);
+    unsigned int oag = div255x2(((255u << 16) | sgreen) * aval + oneminusaval * dag);
+    unsigned int orb = div255x2((((unsigned int)sred << 16) | sblue) * aval + oneminusaval * drb);
 
-    *intData = (oalpha << 24) | (ored << 16) | (ogreen << 8) | oblue;
+    *intData = (jint)((oag << 8) | orb);
 }
 
 // *intData are premultiplied, sred, sgreen, sblue are premultiplied
@@ -888,45 +1207,38 @@ static void
 blendSrcOver8888_pre_pre(jint *intData, jint frac,
                              jint aval,
                              jint sred, jint sgreen, jint sblue) {
-    jint ival = *intData;
-    //destination alpha
-    jint dalpha = (ival >> 24) & 0xff;
-    //destination components premultiplied by dalpha
-    jint dred = (ival >> 16) & 0xff;
-    jint dgreen = (ival >> 8) & 0xff;
-    jint dblue = ival & 0xff;
+    unsigned int ival = (unsigned int)*intData;
+    //destination components premultiplied by dalpha, alpha|green and red|blue
+    unsigned int dag = (ival >> 8) & LANE_MASK;
+    unsigned int drb = ival & LANE_MASK;
 
     jint aval2 = (aval * frac) >> 8;
-    jint oneminusaval = (255 - aval2);
+    unsigned int oneminusaval = (255 - aval2);
 
-    jint oalpha  = aval2                  + div255(oneminusaval * dalpha);
-    jint ored    = ((sred * frac) >> 8)   + div255(oneminusaval * dred);
-    jint ogreen  = ((sgreen * frac) >> 8) + div255(oneminusaval * dgreen);
-    jint oblue   = ((sblue * frac) >> 8)  + div255(oneminusaval * dblue);
+    unsigned int sag = (((((unsigned int)aval << 16) | sgreen) * frac) >> 8) & LANE_MASK;
+    unsigned int srb = (((((unsigned int)sred << 16) | sblue) * frac) >> 8) & LANE_MASK;
 
-    *intData = (oalpha << 24) | (ored << 16) | (ogreen << 8) | oblue;
+    unsigned int oag = sag + div255x2(oneminusaval * dag);
+    unsigned int orb = srb + div255x2(oneminusaval * drb);
+
+    *intData = (jint)((oag << 8) | orb);
 }
 
 // *intData are premultiplied, sred, sgreen, sblue are premultiplied
 static void
 blendSrcOver8888_pre_pre_fullFrac(jint *intData, jint aval,
                              jint sred, jint sgreen, jint sblue) {
-    jint ival = *intData;
-    //destination alpha
-    jint dalpha = (ival >> 24) & 0xff;
-    //destination components premultiplied by dalpha
-    jint dred = (ival >> 16) & 0xff;
-    jint dgreen = (ival >> 8) & 0xff;
-    jint dblue = ival & 0xff;
+    unsigned int ival = (unsigned int)*intData;
+    //destination components premultiplied by dalpha, alpha|green and red|blue
+    unsigned int dag = (ival >> 8) & LANE_MASK;
+    unsigned int drb = ival & LANE_MASK;
 
-    jint oneminusaval = (255 - aval);
+    unsigned int oneminusaval = (255 - aval);
 
-    jint oalpha  = aval   + div255(oneminusaval * dalpha);
-    jint ored    = sred   + div255(oneminusaval * dred);
-    jint ogreen  = sgreen + div255(oneminusaval * dgreen);
-    jint oblue   = sblue  + div255(oneminusaval * dblue);
+    unsigned int oag = (((unsigned int)aval << 16) | sgreen) + div255x2(oneminusaval * dag);
+    unsigned int orb = (((unsigned int)sred << 16) | sblue) + div255x2(oneminusaval * drb);
 
-    *intData = (oalpha << 24) | (ored << 16) | (ogreen << 8) | oblue;
+    *intData = (jint)((oag << 8) | orb);
 }
 
 // *intData are premultiplied, sred, sgreen, sblue are NOT premultiplied
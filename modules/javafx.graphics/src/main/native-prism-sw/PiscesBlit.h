@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2014, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -32,6 +32,30 @@
 #define MIN_ALPHA 0
 #define MAX_ALPHA 255
 
+/*
+ * SrcOver blits and bilinear texture paint process four pixels per step with
+ * SSE2 on x86 and with NEON on ARM, wherever the target instruction set has
+ * them. Both give the same result as the scalar loops, which stay in use for
+ * the other targets.
+ */
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define PISCES_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define PISCES_NEON
+#endif
+
+#if defined(PISCES_SSE2) || defined(PISCES_NEON)
+#define PISCES_SIMD
+#endif
+
+/*
+ * Selects the vector or the scalar loops. Returns whether the vector loops
+ * are in use afterwards, which is never the case without PISCES_SIMD.
+ */
+jboolean setSIMDEnabled(jboolean enabled);
+jboolean isSIMDEnabled(void);
+
 void initGammaArrays(jfloat gamma);
 
 void genLinearGradientPaint(Renderer *rdr, jint height);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2016, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,12 +25,19 @@
 
 #include <PiscesUtil.h>
 #include <PiscesRenderer.h>
+#include <PiscesBlit.h>
 
 #include <PiscesSysutils.h>
 #include <PiscesMath.h>
 
 #include <limits.h>
 
+#if defined(PISCES_SSE2)
+#include <emmintrin.h>
+#elif defined(PISCES_NEON)
+#include <arm_neon.h>
+#endif
+
 #define NO_REPEAT_NO_INTERPOLATE        0
 #define REPEAT_NO_INTERPOLATE           1
 #define NO_REPEAT_INTERPOLATE_NO_ALPHA  2
@@ -56,8 +63,18 @@ static jlong lmod(jlong x, jlong y) {
 #pragma GCC optimize ("O1")
 #endif
 
-static INLINE jint interp(jint x0, jint x1, jint frac) {
-    return ((x0 << 16) + (x1 - x0) * frac + 0x8000) >> 16;
+/*
+ * Interpolated color components are kept as two 32-bit lanes of a 64-bit
+ * value, alpha|green and red|blue. Each lane computes
+ * ((x0 << 16) + (x1 - x0) * frac + 0x8000) >> 16 written as
+ * (x0 * (0x10000 - frac) + x1 * frac + 0x8000) >> 16, which never leaves
+ * the lane for 8-bit components.
+ */
+#define LANE_MASK64  (((ulong64)0xff << 32) | 0xff)
+#define LANE_ROUND64 (((ulong64)0x8000 << 32) | 0x8000)
+
+static INLINE ulong64 interpLanes(ulong64 x0, ulong64 x1, jint frac) {
+    return ((x0 * (ulong64)(0x10000 - frac) + x1 * (ulong64)frac + LANE_ROUND64) >> 16) & LANE_MASK64;
 }
 
 #ifdef GCC_BUG_57967_WORKAROUND
@@ -91,6 +108,15 @@ pad(jint ifrac, jint cycleMethod) {
     return ifrac;
 }
 
+#define LINEAR_GRADIENT_ROW(cycle)                                          \
+    for (i = 0; i < width; i++, pidx++) {                                   \
+        jint ifrac = pad((jint)frac, (cycle));                              \
+        ifrac >>= 16 - LG_GRADIENT_MAP_SIZE;                                \
+        paint[pidx] = colors[ifrac];                                        \
+                                                                            \
+        frac += mx;                                                         \
+    }
+
 void
 genLinearGradientPaint(Renderer *rdr, jint height) {
     jint paintOffset = 0;
@@ -120,18 +146,51 @@ genLinearGradientPaint(Renderer *rdr, jint height) {
         pidx = paintOffset;
 
         frac = x * mx + y * my + b;
-        for (i = 0; i < width; i++, pidx++) {
-            jint ifrac = pad((jint)frac, cycleMethod);
-            ifrac >>= 16 - LG_GRADIENT_MAP_SIZE;
-            paint[pidx] = colors[ifrac];
-
-            frac += mx;
+        if (mx == 0) {
+            // gradient is constant along the row
+            jint cval = colors[pad((jint)frac, cycleMethod) >> (16 - LG_GRADIENT_MAP_SIZE)];
+            for (i = 0; i < width; i++, pidx++) {
+                paint[pidx] = cval;
+            }
+        } else {
+            // pad() is inlined with a constant cycle method in every loop
+            switch (cycleMethod) {
+            case CYCLE_NONE:
+                LINEAR_GRADIENT_ROW(CYCLE_NONE);
+                break;
+            case CYCLE_REPEAT:
+                LINEAR_GRADIENT_ROW(CYCLE_REPEAT);
+                break;
+            case CYCLE_REFLECT:
+                LINEAR_GRADIENT_ROW(CYCLE_REFLECT);
+                break;
+            default:
+                LINEAR_GRADIENT_ROW(cycleMethod);
+                break;
+            }
         }
 
         paintOffset += width;
     }
 }
 
+#define RADIAL_GRADIENT_ROW(cycle)                                          \
+    for (i = 0; i < width; i++, pidx++) {                                   \
+        if (V < 0) {                                                        \
+            V = 0;                                                          \
+        }                                                                   \
+                                                                            \
+        ifrac = (jint)(U + PISCESsqrt(V));                                  \
+                                                                            \
+        U += dU;                                                            \
+        V += dV ;                                                           \
+        dV += ddV;                                                          \
+                                                                            \
+        ifrac = pad(ifrac, (cycle));                                        \
+        ifrac >>= (16 - LG_GRADIENT_MAP_SIZE);                              \
+        paint[pidx] = colors[ifrac];                                        \
+    }
+
 void
 genRadialGradientPaint(Renderer *rdr, jint height) {
     jint cycleMethod = rdr->_gradient_cycleMethod;
@@ -213,43 +272,42 @@ genRadialGradientPaint(Renderer *rdr, jint height) {
         dU  = (65536.0f * dU);
         dV  = (65536.0f * 65536.0f * dV);
         ddV = (65536.0f * 65536.0f * ddV);
-        for (i = 0; i < width; i++, pidx++) {
-            if (V < 0) {
-                V = 0;
-            }
-
-            ifrac = (jint)(U + PISCESsqrt(V));
-
-            U += dU;
-            V += dV ;
-            dV += ddV;
-
-            ifrac = pad(ifrac, cycleMethod);
-            ifrac >>= (16 - LG_GRADIENT_MAP_SIZE);
-            paint[pidx] = colors[ifrac];
+        // pad() is inlined with a constant cycle method in every loop
+        switch (cycleMethod) {
+        case CYCLE_NONE:
+            RADIAL_GRADIENT_ROW(CYCLE_NONE);
+            break;
+        case CYCLE_REPEAT:
+            RADIAL_GRADIENT_ROW(CYCLE_REPEAT);
+            break;
+        case CYCLE_REFLECT:
+            RADIAL_GRADIENT_ROW(CYCLE_REFLECT);
+            break;
+        default:
+            RADIAL_GRADIENT_ROW(cycleMethod);
+            break;
         }
 
         paintOffset += width;
     }
 }
 
+// red|blue lanes of p, use spreadLanes(p >> 8) for alpha|green
+static INLINE ulong64 spreadLanes(jint p) {
+    return ((ulong64)(p & 0xff0000) << 16) | (p & 0xff);
+}
+
+static INLINE jint joinLanes(ulong64 ag, ulong64 rb) {
+    jint cag = (jint)(((ag >> 16) & 0xff0000) | (ag & 0xff));
+    jint crb = (jint)(((rb >> 16) & 0xff0000) | (rb & 0xff));
+    return (cag << 8) | crb;
+}
+
 static INLINE jint interpolate2points(jint p0, jint p1, jint frac) {
-    jint a0 = (p0 >> 24) & 0xff;
-    jint r0 = (p0 >> 16) & 0xff;
-    jint g0 = (p0 >> 8)  & 0xff;
-    jint b0 =  p0        & 0xff;
-
-    jint a1 = (p1 >> 24) & 0xff;
-    jint r1 = (p1 >> 16) & 0xff;
-    jint g1 = (p1 >> 8)  & 0xff;
-    jint b1 =  p1        & 0xff;
-
-    jint aa = interp(a0, a1, frac);
-    jint rr = interp(r0, r1, frac);
-    jint gg = interp(g0, g1, frac);
-    jint bb = interp(b0, b1, frac);
-
-    return (aa << 24) | (rr << 16) | (gg << 8) | bb;
+    ulong64 ag = interpLanes(spreadLanes(p0 >> 8), spreadLanes(p1 >> 8), frac);
+    ulong64 rb = interpLanes(spreadLanes(p0), spreadLanes(p1), frac);
+
+    return joinLanes(ag, rb);
 }
 
 /**
@@ -263,91 +321,22 @@ static INLINE jint interpolate2points(jint p0, jint p1, jint frac) {
 
 static INLINE jint interpolate4points(jint p00, jint p01, jint p10, jint p11,
                                jint hfrac, jint vfrac) {
-    jint a00 = (p00 >> 24) & 0xff;
-    jint r00 = (p00 >> 16) & 0xff;
-    jint g00 = (p00 >> 8)  & 0xff;
-    jint b00 =  p00        & 0xff;
-
-    jint a01 = (p01 >> 24) & 0xff;
-    jint r01 = (p01 >> 16) & 0xff;
-    jint g01 = (p01 >> 8)  & 0xff;
-    jint b01 =  p01        & 0xff;
-
-    jint a0 = interp(a00, a01, hfrac);
-    jint r0 = interp(r00, r01, hfrac);
-    jint g0 = interp(g00, g01, hfrac);
-    jint b0 = interp(b00, b01, hfrac);
-
-    jint a10 = (p10 >> 24) & 0xff;
-    jint r10 = (p10 >> 16) & 0xff;
-    jint g10 = (p10 >> 8)  & 0xff;
-    jint b10 =  p10        & 0xff;
-
-    jint a11 = (p11 >> 24) & 0xff;
-    jint r11 = (p11 >> 16) & 0xff;
-    jint g11 = (p11 >> 8)  & 0xff;
-    jint b11 =  p11        & 0xff;
-
-    jint a1 = interp(a10, a11, hfrac);
-    jint r1 = interp(r10, r11, hfrac);
-    jint g1 = interp(g10, g11, hfrac);
-    jint b1 = interp(b10, b11, hfrac);
-
-    jint aa = interp(a0, a1, vfrac);
-    jint rr = interp(r0, r1, vfrac);
-    jint gg = interp(g0, g1, vfrac);
-    jint bb = interp(b0, b1, vfrac);
-
-    return (aa << 24) | (rr << 16) | (gg << 8) | bb;
-}
-
-static INLINE jint interpolate2pointsNoAlpha(jint p0, jint p1, jint frac) {
-    jint r0 = (p0 >> 16) & 0xff;
-    jint g0 = (p0 >> 8)  & 0xff;
-    jint b0 =  p0        & 0xff;
+    ulong64 ag0 = interpLanes(spreadLanes(p00 >> 8), spreadLanes(p01 >> 8), hfrac);
+    ulong64 rb0 = interpLanes(spreadLanes(p00), spreadLanes(p01), hfrac);
 
-    jint r1 = (p1 >> 16) & 0xff;
-    jint g1 = (p1 >> 8)  & 0xff;
-    jint b1 =  p1        & 0xff;
+    ulong64 ag1 = interpLanes(spreadLanes(p10 >> 8), spreadLanes(p11 >> 8), hfrac);
+    ulong64 rb1 = interpLanes(spreadLanes(p10), spreadLanes(p11), hfrac);
 
-    jint rr = interp(r0, r1, frac);
-    jint gg = interp(g0, g1, frac);
-    jint bb = interp(b0, b1, frac);
+    return joinLanes(interpLanes(ag0, ag1, vfrac), interpLanes(rb0, rb1, vfrac));
+}
 
-    return (0xff000000) | (rr << 16) | (gg << 8) | bb;
+static INLINE jint interpolate2pointsNoAlpha(jint p0, jint p1, jint frac) {
+    return 0xff000000 | interpolate2points(p0, p1, frac);
 }
 
 static INLINE jint interpolate4pointsNoAlpha(jint p00, jint p01, jint p10, jint p11,
                                       jint hfrac, jint vfrac) {
-    jint r00 = (p00 >> 16) & 0xff;
-    jint g00 = (p00 >> 8)  & 0xff;
-    jint b00 =  p00        & 0xff;
-
-    jint r01 = (p01 >> 16) & 0xff;
-    jint g01 = (p01 >> 8)  & 0xff;
-    jint b01 =  p01        & 0xff;
-
-    jint r0 = interp(r00, r01, hfrac);
-    jint g0 = interp(g00, g01, hfrac);
-    jint b0 = interp(b00, b01, hfrac);
-
-    jint r10 = (p10 >> 16) & 0xff;
-    jint g10 = (p10 >> 8)  & 0xff;
-    jint b10 =  p10        & 0xff;
-
-    jint r11 = (p11 >> 16) & 0xff;
-    jint g11 = (p11 >> 8)  & 0xff;
-    jint b11 =  p11        & 0xff;
-
-    jint r1 = interp(r10, r11, hfrac);
-    jint g1 = interp(g10, g11, hfrac);
-    jint b1 = interp(b10, b11, hfrac);
-
-    jint rr = interp(r0, r1, vfrac);
-    jint gg = interp(g0, g1, vfrac);
-    jint bb = interp(b0, b1, vfrac);
-
-    return (0xff000000) | (rr << 16) | (gg << 8) | bb;
+    return 0xff000000 | interpolate4points(p00, p01, p10, p11, hfrac, vfrac);
 }
 
 static INLINE jboolean isInBoundsNoRepeat(jint *a, jlong *la, jint min, jint max) {
@@ -405,6 +394,216 @@ static INLINE void getPointsToInterpolateRepeat(jint *pts, jint *data, jint sidx
     pts[2] = (isXin) ? data[sidx2 + 1] : data[sidx2 - MAX(tx,0)];
 }
 
+#ifdef PISCES_SIMD
+
+/*
+ * interpolate4x4() is interpolate4points() of four pixels, p00, p01, p10 and
+ * p11 holding the four texels of each. Without alpha, it makes the pixels
+ * opaque like interpolate4pointsNoAlpha() unless both fractions are 0.
+ * lerp() computes interpLanes() as x0 + (((x1 - x0) * frac + 0x8000) >> 16)
+ * on every 16-bit lane, with f = frac - 0x8000 so that it fits in 16 bits.
+ */
+#if defined(PISCES_SSE2)
+
+static INLINE __m128i lerp(__m128i x0, __m128i x1, __m128i f) {
+    __m128i d = _mm_sub_epi16(x1, x0);
+    // (d * f + 0x8000 * (d + 1)) >> 16 is the high half of d * f, plus
+    // (d + 1) >> 1, plus the carry of 0x8000 into the low half when d is even
+    __m128i hi = _mm_mulhi_epi16(d, f);
+    __m128i lo = _mm_mullo_epi16(d, f);
+    __m128i half = _mm_srai_epi16(_mm_add_epi16(d, _mm_set1_epi16(1)), 1);
+    __m128i carry = _mm_andnot_si128(d, _mm_srli_epi16(lo, 15));
+    return _mm_add_epi16(_mm_add_epi16(x0, hi), _mm_add_epi16(half, carry));
+}
+
+static INLINE void interpolate4x4(jint *paint, jint *p00, jint *p01, jint *p10, jint *p11,
+                                  jint *hfrac, jint vfrac, jboolean hasAlpha) {
+    const __m128i zero = _mm_setzero_si128();
+    __m128i h = _mm_loadu_si128((__m128i *)hfrac);
+    __m128i v = _mm_set1_epi16((short)(vfrac - 0x8000));
+    __m128i f, hlo, hhi, t00, t01, t10, t11, lo, hi, result;
+
+    // frac - 0x8000 of each pixel over its 4 lanes
+    f = _mm_sub_epi32(h, _mm_set1_epi32(0x8000));
+    f = _mm_packs_epi32(f, f);
+    f = _mm_unpacklo_epi16(f, f);
+    hlo = _mm_unpacklo_epi32(f, f);
+    hhi = _mm_unpackhi_epi32(f, f);
+
+    t00 = _mm_loadu_si128((__m128i *)p00);
+    t01 = _mm_loadu_si128((__m128i *)p01);
+    t10 = _mm_loadu_si128((__m128i *)p10);
+    t11 = _mm_loadu_si128((__m128i *)p11);
+
+    lo = lerp(lerp(_mm_unpacklo_epi8(t00, zero), _mm_unpacklo_epi8(t01, zero), hlo),
+              lerp(_mm_unpacklo_epi8(t10, zero), _mm_unpacklo_epi8(t11, zero), hlo), v);
+    hi = lerp(lerp(_mm_unpackhi_epi8(t00, zero), _mm_unpackhi_epi8(t01, zero), hhi),
+              lerp(_mm_unpackhi_epi8(t10, zero), _mm_unpackhi_epi8(t11, zero), hhi), v);
+    result = _mm_packus_epi16(lo, hi);
+
+    if (!hasAlpha) {
+        __m128i opaque = _mm_set1_epi32((int)0xff000000);
+        if (vfrac == 0) {
+            opaque = _mm_andnot_si128(_mm_cmpeq_epi32(h, zero), opaque);
+        }
+        result = _mm_or_si128(result, opaque);
+    }
+    _mm_storeu_si128((__m128i *)paint, result);
+}
+
+#else // PISCES_NEON
+
+static INLINE int16x8_t lerp(int16x8_t x0, int16x8_t x1, int16x8_t f) {
+    int16x8_t d = vsubq_s16(x1, x0);
+    int16x8_t d1 = vaddq_s16(d, vdupq_n_s16(1));
+    // d * f + 0x8000 * (d + 1) == (x1 - x0) * frac + 0x8000
+    int32x4_t lo = vmlal_s16(vshll_n_s16(vget_low_s16(d1), 15), vget_low_s16(d), vget_low_s16(f));
+    int32x4_t hi = vmlal_s16(vshll_n_s16(vget_high_s16(d1), 15), vget_high_s16(d), vget_high_s16(f));
+    return vaddq_s16(x0, vcombine_s16(vshrn_n_s32(lo, 16), vshrn_n_s32(hi, 16)));
+}
+
+static INLINE int16x8_t widen(uint8x8_t x) {
+    return vreinterpretq_s16_u16(vmovl_u8(x));
+}
+
+static INLINE void interpolate4x4(jint *paint, jint *p00, jint *p01, jint *p10, jint *p11,
+                                  jint *hfrac, jint vfrac, jboolean hasAlpha) {
+    int32x4_t h = vld1q_s32(hfrac);
+    int16x8_t v = vdupq_n_s16((int16_t)(vfrac - 0x8000));
+    int16x4x2_t f2, flo, fhi;
+    int16x8_t hlo, hhi, lo, hi;
+    uint8x16_t t00, t01, t10, t11;
+    uint32x4_t result;
+
+    // frac - 0x8000 of each pixel over its 4 lanes
+    int16x4_t f = vmovn_s32(vsubq_s32(h, vdupq_n_s32(0x8000)));
+    f2 = vzip_s16(f, f);
+    flo = vzip_s16(f2.val[0], f2.val[0]);
+    fhi = vzip_s16(f2.val[1], f2.val[1]);
+    hlo = vcombine_s16(flo.val[0], flo.val[1]);
+    hhi = vcombine_s16(fhi.val[0], fhi.val[1]);
+
+    t00 = vld1q_u8((uint8_t *)p00);
+    t01 = vld1q_u8((uint8_t *)p01);
+    t10 = vld1q_u8((uint8_t *)p10);
+    t11 = vld1q_u8((uint8_t *)p11);
+
+    lo = lerp(lerp(widen(vget_low_u8(t00)), widen(vget_low_u8(t01)), hlo),
+              lerp(widen(vget_low_u8(t10)), widen(vget_low_u8(t11)), hlo), v);
+    hi = lerp(lerp(widen(vget_high_u8(t00)), widen(vget_high_u8(t01)), hhi),
+              lerp(widen(vget_high_u8(t10)), widen(vget_high_u8(t11)), hhi), v);
+    result = vreinterpretq_u32_u8(vcombine_u8(vqmovun_s16(lo), vqmovun_s16(hi)));
+
+    if (!hasAlpha) {
+        uint32x4_t opaque = vdupq_n_u32(0xff000000);
+        if (vfrac == 0) {
+            opaque = vbicq_u32(opaque, vceqq_s32(h, vdupq_n_s32(0)));
+        }
+        result = vorrq_u32(result, opaque);
+    }
+    vst1q_u32((uint32_t *)paint, result);
+}
+
+#endif
+
+/*
+ * Bilinear texture paint for translate and scale transforms. Since m10 is 0,
+ * the texture rows and vfrac are the same for a whole row of paint, so they
+ * are found once per row. Texels are fetched as in the per-pixel loops of
+ * genTexturePaintTarget() and interpolated four pixels at a time, which
+ * gives the same paint.
+ */
+static void
+genTexturePaintScaled(Renderer *rdr, jint *paint, jint height) {
+    jint j, k;
+    jint paintStride = rdr->_alphaWidth;
+    jint paintOffset = 0;
+
+    jint x, y;
+    jint* txtData = rdr->_texture_intData;
+    jint txtWidth = rdr->_texture_imageWidth;
+    jint txtHeight = rdr->_texture_imageHeight;
+    jint txtStride = rdr->_texture_stride;
+    jint txMin = rdr->_texture_txMin;
+    jint tyMin = rdr->_texture_tyMin;
+    jint txMax = rdr->_texture_txMax;
+    jint tyMax = rdr->_texture_tyMax;
+    jint m00 = rdr->_texture_m00;
+    jboolean repeat = rdr->_texture_repeat;
+    jboolean hasAlpha = rdr->_texture_hasAlpha;
+
+    jint *row0, *row1;
+    jint *a, *am;
+    jlong ltx, lty;
+    jint tx, ty, txc, vfrac;
+    jint p00[4], p01[4], p10[4], p11[4], hfrac[4];
+
+    y = rdr->_currY;
+    for (j = 0; j < height; j++, y++) {
+        x = rdr->_currX;
+
+        ltx = x * m00 + y * rdr->_texture_m01 + rdr->_texture_m02;
+        lty = x * rdr->_texture_m10 + y * rdr->_texture_m11 + rdr->_texture_m12;
+
+        ty = (jint)(lty >> 16);
+        vfrac = (jint)(lty & 0xffff);
+        if (repeat) {
+            checkBoundsRepeat(&ty, &lty, tyMin-1, tyMax);
+        } else {
+            checkBoundsNoRepeat(&ty, &lty, tyMin-1, tyMax);
+        }
+        row0 = txtData + MAX(0, ty) * txtStride;
+        if (ty < txtHeight-1) {
+            row1 = row0 + txtStride;
+        } else {
+            row1 = repeat ? txtData : row0;
+        }
+
+        a = paint + paintOffset;
+        am = a + paintStride;
+        while (a < am) {
+            jint n = (jint)MIN(4, am - a);
+            for (k = 0; k < n; k++) {
+                tx = (jint)(ltx >> 16);
+                hfrac[k] = (jint)(ltx & 0xffff);
+                if (repeat) {
+                    checkBoundsRepeat(&tx, &ltx, txMin-1, txMax);
+                } else {
+                    checkBoundsNoRepeat(&tx, &ltx, txMin-1, txMax);
+                }
+                txc = MAX(0, tx);
+                p00[k] = row0[txc];
+                p10[k] = row1[txc];
+                if (tx < txtWidth-1) {
+                    p01[k] = row0[txc + 1];
+                    p11[k] = row1[txc + 1];
+                } else if (repeat) {
+                    p01[k] = row0[0];
+                    p11[k] = row1[0];
+                } else {
+                    p01[k] = p00[k];
+                    p11[k] = p10[k];
+                }
+                ltx += m00;
+            }
+            if (n == 4) {
+                interpolate4x4(a, p00, p01, p10, p11, hfrac, vfrac, hasAlpha);
+            } else {
+                for (k = 0; k < n; k++) {
+                    a[k] = interpolate4points(p00[k], p01[k], p10[k], p11[k], hfrac[k], vfrac);
+                    if (!hasAlpha && (hfrac[k] || vfrac)) {
+                        a[k] |= 0xff000000;
+                    }
+                }
+            }
+            a += n;
+        }
+        paintOffset += paintStride;
+    }
+}
+
+#endif // PISCES_SIMD
+
 void
 genTexturePaintTarget(Renderer *rdr, jint *paint, jint height) {
     jint j;
@@ -434,6 +633,16 @@ genTexturePaintTarget(Renderer *rdr, jint *paint, jint height) {
             REPEAT_NO_INTERPOLATE : NO_REPEAT_NO_INTERPOLATE;
     }
 
+#ifdef PISCES_SIMD
+    if (rdr->_texture_interpolate && isSIMDEnabled() &&
+        (rdr->_texture_transformType == TEXTURE_TRANSFORM_TRANSLATE ||
+         rdr->_texture_transformType == TEXTURE_TRANSFORM_SCALE_TRANSLATE))
+    {
+        genTexturePaintScaled(rdr, paint, height);
+        return;
+    }
+#endif
+
     switch (rdr->_texture_transformType) {
     case TEXTURE_TRANSFORM_IDENTITY:
         // There used to be special case code for IDENTITY, but it had a number
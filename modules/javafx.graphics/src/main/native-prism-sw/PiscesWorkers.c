@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include <PiscesWorkers.h>
+
+#include <PiscesUtil.h>
+
+#ifdef _WIN32
+#include <windows.h>
+
+typedef CRITICAL_SECTION WorkerMutex;
+typedef CONDITION_VARIABLE WorkerCond;
+
+#define MUTEX_INIT(m)     InitializeCriticalSection(m)
+#define MUTEX_LOCK(m)     EnterCriticalSection(m)
+#define MUTEX_UNLOCK(m)   LeaveCriticalSection(m)
+#define COND_INIT(c)      InitializeConditionVariable(c)
+#define COND_WAIT(c, m)   SleepConditionVariableCS(c, m, INFINITE)
+#define COND_BROADCAST(c) WakeAllConditionVariable(c)
+#else
+#include <pthread.h>
+
+typedef pthread_mutex_t WorkerMutex;
+typedef pthread_cond_t WorkerCond;
+
+#define MUTEX_INIT(m)     pthread_mutex_init(m, NULL)
+#define MUTEX_LOCK(m)     pthread_mutex_lock(m)
+#define MUTEX_UNLOCK(m)   pthread_mutex_unlock(m)
+#define COND_INIT(c)      pthread_cond_init(c, NULL)
+#define COND_WAIT(c, m)   pthread_cond_wait(c, m)
+#define COND_BROADCAST(c) pthread_cond_broadcast(c)
+#endif
+
+static WorkerMutex workLock;
+static WorkerCond workCond;
+static WorkerCond doneCond;
+
+static jint threadCount = 1;
+
+// current job, guarded by workLock
+static WorkerTask jobTask = NULL;
+static void *jobArg = NULL;
+static jint jobCount = 0;
+static jint jobNext = 0;
+static jint jobDone = 0;
+static jint jobGeneration = 0;
+static jboolean jobRunning = XNI_FALSE;
+
+/*
+ * Claims and runs indices of the current job until none is left.
+ * Must be called with workLock held, returns with workLock held.
+ */
+static void
+runPendingTasks() {
+    while (jobNext < jobCount) {
+        jint index = jobNext++;
+        WorkerTask task = jobTask;
+        void *arg = jobArg;
+
+        MUTEX_UNLOCK(&workLock);
+        task(arg, index);
+        MUTEX_LOCK(&workLock);
+
+        if (++jobDone == jobCount) {
+            COND_BROADCAST(&doneCond);
+        }
+    }
+}
+
+#ifdef _WIN32
+static DWORD WINAPI
+workerMain(LPVOID param) {
+#else
+static void *
+workerMain(void *param) {
+#endif
+    jint seenGeneration = 0;
+
+    MUTEX_LOCK(&workLock);
+    for (;;) {
+        while (seenGeneration == jobGeneration) {
+            COND_WAIT(&workCond, &workLock);
+        }
+        seenGeneration = jobGeneration;
+        runPendingTasks();
+    }
+    // never reached, workers live as long as the process
+#ifdef _WIN32
+    return 0;
+#else
+    return NULL;
+#endif
+}
+
+static jboolean
+startWorker() {
+#ifdef _WIN32
+    HANDLE thread = CreateThread(NULL, 0, workerMain, NULL, 0, NULL);
+    if (thread == NULL) {
+        return XNI_FALSE;
+    }
+    CloseHandle(thread);
+#else
+    pthread_t thread;
+    if (pthread_create(&thread, NULL, workerMain, NULL) != 0) {
+        return XNI_FALSE;
+    }
+    pthread_detach(thread);
+#endif
+    return XNI_TRUE;
+}
+
+jint
+workers_getCount() {
+    return threadCount;
+}
+
+void
+workers_setCount(jint count) {
+    static jboolean initialized = XNI_FALSE;
+
+    count = MIN(count, MAX_WORKER_THREADS);
+    if (count <= threadCount) {
+        return;
+    }
+
+    if (!initialized) {
+        MUTEX_INIT(&workLock);
+        COND_INIT(&workCond);
+        COND_INIT(&doneCond);
+        initialized = XNI_TRUE;
+    }
+
+    while (threadCount < count && startWorker()) {
+        threadCount++;
+    }
+}
+
+void
+workers_run(WorkerTask task, void *arg, jint count) {
+    jint i;
+
+    if (threadCount > 1) {
+        MUTEX_LOCK(&workLock);
+        if (!jobRunning) {
+            jobRunning = XNI_TRUE;
+            jobTask = task;
+            jobArg = arg;
+            jobCount = count;
+            jobNext = 0;
+            jobDone = 0;
+            jobGeneration++;
+            COND_BROADCAST(&workCond);
+
+            runPendingTasks();
+            while (jobDone < jobCount) {
+                COND_WAIT(&doneCond, &workLock);
+            }
+
+            jobTask = NULL;
+            jobArg = NULL;
+            jobRunning = XNI_FALSE;
+            MUTEX_UNLOCK(&workLock);
+            return;
+        }
+        MUTEX_UNLOCK(&workLock);
+    }
+
+    // parallel mode is off or the pool is busy with another renderer
+    for (i = 0; i < count; i++) {
+        task(arg, i);
+    }
+}
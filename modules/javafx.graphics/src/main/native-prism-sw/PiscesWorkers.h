@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#ifndef PISCES_WORKERS_H
+#define PISCES_WORKERS_H
+
+#include <PiscesDefs.h>
+
+#define MAX_WORKER_THREADS 16
+
+/*
+ * Unit of parallel work. Called once for every index in [0, count) passed
+ * to workers_run(). Must not call back into the JVM.
+ */
+typedef void (*WorkerTask)(void *arg, jint index);
+
+/*
+ * Returns number of threads that render in parallel, including the calling
+ * thread. Returns 1 unless parallel rendering was enabled by workers_setCount().
+ */
+jint workers_getCount();
+
+/*
+ * Starts count - 1 worker threads. The pool can only grow, smaller values
+ * are ignored.
+ */
+void workers_setCount(jint count);
+
+/*
+ * Runs task for every index in [0, count) on the worker threads and on the
+ * calling thread, and returns once all of them have completed.
+ */
+void workers_run(WorkerTask task, void *arg, jint count);
+
+#endif //PISCES_WORKERS_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2016, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -48,4 +48,24 @@ public class FramebufferShim extends Framebuffer {
         super.reset();
     }
 
+    @Override
+    public void setStartAddress(int address) {
+        super.setStartAddress(address);
+    }
+
+    @Override
+    public int getDirtyTop() {
+        return super.getDirtyTop();
+    }
+
+    @Override
+    public int getDirtyBottom() {
+        return super.getDirtyBottom();
+    }
+
+    @Override
+    public void clearDirtyRows() {
+        super.clearDirtyRows();
+    }
+
 }
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.javafx.font.freetype;
+
+import java.nio.ByteBuffer;
+
+public class OSFreetypeShim {
+
+    public static final int FT_LOAD_RENDER = OSFreetype.FT_LOAD_RENDER;
+    public static final int FT_LOAD_NO_HINTING = OSFreetype.FT_LOAD_NO_HINTING;
+    public static final int FT_LOAD_NO_BITMAP = OSFreetype.FT_LOAD_NO_BITMAP;
+    public static final int FT_LOAD_IGNORE_TRANSFORM = OSFreetype.FT_LOAD_IGNORE_TRANSFORM;
+    public static final int FT_LOAD_TARGET_NORMAL = OSFreetype.FT_LOAD_TARGET_NORMAL;
+
+    public static final int GLYPH_ERROR = OSFreetype.GLYPH_ERROR;
+    public static final int GLYPH_PIXEL_MODE = OSFreetype.GLYPH_PIXEL_MODE;
+    public static final int GLYPH_WIDTH = OSFreetype.GLYPH_WIDTH;
+    public static final int GLYPH_ROWS = OSFreetype.GLYPH_ROWS;
+    public static final int GLYPH_LEFT = OSFreetype.GLYPH_LEFT;
+    public static final int GLYPH_TOP = OSFreetype.GLYPH_TOP;
+    public static final int GLYPH_ADVANCE_X = OSFreetype.GLYPH_ADVANCE_X;
+    public static final int GLYPH_ADVANCE_Y = OSFreetype.GLYPH_ADVANCE_Y;
+    public static final int GLYPH_LINEAR_ADVANCE = OSFreetype.GLYPH_LINEAR_ADVANCE;
+    public static final int GLYPH_OFFSET = OSFreetype.GLYPH_OFFSET;
+    public static final int GLYPH_METRICS_SIZE = OSFreetype.GLYPH_METRICS_SIZE;
+
+    /**
+     * Opens the face at index 0 of the file with its own library, and
+     * returns the library and the face, or null on error.
+     */
+    public static long[] openFace(String file) {
+        long[] ptr = new long[1];
+        if (OSFreetype.FT_Init_FreeType(ptr) != 0) {
+            return null;
+        }
+        long library = ptr[0];
+        if (OSFreetype.FT_New_Face(library, (file + "\0").getBytes(), 0, ptr) != 0) {
+            OSFreetype.FT_Done_FreeType(library);
+            return null;
+        }
+        return new long[] { library, ptr[0] };
+    }
+
+    public static void closeFace(long[] handles) {
+        OSFreetype.FT_Done_Face(handles[1]);
+        OSFreetype.FT_Done_FreeType(handles[0]);
+    }
+
+    public static int getCharIndex(long face, long charCode) {
+        return OSFreetype.FT_Get_Char_Index(face, charCode);
+    }
+
+    public static int renderGlyphs(long face, long size, int flags, int[] glyphCodes,
+                                   int count, ByteBuffer atlas, int[] metrics) {
+        return OSFreetype.renderGlyphs(face, size, null, flags, glyphCodes, count, atlas, metrics);
+    }
+
+    /**
+     * Loads one glyph and returns the fields of the glyph slot in the order
+     * of the packed metrics of renderGlyphs, without the offset.
+     */
+    public static int[] loadGlyph(long face, long size, int glyphCode, int flags) {
+        OSFreetype.FT_Set_Char_Size(face, 0, size, 72, 72);
+        int[] slot = new int[GLYPH_OFFSET];
+        slot[GLYPH_ERROR] = OSFreetype.FT_Load_Glyph(face, glyphCode, flags);
+        FT_GlyphSlotRec rec = OSFreetype.getGlyphSlot(face);
+        slot[GLYPH_PIXEL_MODE] = rec.bitmap.pixel_mode;
+        slot[GLYPH_WIDTH] = rec.bitmap.width;
+        slot[GLYPH_ROWS] = rec.bitmap.rows;
+        slot[GLYPH_LEFT] = rec.bitmap_left;
+        slot[GLYPH_TOP] = rec.bitmap_top;
+        slot[GLYPH_ADVANCE_X] = (int) rec.advance_x;
+        slot[GLYPH_ADVANCE_Y] = (int) rec.advance_y;
+        slot[GLYPH_LINEAR_ADVANCE] = (int) rec.linearHoriAdvance;
+        return slot;
+    }
+
+}
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.javafx.iio.jpeg;
+
+import com.sun.javafx.iio.ImageFrame;
+import java.io.IOException;
+import java.io.InputStream;
+
+public class JPEGImageLoaderShim {
+
+    /**
+     * Loads a JPEG at the requested size. The DCT scale and the decoded
+     * width and height, before any resampling, are stored in decoded.
+     */
+    public static ImageFrame load(InputStream input, int width, int height,
+                                  boolean preserveAspectRatio, boolean smooth,
+                                  int[] decoded) throws IOException {
+        JPEGImageLoader loader = new JPEGImageLoader(input);
+        ImageFrame frame = loader.load(0, width, height, preserveAspectRatio, smooth, 1.0f, 1.0f);
+        decoded[0] = loader.getDCTScale();
+        decoded[1] = loader.getDecodedWidth();
+        decoded[2] = loader.getDecodedHeight();
+        return frame;
+    }
+
+    public static boolean setSSE2Enabled(boolean enabled) {
+        return JPEGImageLoader.setSSE2Enabled(enabled);
+    }
+
+}
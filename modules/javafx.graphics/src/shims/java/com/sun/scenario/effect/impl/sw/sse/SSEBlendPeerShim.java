@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.scenario.effect.impl.sw.sse;
+
+import com.sun.scenario.effect.Blend;
+
+public class SSEBlendPeerShim {
+
+    private interface BlendFilter {
+        void filter(int[] dstPixels, int dstx, int dsty, int dstw, int dsth, int dstscan,
+                    int bandy, int bandh,
+                    int[] botImg, float src0Rect_x1, float src0Rect_y1,
+                    float src0Rect_x2, float src0Rect_y2,
+                    int src0w, int src0h, int src0scan,
+                    float opacity,
+                    int[] topImg, float src1Rect_x1, float src1Rect_y1,
+                    float src1Rect_x2, float src1Rect_y2,
+                    int src1w, int src1h, int src1scan);
+    }
+
+    private static BlendFilter getFilter(Blend.Mode mode) {
+        return switch (mode) {
+            case SRC_OVER -> SSEBlend_SRC_OVERPeer::filter;
+            case SRC_IN -> SSEBlend_SRC_INPeer::filter;
+            case SRC_OUT -> SSEBlend_SRC_OUTPeer::filter;
+            case SRC_ATOP -> SSEBlend_SRC_ATOPPeer::filter;
+            case ADD -> SSEBlend_ADDPeer::filter;
+            case MULTIPLY -> SSEBlend_MULTIPLYPeer::filter;
+            case SCREEN -> SSEBlend_SCREENPeer::filter;
+            case OVERLAY -> SSEBlend_OVERLAYPeer::filter;
+            case DARKEN -> SSEBlend_DARKENPeer::filter;
+            case LIGHTEN -> SSEBlend_LIGHTENPeer::filter;
+            case COLOR_DODGE -> SSEBlend_COLOR_DODGEPeer::filter;
+            case COLOR_BURN -> SSEBlend_COLOR_BURNPeer::filter;
+            case HARD_LIGHT -> SSEBlend_HARD_LIGHTPeer::filter;
+            case SOFT_LIGHT -> SSEBlend_SOFT_LIGHTPeer::filter;
+            case DIFFERENCE -> SSEBlend_DIFFERENCEPeer::filter;
+            case EXCLUSION -> SSEBlend_EXCLUSIONPeer::filter;
+            case RED -> SSEBlend_REDPeer::filter;
+            case GREEN -> SSEBlend_GREENPeer::filter;
+            case BLUE -> SSEBlend_BLUEPeer::filter;
+        };
+    }
+
+    /**
+     * Blends top over bot, which are both the size of the destination.
+     */
+    public static void filter(Blend.Mode mode, int numBands,
+                              int[] dstPixels, int dstw, int dsth, int dstscan,
+                              int[] botPixels, int[] topPixels, float opacity) {
+        BlendFilter filter = getFilter(mode);
+        SSEEffectPeer.filterRowBands(numBands, 0, dsth, (bandy, bandh) ->
+            filter.filter(dstPixels, 0, 0, dstw, dsth, dstscan,
+                          bandy, bandh,
+                          botPixels, 0f, 0f, 1f, 1f, dstw, dsth, dstscan,
+                          opacity,
+                          topPixels, 0f, 0f, 1f, 1f, dstw, dsth, dstscan));
+    }
+}
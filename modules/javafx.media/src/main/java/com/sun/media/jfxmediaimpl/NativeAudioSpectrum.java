@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,9 +26,11 @@
 package com.sun.media.jfxmediaimpl;
 
 import com.sun.media.jfxmedia.effects.AudioSpectrum;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.FloatBuffer;
 
 final class NativeAudioSpectrum implements AudioSpectrum {
-    private static final float[] EMPTY_FLOAT_ARRAY  = new float[0];
     public static final int      DEFAULT_THRESHOLD = -60;
     public static final int      DEFAULT_BANDS = 128;
     public static final double   DEFAULT_INTERVAL = 0.1;
@@ -38,8 +40,16 @@ final class NativeAudioSpectrum implements AudioSpectrum {
      */
     private final long nativeRef;
 
-    private float[] magnitudes = EMPTY_FLOAT_ARRAY;
-    private float[] phases = EMPTY_FLOAT_ARRAY;
+    private final NativeMediaPlayer player;
+
+    /**
+     * Band data written directly by native code. The buffer holds two halves
+     * of {@code [magnitudes][phases]}; native fills the half that is not
+     * {@link #current} and then publishes it through {@link #bandsUpdated}.
+     */
+    private FloatBuffer bandBuffer;
+    private int bandCount;
+    private volatile int current;
 
     //**************************************************************************
     //***** Constructors
@@ -47,14 +57,16 @@ final class NativeAudioSpectrum implements AudioSpectrum {
 
     /**
      * Constructor.
-     * @param refNativePlayer A reference to the native player.
+     * @param refMedia A reference to the native spectrum.
+     * @param player The player that dispatches the spectrum events.
      */
-    NativeAudioSpectrum(long refMedia) {
+    NativeAudioSpectrum(long refMedia, NativeMediaPlayer player) {
         if (refMedia == 0) {
             throw new IllegalArgumentException("Invalid native media reference");
         }
 
         this.nativeRef = refMedia;
+        this.player = player;
         setBandCount(DEFAULT_BANDS);
     }
 
@@ -73,24 +85,28 @@ final class NativeAudioSpectrum implements AudioSpectrum {
 
     @Override
     public int getBandCount() {
-        // just return the current size of one of the band arrays
-        return phases.length;
+        return bandCount;
     }
 
     @Override
     public void setBandCount(int bands) {
         if (bands > 1) {
-            magnitudes = new float[bands];
-            for (int i = 0; i < magnitudes.length; i++) {
-                magnitudes[i] = DEFAULT_THRESHOLD;//Float.NEGATIVE_INFINITY;
+            ByteBuffer buffer = ByteBuffer.allocateDirect(4 * bands * Float.BYTES)
+                    .order(ByteOrder.nativeOrder());
+            FloatBuffer floats = buffer.asFloatBuffer();
+            for (int half = 0; half < 2; half++) {
+                for (int i = 0; i < bands; i++) {
+                    floats.put(half * 2 * bands + i, DEFAULT_THRESHOLD);
+                }
             }
 
-            phases = new float[bands];
-            nativeSetBands(nativeRef, bands, magnitudes, phases);
+            synchronized (this) {
+                bandBuffer = floats;
+                bandCount = bands;
+                current = 0;
+            }
+            nativeSetBands(nativeRef, bands, buffer);
         } else {
-            magnitudes = EMPTY_FLOAT_ARRAY;
-            phases = EMPTY_FLOAT_ARRAY;
-
             throw new IllegalArgumentException("Number of bands must at least be 2");
         }
     }
@@ -125,22 +141,30 @@ final class NativeAudioSpectrum implements AudioSpectrum {
 
     @Override
     public float[] getMagnitudes(float[] mag) {
-        int size = magnitudes.length;
-        if(mag == null || mag.length < size) {
-            mag = new float[size];
-        }
-        System.arraycopy(magnitudes, 0, mag, 0, size);
-        return mag;
+        return copyBands(mag, 0);
     }
 
     @Override
     public float[] getPhases(float[] phs) {
-        int size = phases.length;
-        if(phs == null || phs.length < size) {
-            phs = new float[size];
+        return copyBands(phs, 1);
+    }
+
+    private synchronized float[] copyBands(float[] dst, int which) {
+        int size = bandCount;
+        if (dst == null || dst.length < size) {
+            dst = new float[size];
         }
-        System.arraycopy(phases, 0, phs, 0, size);
-        return phs;
+        bandBuffer.get((2 * current + which) * size, dst, 0, size);
+        return dst;
+    }
+
+    /**
+     * Called from native code, on the thread that produced the bands, once
+     * per spectrum interval after {@code half} of the band buffer is written.
+     */
+    private void bandsUpdated(int half, double timestamp, double duration, boolean queryTimestamp) {
+        current = half;
+        player.sendAudioSpectrumEvent(timestamp, duration, queryTimestamp);
     }
 
     //**************************************************************************
@@ -148,7 +172,7 @@ final class NativeAudioSpectrum implements AudioSpectrum {
     //**************************************************************************
     private native boolean nativeGetEnabled(long nativeRef);
     private native void    nativeSetEnabled(long nativeRef, boolean enable);
-    private native void    nativeSetBands(long nativeRef, int bands, float[] magnitudes, float[] phases);
+    private native void    nativeSetBands(long nativeRef, int bands, ByteBuffer buffer);
     private native double  nativeGetInterval(long nativeRef);
     private native void    nativeSetInterval(long nativeRef, double interval);
     private native int     nativeGetThreshold(long nativeRef);
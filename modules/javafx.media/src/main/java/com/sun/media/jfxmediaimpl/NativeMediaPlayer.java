@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -1694,7 +1694,7 @@ public abstract class NativeMediaPlayer implements MediaPlayer, MarkerStateListe
     }
 
     protected AudioSpectrum createNativeAudioSpectrum(long nativeRef) {
-        return new NativeAudioSpectrum(nativeRef);
+        return new NativeAudioSpectrum(nativeRef, this);
     }
 }
 
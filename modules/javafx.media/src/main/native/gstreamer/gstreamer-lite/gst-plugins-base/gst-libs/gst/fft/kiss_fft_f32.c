@@ -12,6 +12,132 @@
  fixed or floating point complex numbers.  It also delares the kf_ internal functions.
  */
 
+#ifdef GSTREAMER_LITE
+/* Two complex values per 128-bit vector (r0 i0 r1 i1). The butterflies below
+ * process two outputs per iteration with the same operations, in the same
+ * order, as C_MUL/C_ADD/C_SUB, so SSE2 results match the scalar path bit for
+ * bit. Odd leftovers fall through to the scalar code. */
+#if defined (__SSE2__) || defined (_M_X64) || (defined (_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define KF_SIMD 1
+typedef __m128 kf_v2cpx;
+
+static inline kf_v2cpx
+kf_load2 (const kiss_fft_f32_cpx * a)
+{
+  return _mm_loadu_ps (&a->r);
+}
+
+static inline kf_v2cpx
+kf_gather2 (const kiss_fft_f32_cpx * a, const kiss_fft_f32_cpx * b)
+{
+  return _mm_loadh_pi (_mm_loadl_pi (_mm_setzero_ps (), (const __m64 *) a),
+      (const __m64 *) b);
+}
+
+static inline kf_v2cpx
+kf_splat2 (const kiss_fft_f32_cpx * a)
+{
+  __m128 v = _mm_loadl_pi (_mm_setzero_ps (), (const __m64 *) a);
+  return _mm_movelh_ps (v, v);
+}
+
+static inline void
+kf_store2 (kiss_fft_f32_cpx * a, kf_v2cpx v)
+{
+  _mm_storeu_ps (&a->r, v);
+}
+
+static inline void
+kf_scatter2 (kiss_fft_f32_cpx * a, kiss_fft_f32_cpx * b, kf_v2cpx v)
+{
+  _mm_storel_pi ((__m64 *) a, v);
+  _mm_storeh_pi ((__m64 *) b, v);
+}
+
+#define kf_add2(a, b) _mm_add_ps (a, b)
+#define kf_sub2(a, b) _mm_sub_ps (a, b)
+
+/* (i, r) of each complex with the new real part negated: a * -j */
+static inline kf_v2cpx
+kf_mul_mj2 (kf_v2cpx a)
+{
+  const __m128 sign =
+      _mm_castsi128_ps (_mm_setr_epi32 (0, 0x80000000, 0, 0x80000000));
+  return _mm_xor_ps (_mm_shuffle_ps (a, a, _MM_SHUFFLE (2, 3, 0, 1)), sign);
+}
+
+/* C_MUL: (a.r*b.r - a.i*b.i, a.r*b.i + a.i*b.r) */
+static inline kf_v2cpx
+kf_cmul2 (kf_v2cpx a, kf_v2cpx b)
+{
+  const __m128 sign =
+      _mm_castsi128_ps (_mm_setr_epi32 (0x80000000, 0, 0x80000000, 0));
+  __m128 ar = _mm_shuffle_ps (a, a, _MM_SHUFFLE (2, 2, 0, 0));
+  __m128 ai = _mm_shuffle_ps (a, a, _MM_SHUFFLE (3, 3, 1, 1));
+  __m128 bs = _mm_shuffle_ps (b, b, _MM_SHUFFLE (2, 3, 0, 1));
+  return _mm_add_ps (_mm_mul_ps (ar, b), _mm_xor_ps (_mm_mul_ps (ai, bs),
+          sign));
+}
+#elif defined (__ARM_NEON) || defined (__ARM_NEON__)
+#include <arm_neon.h>
+#define KF_SIMD 1
+typedef float32x4_t kf_v2cpx;
+
+static inline kf_v2cpx
+kf_load2 (const kiss_fft_f32_cpx * a)
+{
+  return vld1q_f32 (&a->r);
+}
+
+static inline kf_v2cpx
+kf_gather2 (const kiss_fft_f32_cpx * a, const kiss_fft_f32_cpx * b)
+{
+  return vcombine_f32 (vld1_f32 (&a->r), vld1_f32 (&b->r));
+}
+
+static inline kf_v2cpx
+kf_splat2 (const kiss_fft_f32_cpx * a)
+{
+  float32x2_t v = vld1_f32 (&a->r);
+  return vcombine_f32 (v, v);
+}
+
+static inline void
+kf_store2 (kiss_fft_f32_cpx * a, kf_v2cpx v)
+{
+  vst1q_f32 (&a->r, v);
+}
+
+static inline void
+kf_scatter2 (kiss_fft_f32_cpx * a, kiss_fft_f32_cpx * b, kf_v2cpx v)
+{
+  vst1_f32 (&a->r, vget_low_f32 (v));
+  vst1_f32 (&b->r, vget_high_f32 (v));
+}
+
+#define kf_add2(a, b) vaddq_f32 (a, b)
+#define kf_sub2(a, b) vsubq_f32 (a, b)
+
+static inline kf_v2cpx
+kf_mul_mj2 (kf_v2cpx a)
+{
+  static const float sign[4] = { 1.0f, -1.0f, 1.0f, -1.0f };
+  return vmulq_f32 (vrev64q_f32 (a), vld1q_f32 (sign));
+}
+
+static inline kf_v2cpx
+kf_cmul2 (kf_v2cpx a, kf_v2cpx b)
+{
+  static const float sign[4] = { -1.0f, 1.0f, -1.0f, 1.0f };
+  float32x4x2_t ari = vtrnq_f32 (a, a);
+  float32x4_t bs = vrev64q_f32 (b);
+  return vaddq_f32 (vmulq_f32 (ari.val[0], b),
+      vmulq_f32 (vmulq_f32 (ari.val[1], bs), vld1q_f32 (sign)));
+}
+#endif
+#endif // GSTREAMER_LITE
+
 static void
 kf_bfly2 (kiss_fft_f32_cpx * Fout,
     const size_t fstride, const kiss_fft_f32_cfg st, int m)
@@ -20,6 +146,19 @@ kf_bfly2 (kiss_fft_f32_cpx * Fout,
   kiss_fft_f32_cpx *tw1 = st->twiddles;
   kiss_fft_f32_cpx t;
   Fout2 = Fout + m;
+#ifdef KF_SIMD
+  for (; m >= 2; m -= 2) {
+    kf_v2cpx f = kf_load2 (Fout);
+    kf_v2cpx tv = kf_cmul2 (kf_load2 (Fout2), kf_gather2 (tw1, tw1 + fstride));
+    tw1 += 2 * fstride;
+    kf_store2 (Fout2, kf_sub2 (f, tv));
+    kf_store2 (Fout, kf_add2 (f, tv));
+    Fout2 += 2;
+    Fout += 2;
+  }
+  if (m == 0)
+    return;
+#endif
   do {
     C_FIXDIV (*Fout, 2);
     C_FIXDIV (*Fout2, 2);
@@ -46,6 +185,38 @@ kf_bfly4 (kiss_fft_f32_cpx * Fout,
 
   tw3 = tw2 = tw1 = st->twiddles;
 
+#ifdef KF_SIMD
+  for (; k >= 2; k -= 2) {
+    kf_v2cpx s0, s1, s2, s3, s4, s5, f;
+
+    s0 = kf_cmul2 (kf_load2 (Fout + m), kf_gather2 (tw1, tw1 + fstride));
+    s1 = kf_cmul2 (kf_load2 (Fout + m2), kf_gather2 (tw2, tw2 + fstride * 2));
+    s2 = kf_cmul2 (kf_load2 (Fout + m3), kf_gather2 (tw3, tw3 + fstride * 3));
+
+    f = kf_load2 (Fout);
+    s5 = kf_sub2 (f, s1);
+    f = kf_add2 (f, s1);
+    s3 = kf_add2 (s0, s2);
+    s4 = kf_mul_mj2 (kf_sub2 (s0, s2));
+    kf_store2 (Fout + m2, kf_sub2 (f, s3));
+    tw1 += fstride * 2;
+    tw2 += fstride * 4;
+    tw3 += fstride * 6;
+    kf_store2 (Fout, kf_add2 (f, s3));
+
+    if (st->inverse) {
+      kf_store2 (Fout + m, kf_sub2 (s5, s4));
+      kf_store2 (Fout + m3, kf_add2 (s5, s4));
+    } else {
+      kf_store2 (Fout + m, kf_add2 (s5, s4));
+      kf_store2 (Fout + m3, kf_sub2 (s5, s4));
+    }
+    Fout += 2;
+  }
+  if (k == 0)
+    return;
+#endif
+
   do {
     C_FIXDIV (*Fout, 4);
     C_FIXDIV (Fout[m], 4);
@@ -217,7 +388,27 @@ kf_bfly_generic (kiss_fft_f32_cpx * Fout,
     }
 
     k = u;
-    for (q1 = 0; q1 < p; ++q1) {
+    q1 = 0;
+#ifdef KF_SIMD
+    /* two outputs at a time; each lane keeps the scalar accumulation order */
+    for (; q1 + 1 < p; q1 += 2) {
+      int twidx0 = 0, twidx1 = 0;
+      kf_v2cpx acc = kf_splat2 (&scratch[0]);
+      for (q = 1; q < p; ++q) {
+        twidx0 += fstride * k;
+        if (twidx0 >= Norig)
+          twidx0 -= Norig;
+        twidx1 += fstride * (k + m);
+        if (twidx1 >= Norig)
+          twidx1 -= Norig;
+        acc = kf_add2 (acc, kf_cmul2 (kf_splat2 (&scratch[q]),
+                kf_gather2 (&twiddles[twidx0], &twiddles[twidx1])));
+      }
+      kf_scatter2 (&Fout[k], &Fout[k + m], acc);
+      k += 2 * m;
+    }
+#endif
+    for (; q1 < p; ++q1) {
       int twidx = 0;
       Fout[k] = scratch[0];
       for (q = 1; q < p; ++q) {
@@ -138,6 +138,9 @@ static void gst_audio_panorama_s2s_float_simple (gfloat pan,
 
 static GstFlowReturn gst_audio_panorama_transform (GstBaseTransform * base,
     GstBuffer * inbuf, GstBuffer * outbuf);
+#ifdef GSTREAMER_LITE
+static void gst_audio_panorama_update_passthrough (GstAudioPanorama * filter);
+#endif // GSTREAMER_LITE
 
 
 /* Table with processing functions: [channels][format][method] */
@@ -259,6 +262,9 @@ gst_audio_panorama_set_property (GObject * object, guint prop_id,
   switch (prop_id) {
     case PROP_PANORAMA:
       filter->panorama = g_value_get_float (value);
+#ifdef GSTREAMER_LITE
+      gst_audio_panorama_update_passthrough (filter);
+#endif // GSTREAMER_LITE
       break;
     case PROP_METHOD:
       filter->method = g_value_get_enum (value);
@@ -362,6 +368,9 @@ gst_audio_panorama_set_caps (GstBaseTransform * base, GstCaps * incaps,
     goto no_format;
 
   filter->info = info;
+#ifdef GSTREAMER_LITE
+  gst_audio_panorama_update_passthrough (filter);
+#endif // GSTREAMER_LITE
 
   return TRUE;
 
@@ -372,6 +381,26 @@ no_format:
   }
 }
 
+#ifdef GSTREAMER_LITE
+/* Centered stereo input is copied unchanged by both panning methods, so skip
+ * the copy entirely in that case. Mono input always has to be upmixed.
+ */
+static void
+gst_audio_panorama_update_passthrough (GstAudioPanorama * filter)
+{
+  gboolean passthrough = (filter->panorama == 0.0)
+      && (GST_AUDIO_INFO_CHANNELS (&filter->info) == 2);
+
+  /* Controlled properties are only synced in transform() */
+  passthrough &= !gst_object_has_active_control_bindings (GST_OBJECT (filter));
+
+  GST_DEBUG_OBJECT (filter, "set passthrough %d", passthrough);
+
+  gst_base_transform_set_passthrough (GST_BASE_TRANSFORM (filter),
+      passthrough);
+}
+#endif // GSTREAMER_LITE
+
 /* psychoacoustic processing functions */
 
 /* mono to stereo panning
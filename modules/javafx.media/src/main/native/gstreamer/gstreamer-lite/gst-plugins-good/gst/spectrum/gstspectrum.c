@@ -70,6 +70,14 @@ GST_DEBUG_CATEGORY_STATIC (gst_spectrum_debug);
 
 #ifdef GSTREAMER_LITE
 #define MAX_BANDS    1024
+
+#if defined (__SSE2__) || defined (_M_X64) || (defined (_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define SPECTRUM_WINDOW_SSE2 1
+#elif defined (__aarch64__)
+#include <arm_neon.h>
+#define SPECTRUM_WINDOW_NEON 1
+#endif
 #endif // GSTREAMER_LITE
 
 #define ALLOWED_CAPS \
@@ -257,6 +265,16 @@ gst_spectrum_alloc_channel_data (GstSpectrum * spectrum)
     cd->freqdata = g_new0 (GstFFTF32Complex, bands);
     cd->spect_magnitude = g_new0 (gfloat, bands);
     cd->spect_phase = g_new0 (gfloat, bands);
+#ifdef GSTREAMER_LITE
+    /* Same coefficients as gst_fft_f32_window (GST_FFT_WINDOW_HAMMING), but
+     * computed once instead of on every FFT */
+    cd->window = g_new (gdouble, nfft);
+    {
+      guint j;
+      for (j = 0; j < nfft; j++)
+        cd->window[j] = 0.53836 - 0.46164 * cos (2.0 * G_PI * j / nfft);
+    }
+#endif // GSTREAMER_LITE
   }
 }
 
@@ -279,6 +297,9 @@ gst_spectrum_free_channel_data (GstSpectrum * spectrum)
       g_free (cd->freqdata);
       g_free (cd->spect_magnitude);
       g_free (cd->spect_phase);
+#ifdef GSTREAMER_LITE
+      g_free (cd->window);
+#endif // GSTREAMER_LITE
     }
     g_free (spectrum->channel_data);
     spectrum->channel_data = NULL;
@@ -723,6 +744,22 @@ gst_spectrum_message_new (GstSpectrum * spectrum, GstClockTime timestamp,
   if (!spectrum->multi_channel) {
     cd = &spectrum->channel_data[0];
 
+#ifdef GSTREAMER_LITE
+    /* Pass the bands as a single block of floats instead of a list of
+     * boxed values, which is expensive to build and to parse for many bands */
+    if (spectrum->message_magnitude) {
+      GBytes *bytes = g_bytes_new (cd->spect_magnitude,
+          spectrum->bands * sizeof (gfloat));
+      gst_structure_set (s, "magnitude", G_TYPE_BYTES, bytes, NULL);
+      g_bytes_unref (bytes);
+    }
+    if (spectrum->message_phase) {
+      GBytes *bytes = g_bytes_new (cd->spect_phase,
+          spectrum->bands * sizeof (gfloat));
+      gst_structure_set (s, "phase", G_TYPE_BYTES, bytes, NULL);
+      g_bytes_unref (bytes);
+    }
+#else // GSTREAMER_LITE
     if (spectrum->message_magnitude) {
       /* FIXME 0.11: this should be an array, not a list */
       mcv = gst_spectrum_message_add_container (s, GST_TYPE_LIST, "magnitude");
@@ -733,6 +770,7 @@ gst_spectrum_message_new (GstSpectrum * spectrum, GstClockTime timestamp,
       pcv = gst_spectrum_message_add_container (s, GST_TYPE_LIST, "phase");
       gst_spectrum_message_add_list (pcv, cd->spect_phase, spectrum->bands);
     }
+#endif // GSTREAMER_LITE
   } else {
     guint c;
     guint channels = GST_AUDIO_FILTER_CHANNELS (spectrum);
@@ -759,6 +797,39 @@ gst_spectrum_message_new (GstSpectrum * spectrum, GstClockTime timestamp,
   return gst_message_new_element (GST_OBJECT (spectrum), s);
 }
 
+#ifdef GSTREAMER_LITE
+/* dst[i] = src[i] * window[i], multiplied in double precision like the scalar
+ * loop it replaces so the vector and scalar paths produce the same floats */
+static void
+gst_spectrum_apply_window (gfloat * dst, const gfloat * src,
+    const gdouble * window, guint n)
+{
+  guint i = 0;
+
+#if defined (SPECTRUM_WINDOW_SSE2)
+  for (; i + 4 <= n; i += 4) {
+    __m128 in = _mm_loadu_ps (src + i);
+    __m128d lo = _mm_mul_pd (_mm_cvtps_pd (in), _mm_loadu_pd (window + i));
+    __m128d hi = _mm_mul_pd (_mm_cvtps_pd (_mm_movehl_ps (in, in)),
+        _mm_loadu_pd (window + i + 2));
+    _mm_storeu_ps (dst + i, _mm_movelh_ps (_mm_cvtpd_ps (lo),
+            _mm_cvtpd_ps (hi)));
+  }
+#elif defined (SPECTRUM_WINDOW_NEON)
+  for (; i + 4 <= n; i += 4) {
+    float32x4_t in = vld1q_f32 (src + i);
+    float64x2_t lo = vmulq_f64 (vcvt_f64_f32 (vget_low_f32 (in)),
+        vld1q_f64 (window + i));
+    float64x2_t hi = vmulq_f64 (vcvt_high_f64_f32 (in),
+        vld1q_f64 (window + i + 2));
+    vst1q_f32 (dst + i, vcombine_f32 (vcvt_f32_f64 (lo), vcvt_f32_f64 (hi)));
+  }
+#endif
+  for (; i < n; i++)
+    dst[i] = src[i] * window[i];
+}
+#endif // GSTREAMER_LITE
+
 static void
 gst_spectrum_run_fft (GstSpectrum * spectrum, GstSpectrumChannel * cd,
     guint input_pos)
@@ -774,10 +845,22 @@ gst_spectrum_run_fft (GstSpectrum * spectrum, GstSpectrumChannel * cd,
   GstFFTF32Complex *freqdata = cd->freqdata;
   GstFFTF32 *fft_ctx = cd->fft_ctx;
 
+#ifdef GSTREAMER_LITE
+  {
+    /* Unwrap the ring buffer and apply the window in one pass */
+    const gdouble *window = cd->window;
+    guint tail = nfft - input_pos;
+
+    gst_spectrum_apply_window (input_tmp, input + input_pos, window, tail);
+    gst_spectrum_apply_window (input_tmp + tail, input, window + tail,
+        input_pos);
+  }
+#else // GSTREAMER_LITE
   for (i = 0; i < nfft; i++)
     input_tmp[i] = input[(input_pos + i) % nfft];
 
   gst_fft_f32_window (fft_ctx, input_tmp, GST_FFT_WINDOW_HAMMING);
+#endif // GSTREAMER_LITE
 
   gst_fft_f32_fft (fft_ctx, input_tmp, freqdata);
 
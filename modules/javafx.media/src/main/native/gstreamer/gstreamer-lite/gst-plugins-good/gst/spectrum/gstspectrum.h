@@ -57,6 +57,9 @@ struct _GstSpectrumChannel
   gfloat *spect_magnitude;      /* accumulated mangitude and phase */
   gfloat *spect_phase;          /* will be scaled by num_fft before sending */
   GstFFTF32 *fft_ctx;
+#ifdef GSTREAMER_LITE
+  gdouble *window;              /* precomputed Hamming window coefficients */
+#endif // GSTREAMER_LITE
 };
 
 struct _GstSpectrum
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -41,6 +41,12 @@
 GST_DEBUG_CATEGORY_STATIC(audiodecoder_debug);
 #define GST_CAT_DEFAULT audiodecoder_debug
 
+enum
+{
+    PROP_0,
+    PROP_BATCH_FRAMES,
+};
+
 /*
  * The input capabilities.
  */
@@ -123,6 +129,12 @@ static gboolean audiodecoder_src_query(GstPad * pad, GstObject *parent, GstQuery
 static gboolean audiodecoder_init_state(AudioDecoder *decoder);
 static gboolean audiodecoder_open_init(AudioDecoder *decoder, GstCaps* caps);
 static gboolean audiodecoder_src_event(GstPad* pad, GstObject *parent, GstEvent* event);
+static void audiodecoder_set_property(GObject *object, guint property_id, const GValue *value, GParamSpec *pspec);
+static void audiodecoder_get_property(GObject *object, guint property_id, GValue *value, GParamSpec *pspec);
+static gboolean audiodecoder_open_pool(AudioDecoder *decoder, GstCaps *caps);
+static void audiodecoder_close_pool(AudioDecoder *decoder);
+static void audiodecoder_drop_pending(AudioDecoder *decoder);
+static GstFlowReturn audiodecoder_push_pending(AudioDecoder *decoder);
 
 #if DECODE_AUDIO4 || USE_SEND_RECEIVE
 static gboolean audiodecoder_is_oformat_supported(int format);
@@ -136,8 +148,10 @@ static gboolean audiodecoder_is_oformat_supported(int format);
 static void audiodecoder_class_init(AudioDecoderClass * klass)
 {
     GstElementClass *element_class;
+    GObjectClass *gobject_class;
 
     element_class = GST_ELEMENT_CLASS(klass);
+    gobject_class = G_OBJECT_CLASS(klass);
 
     gst_element_class_set_metadata(element_class,
         "AudioDecoder",
@@ -151,6 +165,43 @@ static void audiodecoder_class_init(AudioDecoderClass * klass)
             gst_static_pad_template_get(&sink_factory));
 
     element_class->change_state = audiodecoder_change_state;
+
+    gobject_class->set_property = audiodecoder_set_property;
+    gobject_class->get_property = audiodecoder_get_property;
+
+    g_object_class_install_property (gobject_class, PROP_BATCH_FRAMES,
+        g_param_spec_uint ("batch-frames", "Batch frames",
+        "Maximum number of decoded frames delivered in one output buffer",
+        1, AUDIODECODER_MAX_BATCH_FRAMES, 1,
+        (GParamFlags)(G_PARAM_READWRITE | G_PARAM_CONSTRUCT | G_PARAM_STATIC_STRINGS)));
+}
+
+static void audiodecoder_set_property(GObject *object, guint property_id, const GValue *value, GParamSpec *pspec)
+{
+    AudioDecoder *decoder = AUDIODECODER(object);
+    switch (property_id)
+    {
+    case PROP_BATCH_FRAMES:
+        decoder->batch_frames = g_value_get_uint(value);
+        break;
+    default:
+        G_OBJECT_WARN_INVALID_PROPERTY_ID(object, property_id, pspec);
+        break;
+    }
+}
+
+static void audiodecoder_get_property(GObject *object, guint property_id, GValue *value, GParamSpec *pspec)
+{
+    AudioDecoder *decoder = AUDIODECODER(object);
+    switch (property_id)
+    {
+    case PROP_BATCH_FRAMES:
+        g_value_set_uint(value, decoder->batch_frames);
+        break;
+    default:
+        G_OBJECT_WARN_INVALID_PROPERTY_ID(object, property_id, pspec);
+        break;
+    }
 }
 /*
  * Initialize the new element.
@@ -205,6 +256,12 @@ static gboolean audiodecoder_init_state(AudioDecoder *decoder)
     decoder->sample_rate = 0;
     decoder->bit_rate = 0;
 
+    decoder->pool = NULL;
+    decoder->pool_buffer_size = 0;
+    decoder->pending = NULL;
+    decoder->pending_size = 0;
+    decoder->pending_frames = 0;
+
     basedecoder_init_state(BASEDECODER(decoder));
     return TRUE;
 }
@@ -218,6 +275,9 @@ static void audiodecoder_state_reset(AudioDecoder *decoder)
     // Decoder
     basedecoder_flush(BASEDECODER(decoder));
 
+    // Output data which has not been pushed yet belongs to the old segment.
+    audiodecoder_drop_pending(decoder);
+
     // Flags
     decoder->is_synced = FALSE;
     decoder->is_discont = TRUE;
@@ -233,6 +293,9 @@ static void audiodecoder_close_decoder(AudioDecoder *decoder)
     }
 #endif
 
+    audiodecoder_drop_pending(decoder);
+    audiodecoder_close_pool(decoder);
+
     basedecoder_close_decoder(BASEDECODER(decoder));
 }
 
@@ -328,6 +391,13 @@ audiodecoder_sink_event(GstPad * pad, GstObject *parent, GstEvent * event) {
             break;
         }
 
+        case GST_EVENT_EOS:
+        {
+            // Deliver partially filled batch before end of stream.
+            audiodecoder_push_pending(decoder);
+            break;
+        }
+
 #ifdef DEBUG_OUTPUT
         case GST_EVENT_SEGMENT:
         {
@@ -616,6 +686,10 @@ static gboolean audiodecoder_open_init(AudioDecoder *decoder, GstCaps* caps)
                                "channels", G_TYPE_INT, decoder->num_channels,
                                NULL);
 
+    // Data decoded with the previous format must go out before the new caps,
+    // with its offsets still counted in samples of that format.
+    audiodecoder_push_pending(decoder);
+
     decoder->bytes_per_sample = (AUDIODECODER_BITS_PER_SAMPLE/8) * decoder->num_channels;
 
     // Set the source caps.
@@ -625,17 +699,245 @@ static gboolean audiodecoder_open_init(AudioDecoder *decoder, GstCaps* caps)
         base->is_initialized = gst_pad_push_event(base->srcpad, caps_event);
     }
 
+    // Output buffers are allocated from the pool whenever possible. If the
+    // pool cannot be created we fall back to allocating each buffer.
+    if (base->is_initialized && !audiodecoder_open_pool(decoder, caps))
+        GST_WARNING_OBJECT(decoder, "Failed to create output buffer pool");
+
     gst_caps_unref(caps);
 
     return base->is_initialized;
 }
 
+/*
+ * Creates the pool of output buffers for the negotiated source caps. Each
+ * buffer holds batch_frames frames. Twice the nominal number of samples per
+ * frame is reserved since HE-AAC doubles the frame length of the core codec.
+ */
+static gboolean audiodecoder_open_pool(AudioDecoder *decoder, GstCaps *caps)
+{
+    GstStructure *config = NULL;
+    gsize size = (gsize)decoder->samples_per_frame * 2 * decoder->bytes_per_sample * decoder->batch_frames;
+
+    if (decoder->pool && decoder->pool_buffer_size == size)
+        return TRUE;
+
+    audiodecoder_close_pool(decoder);
+
+    if (size == 0)
+        return FALSE;
+
+    decoder->pool = gst_buffer_pool_new();
+    if (!decoder->pool)
+        return FALSE;
+
+    config = gst_buffer_pool_get_config(decoder->pool);
+    gst_buffer_pool_config_set_params(config, caps, (guint)size, AUDIODECODER_POOL_MIN_BUFFERS, 0);
+    if (!gst_buffer_pool_set_config(decoder->pool, config) ||
+        !gst_buffer_pool_set_active(decoder->pool, TRUE))
+    {
+        audiodecoder_close_pool(decoder);
+        return FALSE;
+    }
+
+    decoder->pool_buffer_size = size;
+
+    return TRUE;
+}
+
+static void audiodecoder_close_pool(AudioDecoder *decoder)
+{
+    if (decoder->pool)
+    {
+        gst_buffer_pool_set_active(decoder->pool, FALSE);
+        gst_object_unref(decoder->pool);
+        decoder->pool = NULL;
+    }
+
+    decoder->pool_buffer_size = 0;
+}
+
+/*
+ * Returns a new output buffer which can hold at least size bytes. Pooled
+ * buffers are used when they are large enough.
+ */
+static GstBuffer* audiodecoder_alloc_buffer(AudioDecoder *decoder, gsize size)
+{
+    GstBuffer *buffer = NULL;
+
+    if (decoder->pool && size <= decoder->pool_buffer_size &&
+        gst_buffer_pool_acquire_buffer(decoder->pool, &buffer, NULL) == GST_FLOW_OK)
+        return buffer;
+
+    return gst_buffer_new_allocate(NULL, MAX(size, decoder->pool_buffer_size), NULL);
+}
+
+static void audiodecoder_drop_pending(AudioDecoder *decoder)
+{
+    if (decoder->pending)
+    {
+        gst_buffer_unmap(decoder->pending, &decoder->pending_info);
+        // INLINE - gst_buffer_unref()
+        gst_buffer_unref(decoder->pending);
+        decoder->pending = NULL;
+    }
+
+    decoder->pending_size = 0;
+    decoder->pending_frames = 0;
+}
+
+/*
+ * Pushes the pending output buffer downstream, if any.
+ */
+static GstFlowReturn audiodecoder_push_pending(AudioDecoder *decoder)
+{
+    BaseDecoder *base = BASEDECODER(decoder);
+    GstBuffer   *outbuf = decoder->pending;
+
+    if (!outbuf)
+        return GST_FLOW_OK;
+
+    gst_buffer_unmap(outbuf, &decoder->pending_info);
+    gst_buffer_set_size(outbuf, decoder->pending_size);
+    decoder->pending = NULL;
+
+    GST_BUFFER_TIMESTAMP(outbuf) = decoder->pending_timestamp;
+    GST_BUFFER_DURATION(outbuf) = decoder->pending_duration;
+    GST_BUFFER_OFFSET(outbuf) = decoder->pending_offset;
+    GST_BUFFER_OFFSET_END(outbuf) = decoder->pending_offset + decoder->pending_size / decoder->bytes_per_sample;
+
+    decoder->pending_size = 0;
+    decoder->pending_frames = 0;
+
+    if (decoder->is_discont) {
+        GST_BUFFER_FLAG_SET(outbuf, GST_BUFFER_FLAG_DISCONT);
+        decoder->is_discont = FALSE;
+    }
+
+    if (base->is_flushing)
+    {
+        // Unref the output buffer.
+        // INLINE - gst_buffer_unref()
+        gst_buffer_unref(outbuf);
+        return GST_FLOW_FLUSHING;
+    }
+
+#ifdef VERBOSE_DEBUG
+    g_print("Buffer: size=%d, ts=%.4f, duration=%.4f, offset=%ld, offset_end=%ld\n",
+            (int)gst_buffer_get_size(outbuf),
+            (double)GST_BUFFER_TIMESTAMP(outbuf)/GST_SECOND, (double)GST_BUFFER_DURATION(outbuf)/GST_SECOND,
+            GST_BUFFER_OFFSET(outbuf), GST_BUFFER_OFFSET_END(outbuf));
+#endif
+
+    return gst_pad_push(base->srcpad, outbuf);
+}
+
+/*
+ * Returns a pointer to size bytes of free space in the pending output buffer.
+ * The pending buffer is pushed first if it cannot hold another frame, and a
+ * new one is allocated if there is none.
+ */
+static guint8* audiodecoder_reserve_output(AudioDecoder *decoder, gsize size, GstFlowReturn *ret)
+{
+    if (decoder->pending && decoder->pending_size + size > decoder->pending_info.size)
+    {
+        *ret = audiodecoder_push_pending(decoder);
+        if (*ret != GST_FLOW_OK)
+            return NULL;
+    }
+
+    if (!decoder->pending)
+    {
+        GstBuffer *outbuf = audiodecoder_alloc_buffer(decoder, size);
+        // Bail out on error.
+        if (outbuf == NULL)
+        {
+            gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR, GST_RESOURCE_ERROR, GST_RESOURCE_ERROR_NO_SPACE_LEFT,
+                                     g_strdup("Decoded audio buffer allocation failed"), NULL, ("audiodecoder.c"), ("audiodecoder_reserve_output"), 0);
+            return NULL;
+        }
+
+        if (!gst_buffer_map(outbuf, &decoder->pending_info, GST_MAP_WRITE))
+        {
+            // INLINE - gst_buffer_unref()
+            gst_buffer_unref(outbuf);
+            gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR, GST_RESOURCE_ERROR, GST_RESOURCE_ERROR_NO_SPACE_LEFT,
+                                     g_strdup("Decoded audio buffer allocation failed"), NULL, ("audiodecoder.c"), ("audiodecoder_reserve_output"), 0);
+            return NULL;
+        }
+
+        decoder->pending = outbuf;
+        decoder->pending_size = 0;
+        decoder->pending_frames = 0;
+        decoder->pending_duration = 0;
+    }
+
+    return decoder->pending_info.data + decoder->pending_size;
+}
+
 static inline int16_t float_to_int(float sample)
 {
     int value = (int)(sample * INT16_MAX);
     return value > INT16_MAX ? INT16_MAX : value < INT16_MIN ? INT16_MIN : (int16_t)value;
 }
 
+#if DECODE_AUDIO4 || USE_SEND_RECEIVE
+/*
+ * Interleaves planar samples of up to AUDIODECODER_OUT_NUM_CHANNELS channels
+ * into the destination buffer.
+ */
+static void audiodecoder_interleave(AVFrame *frame, int channels, int16_t *dest)
+{
+    int sample, ci;
+    int nb_samples = frame->nb_samples;
+
+    if (frame->format == AV_SAMPLE_FMT_S16P)
+    {
+        if (channels == 2)
+        {
+            const int16_t *left = (const int16_t*)frame->data[0];
+            const int16_t *right = (const int16_t*)frame->data[1];
+            for (sample = 0; sample < nb_samples; sample++)
+            {
+                dest[2 * sample] = left[sample];
+                dest[2 * sample + 1] = right[sample];
+            }
+        }
+        else
+        {
+            for (ci = 0; ci < channels; ci++)
+            {
+                const int16_t *src = (const int16_t*)frame->data[ci];
+                for (sample = 0; sample < nb_samples; sample++)
+                    dest[channels * sample + ci] = src[sample];
+            }
+        }
+    }
+    else // AV_SAMPLE_FMT_FLTP
+    {
+        if (channels == 2)
+        {
+            const float *left = (const float*)frame->data[0];
+            const float *right = (const float*)frame->data[1];
+            for (sample = 0; sample < nb_samples; sample++)
+            {
+                dest[2 * sample] = float_to_int(left[sample]);
+                dest[2 * sample + 1] = float_to_int(right[sample]);
+            }
+        }
+        else
+        {
+            for (ci = 0; ci < channels; ci++)
+            {
+                const float *src = (const float*)frame->data[ci];
+                for (sample = 0; sample < nb_samples; sample++)
+                    dest[channels * sample + ci] = float_to_int(src[sample]);
+            }
+        }
+    }
+}
+#endif
+
 /*
  * Processes a buffer of MPEG audio data pushed to the sink pad.
  */
@@ -646,12 +948,11 @@ static GstFlowReturn audiodecoder_chain(GstPad *pad, GstObject *parent, GstBuffe
     GstFlowReturn ret = GST_FLOW_OK;
     int           num_dec = NO_DATA_USED;
     GstMapInfo    info;
-    GstMapInfo    info2;
     gboolean      unmap_buf = FALSE;
 
 #if DECODE_AUDIO4 || USE_SEND_RECEIVE
     gint          got_frame = 0;
-    int           sample, ci;
+    int           ci;
  #else
     gint          outbuf_size = AVCODEC_MAX_AUDIO_FRAME_SIZE;
 #endif
@@ -674,7 +975,11 @@ static GstFlowReturn audiodecoder_chain(GstPad *pad, GstObject *parent, GstBuffe
 
     // Reset state on discont if not after FLUSH_STOP.
     if (GST_BUFFER_IS_DISCONT(buf) && decoder->is_synced)
+    {
+        // Frames decoded before the discontinuity are still valid.
+        audiodecoder_push_pending(decoder);
         audiodecoder_state_reset(decoder);
+    }
 
     if (decoder->initial_offset == GST_BUFFER_OFFSET_NONE)
     {
@@ -741,7 +1046,7 @@ static GstFlowReturn audiodecoder_chain(GstPad *pad, GstObject *parent, GstBuffe
         goto _exit;
     }
 
-    GstBuffer *outbuf = NULL;
+    guint8 *dest = NULL;
 #if DECODE_AUDIO4 || USE_SEND_RECEIVE
     if (!audiodecoder_is_oformat_supported(base->frame->format))
     {
@@ -754,30 +1059,7 @@ static GstFlowReturn audiodecoder_chain(GstPad *pad, GstObject *parent, GstBuffe
     if (outbuf_size < 0) {
         goto _exit;
     }
-#endif
 
-    outbuf = gst_buffer_new_allocate(NULL, outbuf_size, NULL);
-    // Bail out on error.
-    if (outbuf == NULL)
-    {
-        if (ret != GST_FLOW_FLUSHING)
-        {
-            gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR, GST_RESOURCE_ERROR, GST_RESOURCE_ERROR_NO_SPACE_LEFT,
-                                     g_strdup("Decoded audio buffer allocation failed"), NULL, ("audiodecoder.c"), ("audiodecoder_chain"), 0);
-        }
-        goto _exit;
-    }
-
-    if (!gst_buffer_map(outbuf, &info2, GST_MAP_WRITE))
-    {
-        // INLINE - gst_buffer_unref()
-        gst_buffer_unref(outbuf);
-        gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR, GST_RESOURCE_ERROR, GST_RESOURCE_ERROR_NO_SPACE_LEFT,
-                                     g_strdup("Decoded audio buffer allocation failed"), NULL, ("audiodecoder.c"), ("audiodecoder_chain"), 0);
-        goto _exit;
-    }
-
-#if DECODE_AUDIO4 || USE_SEND_RECEIVE
     if (base->frame->format == AV_SAMPLE_FMT_S16P || base->frame->format == AV_SAMPLE_FMT_FLTP)
     {
         // Make sure we received expected data
@@ -786,94 +1068,63 @@ static GstFlowReturn audiodecoder_chain(GstPad *pad, GstObject *parent, GstBuffe
         {
             if (base->frame->data[ci] == NULL)
             {
-                gst_buffer_unmap(outbuf, &info2);
-                // INLINE - gst_buffer_unref()
-                gst_buffer_unref(outbuf);
                 gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR, GST_STREAM_ERROR, GST_STREAM_ERROR_DECODE,
                                      g_strdup("Audio decoding failed"), NULL, ("audiodecoder.c"), ("audiodecoder_chain"), 0);
                 ret = GST_FLOW_ERROR;
                 goto _exit;
             }
         }
+    }
+#endif
+
+    // Begin a new output buffer on the first frame of a batch.
+    if (!decoder->pending || decoder->pending_size + outbuf_size > decoder->pending_info.size)
+    {
+        dest = audiodecoder_reserve_output(decoder, outbuf_size, &ret);
+        if (dest == NULL)
+            goto _exit;
 
-        // Reformat the output frame into single buffer.
-        int16_t *buffer = (int16_t*)info2.data;
-        for (sample = 0; sample < base->frame->nb_samples; sample++)
+        if (decoder->generate_pts)
         {
-            for (ci = 0; ci < cc && ci < AUDIODECODER_OUT_NUM_CHANNELS; ci++)
-            {
-                switch (base->frame->format)
-                {
-                    case AV_SAMPLE_FMT_S16P:
-                        buffer[cc * sample + ci] = ((int16_t*)base->frame->data[ci])[sample];
-                        break;
-                    case AV_SAMPLE_FMT_FLTP:
-                        buffer[cc * sample + ci] = float_to_int(((float*)base->frame->data[ci])[sample]);
-                        break;
-                }
-            }
+            // Calculate the timestamp from the sample count and rate.
+            decoder->pending_timestamp = gst_util_uint64_scale_int(decoder->total_samples, GST_SECOND, decoder->sample_rate);
         }
+        else
+            decoder->pending_timestamp = GST_BUFFER_TIMESTAMP(buf);
+        decoder->pending_offset = decoder->total_samples;
     }
-    else if (base->frame->format == AV_SAMPLE_FMT_S16)
-        memcpy(info2.data, base->frame->data[0], info2.size);
     else
-    {
-        gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR, GST_RESOURCE_ERROR, GST_RESOURCE_ERROR_NO_SPACE_LEFT,
-                                 g_strdup("Unsupported decoder output format"), NULL, ("audiodecoder.c"), ("audiodecoder_chain"), 0);
-        ret = GST_FLOW_ERROR;
-        gst_buffer_unmap(outbuf, &info2);
-        // INLINE - gst_buffer_unref()
-        gst_buffer_unref(outbuf);
-        goto _exit;
-    }
+        dest = decoder->pending_info.data + decoder->pending_size;
 
+#if DECODE_AUDIO4 || USE_SEND_RECEIVE
+    // Reformat the output frame directly into the output buffer.
+    if (base->frame->format == AV_SAMPLE_FMT_S16P || base->frame->format == AV_SAMPLE_FMT_FLTP)
+        audiodecoder_interleave(base->frame, MIN(decoder->num_channels, AUDIODECODER_OUT_NUM_CHANNELS), (int16_t*)dest);
+    else // AV_SAMPLE_FMT_S16
+        memcpy(dest, base->frame->data[0], outbuf_size);
 #else
-    memcpy(info.data, decoder->samples, info.size);
+    memcpy(dest, decoder->samples, outbuf_size);
 #endif
 
-    gst_buffer_unmap(outbuf, &info2);
+    decoder->pending_size += outbuf_size;
+    decoder->pending_frames++;
 
     // Set output buffer properties.
     if (decoder->generate_pts)
-    {
-        // Calculate the timestamp from the sample count and rate.
-        GST_BUFFER_TIMESTAMP(outbuf) = gst_util_uint64_scale_int(decoder->total_samples, GST_SECOND, decoder->sample_rate);
-        GST_BUFFER_DURATION(outbuf) = decoder->frame_duration;
-    }
+        decoder->pending_duration += decoder->frame_duration;
+    else if (GST_BUFFER_DURATION_IS_VALID(buf) && GST_CLOCK_TIME_IS_VALID(decoder->pending_duration))
+        decoder->pending_duration += GST_BUFFER_DURATION(buf);
     else
-    {
-        GST_BUFFER_TIMESTAMP(outbuf) = GST_BUFFER_TIMESTAMP(buf);
-        GST_BUFFER_DURATION(outbuf) = GST_BUFFER_DURATION(buf);
-    }
+        decoder->pending_duration = GST_CLOCK_TIME_NONE;
 
-    GST_BUFFER_OFFSET(outbuf) = decoder->total_samples;
     decoder->total_samples += outbuf_size / decoder->bytes_per_sample;
 
-    GST_BUFFER_OFFSET_END(outbuf) = decoder->total_samples;
-
-    if (decoder->is_discont) {
-        GST_BUFFER_FLAG_SET(outbuf, GST_BUFFER_FLAG_DISCONT);
-        decoder->is_discont = FALSE;
-    }
-
-    if (base->is_flushing)
-    {
-        // Unref the output buffer.
-        // INLINE - gst_buffer_unref()
-        gst_buffer_unref(outbuf);
-
-        ret = GST_FLOW_FLUSHING;
-        goto _exit;
-    }
-
 #ifdef VERBOSE_DEBUG
-    g_print("ret=%s, num_dec=%d, Buffer: size=%d, ts=%.4f, duration=%.4f, offset=%ld, offset_end=%ld\n",
-            gst_flow_get_name(ret), num_dec, outbuf_size,
-            (double)GST_BUFFER_TIMESTAMP(outbuf)/GST_SECOND, (double)GST_BUFFER_DURATION(outbuf)/GST_SECOND,
-            GST_BUFFER_OFFSET(outbuf), GST_BUFFER_OFFSET_END(outbuf));
+    g_print("num_dec=%d, frame size=%d, pending frames=%u\n", num_dec, outbuf_size, decoder->pending_frames);
 #endif
 
-    ret = gst_pad_push(base->srcpad, outbuf);
+    if (decoder->pending_frames >= decoder->batch_frames)
+        ret = audiodecoder_push_pending(decoder);
 
 _exit:
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -47,6 +47,11 @@ G_BEGIN_DECLS
 #define AUDIODECODER_BITS_PER_SAMPLE       16
 #define AUDIODECODER_OUT_NUM_CHANNELS       2
 
+// Upper bound for the number of decoded frames packed into one output buffer.
+#define AUDIODECODER_MAX_BATCH_FRAMES      16
+// Minimum number of buffers preallocated by the output buffer pool.
+#define AUDIODECODER_POOL_MIN_BUFFERS       4
+
 typedef struct _AudioDecoder      AudioDecoder;
 typedef struct _AudioDecoderClass AudioDecoderClass;
 
@@ -75,6 +80,18 @@ struct _AudioDecoder {
     gboolean     generate_pts;
 
     AVPacket     packet;
+
+    GstBufferPool *pool;            // pool of output buffers sized from the source caps
+    gsize        pool_buffer_size;  // size of each pooled buffer (bytes)
+
+    guint        batch_frames;      // number of decoded frames to pack into one output buffer
+    GstBuffer    *pending;          // output buffer being filled, NULL if none
+    GstMapInfo   pending_info;      // write mapping of the pending buffer
+    gsize        pending_size;      // number of bytes written to the pending buffer
+    guint        pending_frames;    // number of frames written to the pending buffer
+    GstClockTime pending_timestamp; // timestamp of the first frame in the pending buffer
+    GstClockTime pending_duration;  // accumulated duration of the pending buffer
+    guint64      pending_offset;    // sample offset of the first frame in the pending buffer
 };
 
 struct _AudioDecoderClass
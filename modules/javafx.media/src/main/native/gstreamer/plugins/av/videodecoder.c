@@ -118,6 +118,7 @@ static GstFlowReturn        videodecoder_chain(GstPad *pad, GstObject *parent, G
 
 static void                 videodecoder_init_state(VideoDecoder *decoder);
 static void                 videodecoder_state_reset(VideoDecoder *decoder);
+static void                 videodecoder_close_pool(VideoDecoder *decoder);
 
 static gboolean videodecoder_configure(VideoDecoder *decoder, GstCaps *sink_caps);
 
@@ -199,6 +200,7 @@ static void videodecoder_dispose(GObject* object)
 {
     VideoDecoder *decoder = VIDEODECODER(object);
 
+    videodecoder_close_pool(decoder);
     basedecoder_close_decoder(BASEDECODER(decoder));
 
     G_OBJECT_CLASS(parent_class)->dispose(object);
@@ -283,6 +285,7 @@ videodecoder_change_state(GstElement* element, GstStateChange transition)
     switch (transition)
     {
         case GST_STATE_CHANGE_PAUSED_TO_READY:
+            videodecoder_close_pool(decoder);
             basedecoder_close_decoder(BASEDECODER(decoder));
             break;
         default:
@@ -366,6 +369,10 @@ static void videodecoder_init_state(VideoDecoder *decoder)
     decoder->v_offset = 0;
     decoder->uv_blocksize = 0;
     decoder->frame_size = 0;
+    decoder->pool = NULL;
+    decoder->pool_frame_size = 0;
+    decoder->pool_hits = 0;
+    decoder->pool_misses = 0;
     decoder->discont = FALSE;
     decoder->codec_id = JFX_CODEC_ID_UNKNOWN;
 #if HEVC_SUPPORT
@@ -670,6 +677,81 @@ static gboolean videodecoder_configure_sourcepad(VideoDecoder *decoder)
 
     return TRUE;
 }
+/***********************************************************************************
+ * Output frame pool
+ ***********************************************************************************/
+static void videodecoder_close_pool(VideoDecoder *decoder)
+{
+    if (decoder->pool)
+    {
+        GST_INFO_OBJECT(decoder, "Frame pool of %u byte frames: %" G_GUINT64_FORMAT
+                        " pooled, %" G_GUINT64_FORMAT " allocated", decoder->pool_frame_size,
+                        decoder->pool_hits, decoder->pool_misses);
+
+        // Frames still held downstream are freed when they are released.
+        gst_buffer_pool_set_active(decoder->pool, FALSE);
+        gst_object_unref(decoder->pool);
+        decoder->pool = NULL;
+    }
+
+    decoder->pool_frame_size = 0;
+    decoder->pool_hits = 0;
+    decoder->pool_misses = 0;
+}
+
+static void videodecoder_open_pool(VideoDecoder *decoder)
+{
+    GstStructure *config = NULL;
+
+    videodecoder_close_pool(decoder);
+
+    if (decoder->frame_size == 0)
+        return;
+
+    decoder->pool = gst_buffer_pool_new();
+    if (!decoder->pool)
+        return;
+
+    config = gst_buffer_pool_get_config(decoder->pool);
+    gst_buffer_pool_config_set_params(config, NULL, decoder->frame_size, 0, VIDEODECODER_POOL_MAX_BUFFERS);
+    if (!gst_buffer_pool_set_config(decoder->pool, config) ||
+        !gst_buffer_pool_set_active(decoder->pool, TRUE))
+    {
+        GST_WARNING_OBJECT(decoder, "Failed to create frame pool");
+        gst_object_unref(decoder->pool);
+        decoder->pool = NULL;
+        return;
+    }
+
+    decoder->pool_frame_size = decoder->frame_size;
+}
+
+/*
+ * Returns a buffer for the next decoded frame. Frames are recycled through the
+ * pool once released downstream. The decoder never waits for a pooled frame.
+ */
+static GstBuffer* videodecoder_alloc_frame(VideoDecoder *decoder)
+{
+    GstBuffer *buffer = NULL;
+    GstBufferPoolAcquireParams params = { 0, };
+
+    if (decoder->pool == NULL || decoder->pool_frame_size != decoder->frame_size)
+        videodecoder_open_pool(decoder);
+
+    if (decoder->pool)
+    {
+        params.flags = GST_BUFFER_POOL_ACQUIRE_FLAG_DONTWAIT;
+        if (gst_buffer_pool_acquire_buffer(decoder->pool, &buffer, &params) == GST_FLOW_OK)
+        {
+            decoder->pool_hits++;
+            return buffer;
+        }
+    }
+
+    decoder->pool_misses++;
+    return gst_buffer_new_allocate(NULL, decoder->frame_size, NULL);
+}
+
 /***********************************************************************************
  * chain
  ***********************************************************************************/
@@ -838,7 +920,7 @@ static GstFlowReturn videodecoder_chain(GstPad *pad, GstObject *parent, GstBuffe
                 data2 = base->frame->data[2];
             }
 
-            GstBuffer *outbuf = gst_buffer_new_allocate(NULL, decoder->frame_size, NULL);
+            GstBuffer *outbuf = videodecoder_alloc_frame(decoder);
             if (outbuf == NULL)
             {
                 if (result != GST_FLOW_FLUSHING)
@@ -46,6 +46,11 @@ G_BEGIN_DECLS
 
 #define AV_VIDEO_DECODER_PLUGIN_NAME "avvideodecoder"
 
+// Maximum number of decoded frames kept by the output buffer pool. Frames
+// requested while all pooled frames are in use are allocated separately and
+// freed when released, which bounds memory held during frame rate spikes.
+#define VIDEODECODER_POOL_MAX_BUFFERS       8
+
 #if HEVC_SUPPORT
 // libswscale APIs
 typedef struct SwsContext *(*sws_getContext_ptr)(int srcW, int srcH,
@@ -81,6 +86,11 @@ struct _VideoDecoder {
 
     gint         codec_id;
 
+    GstBufferPool *pool;         // pool of output frames of frame_size bytes
+    unsigned int pool_frame_size;
+    guint64      pool_hits;      // frames taken from the pool
+    guint64      pool_misses;    // frames allocated because the pool was exhausted
+
 #if HEVC_SUPPORT
     struct SwsContext *sws_context;
     AVFrame           *dest_frame;
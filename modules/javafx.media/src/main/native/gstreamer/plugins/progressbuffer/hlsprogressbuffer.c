@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -34,10 +34,22 @@ GST_DEBUG_CATEGORY (hls_progress_buffer_debug);
 
 #define ELEMENT_DESCRIPTION "JFX HLS Progress buffer element"
 
+/***********************************************************************************
+ * Properties
+ ***********************************************************************************/
+enum
+{
+    PROP_0,
+    PROP_NUM_SEGMENTS,
+    PROP_BANDWIDTH
+};
+
 /***********************************************************************************
  * Element structures are hidden from outside
  ***********************************************************************************/
-#define NUM_OF_CACHED_SEGMENTS 3
+#define MIN_CACHED_SEGMENTS     2
+#define MAX_CACHED_SEGMENTS     8
+#define DEFAULT_CACHED_SEGMENTS 3
 
 struct _HLSProgressBuffer
 {
@@ -50,12 +62,17 @@ struct _HLSProgressBuffer
     GCond         add_cond;
     GCond         del_cond;
 
-    Cache*        cache[NUM_OF_CACHED_SEGMENTS];
-    guint         cache_size[NUM_OF_CACHED_SEGMENTS];
-    gboolean      cache_write_ready[NUM_OF_CACHED_SEGMENTS];
-    gboolean      cache_discont[NUM_OF_CACHED_SEGMENTS];
+    Cache*        cache[MAX_CACHED_SEGMENTS];
+    guint         cache_size[MAX_CACHED_SEGMENTS];
+    gboolean      cache_write_ready[MAX_CACHED_SEGMENTS];
+    gboolean      cache_discont[MAX_CACHED_SEGMENTS];
     gint          cache_write_index;
     gint          cache_read_index;
+    gint          num_segments; // property controlled.
+
+    guint64       subtotal;  // bandwidth accumulator.
+    gdouble       bandwidth; // property accessible.
+    GTimer        *bandwidth_timer;
 
     gboolean      send_new_segment;
     gboolean      set_src_caps;
@@ -118,6 +135,8 @@ static GstStaticPadTemplate source_template = GST_STATIC_PAD_TEMPLATE ("src",
 /***********************************************************************************
  * Instance init and forward declarations
  ***********************************************************************************/
+static void                 hls_progress_buffer_set_property (GObject *object, guint property_id, const GValue *value, GParamSpec *pspec);
+static void                 hls_progress_buffer_get_property (GObject *object, guint property_id, GValue *value, GParamSpec *pspec);
 static void                 hls_progress_buffer_finalize (GObject *object);
 static GstStateChangeReturn hls_progress_buffer_change_state (GstElement *element, GstStateChange transition);
 static GstFlowReturn        hls_progress_buffer_chain(GstPad *pad, GstObject *parent, GstBuffer *data);
@@ -148,9 +167,29 @@ static void hls_progress_buffer_class_init (HLSProgressBufferClass *klass)
     gst_element_class_add_pad_template (element_class,
         gst_static_pad_template_get (&source_template));
 
+    gobject_class->set_property = hls_progress_buffer_set_property;
+    gobject_class->get_property = hls_progress_buffer_get_property;
     gobject_class->finalize = hls_progress_buffer_finalize;
     GST_ELEMENT_CLASS (klass)->change_state = hls_progress_buffer_change_state;
 
+    g_object_class_install_property (gobject_class, PROP_NUM_SEGMENTS,
+        g_param_spec_int ("num-segments",
+                          "Number of segments",
+                          "Number of segments cached ahead of playback. Can only be changed in NULL or READY state.",
+                          MIN_CACHED_SEGMENTS /* minimum value */,
+                          MAX_CACHED_SEGMENTS /* maximum value */,
+                          DEFAULT_CACHED_SEGMENTS /* default value */,
+                          G_PARAM_READWRITE | G_PARAM_CONSTRUCT));
+
+    g_object_class_install_property (gobject_class, PROP_BANDWIDTH,
+        g_param_spec_double ("bandwidth",
+                             "Network bandwidth",
+                             "Network bandwidth in bytes/second",
+                             0.0  /* minimum value */,
+                             G_MAXDOUBLE /* maximum value */,
+                             0.0  /* default value */,
+                             G_PARAM_READABLE));
+
     cache_static_init();
 }
 
@@ -175,7 +214,7 @@ static void hls_progress_buffer_init(HLSProgressBuffer *element)
     g_cond_init(&element->add_cond);
     g_cond_init(&element->del_cond);
 
-    for (int i = 0; i < NUM_OF_CACHED_SEGMENTS; i++)
+    for (int i = 0; i < MAX_CACHED_SEGMENTS; i++)
     {
         element->cache[i] = create_cache();
         element->cache_size[i] = 0;
@@ -185,6 +224,11 @@ static void hls_progress_buffer_init(HLSProgressBuffer *element)
 
     element->cache_write_index = -1;
     element->cache_read_index = 0;
+    element->num_segments = DEFAULT_CACHED_SEGMENTS;
+
+    element->subtotal = 0;
+    element->bandwidth = 0.0;
+    element->bandwidth_timer = g_timer_new();
 
     element->send_new_segment = TRUE;
     element->set_src_caps = TRUE;
@@ -197,6 +241,59 @@ static void hls_progress_buffer_init(HLSProgressBuffer *element)
     element->buffer_pts = GST_CLOCK_TIME_NONE;
 }
 
+/**
+ * hls_progress_buffer_set_property()
+ *
+ * Function to set properties on the element.
+ */
+static void hls_progress_buffer_set_property (GObject *object, guint property_id,
+                                              const GValue *value, GParamSpec *pspec)
+{
+    HLSProgressBuffer *element = HLS_PROGRESS_BUFFER(object);
+    switch (property_id)
+    {
+        case PROP_NUM_SEGMENTS:
+            g_mutex_lock(&element->lock);
+            // Ring size can not change while segments are in flight.
+            if (element->cache_write_index == -1)
+                element->num_segments = g_value_get_int(value);
+            else
+                g_warning("hlsprogressbuffer: num-segments can not change while segments are cached, keeping %d",
+                          element->num_segments);
+            g_mutex_unlock(&element->lock);
+            break;
+
+        default:
+            break;
+    }
+}
+
+/**
+ * hls_progress_buffer_get_property()
+ *
+ * Function to get properties from the element.
+ */
+static void hls_progress_buffer_get_property (GObject *object, guint property_id,
+                                              GValue *value, GParamSpec *pspec)
+{
+    HLSProgressBuffer *element = HLS_PROGRESS_BUFFER(object);
+    switch (property_id)
+    {
+        case PROP_NUM_SEGMENTS:
+            g_value_set_int(value, element->num_segments);
+            break;
+
+        case PROP_BANDWIDTH:
+            g_mutex_lock(&element->lock);
+            g_value_set_double(value, element->bandwidth);
+            g_mutex_unlock(&element->lock);
+            break;
+
+        default:
+            break;
+    }
+}
+
 /**
  * hls_progress_buffer_finalize()
  *
@@ -207,12 +304,14 @@ static void hls_progress_buffer_finalize (GObject *object)
     HLSProgressBuffer *element = HLS_PROGRESS_BUFFER(object);
     int i = 0;
 
-    for (i = 0; i < NUM_OF_CACHED_SEGMENTS; i++)
+    for (i = 0; i < MAX_CACHED_SEGMENTS; i++)
     {
         if (element->cache[i])
             destroy_cache(element->cache[i]);
     }
 
+    g_timer_destroy(element->bandwidth_timer);
+
     g_mutex_clear(&element->lock);
     g_cond_clear(&element->add_cond);
     g_cond_clear(&element->del_cond);
@@ -285,7 +384,7 @@ static void hls_progress_buffer_flush_data(HLSProgressBuffer *element)
 
     element->cache_write_index = -1;
     element->cache_read_index = 0;
-    for (i = 0; i < NUM_OF_CACHED_SEGMENTS; i++)
+    for (i = 0; i < MAX_CACHED_SEGMENTS; i++)
     {
         if (element->cache[i])
         {
@@ -299,6 +398,25 @@ static void hls_progress_buffer_flush_data(HLSProgressBuffer *element)
     g_mutex_unlock(&element->lock);
 }
 
+/**
+ * hls_progress_buffer_update_bandwidth()
+ *
+ * Accounts received bytes and recalculates bandwidth about once per second.
+ * Must be called in the locked context.
+ */
+static void hls_progress_buffer_update_bandwidth(HLSProgressBuffer *element, gsize size)
+{
+    gdouble elapsed = g_timer_elapsed(element->bandwidth_timer, NULL);
+    element->subtotal += size;
+
+    if (elapsed > 1.0)
+    {
+        element->bandwidth = element->subtotal/elapsed;
+        element->subtotal = 0;
+        g_timer_start(element->bandwidth_timer);
+    }
+}
+
 /***********************************************************************************
  * chain, loop, sink_event and src_event, buffer_alloc
  ***********************************************************************************/
@@ -329,6 +447,8 @@ static GstFlowReturn hls_progress_buffer_chain(GstPad *pad, GstObject *parent, G
 
         cache_write_buffer(element->cache[element->cache_write_index], data);
         g_cond_signal(&element->add_cond);
+
+        hls_progress_buffer_update_bandwidth(element, gst_buffer_get_size(data));
     }
     g_mutex_unlock(&element->lock);
 
@@ -430,7 +550,7 @@ static void hls_progress_buffer_loop(void *data)
         if (read_position == element->cache_size[element->cache_read_index])
         {
             element->cache_write_ready[element->cache_read_index] = TRUE;
-            element->cache_read_index = (element->cache_read_index + 1) % NUM_OF_CACHED_SEGMENTS;
+            element->cache_read_index = (element->cache_read_index + 1) % element->num_segments;
             send_hls_not_full_message(element);
             g_cond_signal(&element->del_cond);
         }
@@ -525,19 +645,26 @@ static gboolean hls_progress_buffer_sink_event(GstPad *pad, GstObject *parent, G
 
             // Get and prepare next write segment
             g_mutex_lock(&element->lock);
-            element->cache_write_index = (element->cache_write_index + 1) % NUM_OF_CACHED_SEGMENTS;
+            element->cache_write_index = (element->cache_write_index + 1) % element->num_segments;
 
-            while (element->srcresult == GST_FLOW_OK && !element->cache_write_ready[element->cache_write_index])
+            if (!element->cache_write_ready[element->cache_write_index])
             {
-                g_mutex_unlock(&element->lock);
-                send_hls_full_message(element);
-                g_mutex_lock(&element->lock);
-                g_cond_wait(&element->del_cond, &element->lock);
-                if (element->srcresult != GST_FLOW_OK)
+                while (element->srcresult == GST_FLOW_OK && !element->cache_write_ready[element->cache_write_index])
                 {
                     g_mutex_unlock(&element->lock);
-                    return TRUE;
+                    send_hls_full_message(element);
+                    g_mutex_lock(&element->lock);
+                    g_cond_wait(&element->del_cond, &element->lock);
+                    if (element->srcresult != GST_FLOW_OK)
+                    {
+                        g_mutex_unlock(&element->lock);
+                        return TRUE;
+                    }
                 }
+
+                // Time spent waiting for a free segment is not network time.
+                element->subtotal = 0;
+                g_timer_start(element->bandwidth_timer);
             }
             element->cache_size[element->cache_write_index] = segment.stop;
             element->cache_write_ready[element->cache_write_index] = FALSE;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2013, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -31,7 +31,11 @@
 class IBandsUpdater
 {
 public:
-    virtual void UpdateBands(int size, const float* magnitudes, const float* phases) = 0;
+    // Publishes one spectrum interval. size may be 0 (with NULL bands) when
+    // only the notification should be delivered. Returns false if the
+    // listener could not be notified.
+    virtual bool UpdateBands(int size, const float* magnitudes, const float* phases,
+                             double timestamp, double duration, bool queryTimestamp) = 0;
 };
 
 class CBandsHolder : public IBandsUpdater
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2014, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2014, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -70,8 +70,10 @@ public:
         mThreshold = threshold;
     }
 
-    virtual void UpdateBands(int size, const float* magnitudes, const float* phases) {
+    virtual bool UpdateBands(int size, const float* magnitudes, const float* phases,
+                             double timestamp, double duration, bool queryTimestamp) {
         // Do nothing...
+        return true;
     }
 
 private:
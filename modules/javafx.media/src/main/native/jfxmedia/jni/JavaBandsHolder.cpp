@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,8 +25,21 @@
 
 #include "JavaBandsHolder.h"
 #include "JniUtils.h"
+#include <Common/ProductFlags.h>
+#include <string.h>
+
+#if ENABLE_PLATFORM_GSTREAMER
+#include <platform/gstreamer/GstJniUtils.h>
+#endif // ENABLE_PLATFORM_GSTREAMER
 
 CJavaBandsHolder::CJavaBandsHolder()
+    : m_jvm(NULL),
+      m_Bands(0),
+      m_Spectrum(NULL),
+      m_Buffer(NULL),
+      m_pBands(NULL),
+      m_Current(0),
+      m_BandsUpdatedMethod(NULL)
 {
 }
 
@@ -37,20 +50,20 @@ CJavaBandsHolder::~CJavaBandsHolder()
         JNIEnv *pEnv = jenv.getEnvironment();
 
         if (pEnv) {
-            if (m_Magnitudes) {
-                pEnv->DeleteGlobalRef(m_Magnitudes);
-                m_Magnitudes = NULL;
+            if (m_Spectrum) {
+                pEnv->DeleteGlobalRef(m_Spectrum);
+                m_Spectrum = NULL;
             }
 
-            if (m_Phases) {
-                pEnv->DeleteGlobalRef(m_Phases);
-                m_Phases = NULL;
+            if (m_Buffer) {
+                pEnv->DeleteGlobalRef(m_Buffer);
+                m_Buffer = NULL;
             }
         }
     }
 }
 
-bool CJavaBandsHolder::Init(JNIEnv* env, int bands, jfloatArray magnitudes, jfloatArray phases)
+bool CJavaBandsHolder::Init(JNIEnv* env, jobject spectrum, int bands, jobject buffer)
 {
     env->GetJavaVM(&m_jvm);
     if (env->ExceptionCheck()) {
@@ -59,36 +72,66 @@ bool CJavaBandsHolder::Init(JNIEnv* env, int bands, jfloatArray magnitudes, jflo
         return false;
     }
 
+    m_pBands = (float*)env->GetDirectBufferAddress(buffer);
+    if (m_pBands == NULL || env->GetDirectBufferCapacity(buffer) < (jlong)(4 * bands * sizeof(float))) {
+        m_jvm = NULL;
+        return false;
+    }
+
+    jclass klass = env->GetObjectClass(spectrum);
+    m_BandsUpdatedMethod = env->GetMethodID(klass, "bandsUpdated", "(IDDZ)V");
+    env->DeleteLocalRef(klass);
+    if (env->ExceptionCheck() || m_BandsUpdatedMethod == NULL) {
+        env->ExceptionClear();
+        m_jvm = NULL;
+        return false;
+    }
+
     m_Bands = bands;
-    m_Magnitudes = (jfloatArray)env->NewGlobalRef(magnitudes);
-    m_Phases = (jfloatArray)env->NewGlobalRef(phases);
+    m_Spectrum = env->NewGlobalRef(spectrum);
+    m_Buffer = env->NewGlobalRef(buffer);
 
     InitRef(this);
 
     return true;
 }
 
-void CJavaBandsHolder::UpdateBands(int size, const float* magnitudes, const float* phases)
+bool CJavaBandsHolder::UpdateBands(int size, const float* magnitudes, const float* phases,
+                                   double timestamp, double duration, bool queryTimestamp)
 {
-    if (m_Bands != size || m_jvm == NULL)
-        return;
+    if (m_jvm == NULL)
+        return false;
 
+    // Fill the half Java is not reading, then hand it over with the event.
+    if (size == m_Bands && magnitudes != NULL && phases != NULL) {
+        int next = 1 - m_Current;
+        float *dst = m_pBands + next * 2 * m_Bands;
+        memcpy(dst, magnitudes, m_Bands * sizeof(float));
+        memcpy(dst + m_Bands, phases, m_Bands * sizeof(float));
+        m_Current = next;
+    }
+
+    bool bSucceeded = false;
+#if ENABLE_PLATFORM_GSTREAMER
+    // Stays attached for the life of the producing thread
+    JNIEnv *env = NULL;
+    if (!GstGetEnv(&env))
+        return false;
+    CJavaEnvironment jenv(env);
+#else // ENABLE_PLATFORM_GSTREAMER
     CJavaEnvironment jenv(m_jvm);
+#endif // ENABLE_PLATFORM_GSTREAMER
     JNIEnv *pEnv = jenv.getEnvironment();
     if (pEnv) {
-        // use local references due to threading issues
-        jfloatArray localMagnitudes = (jfloatArray)pEnv->NewLocalRef(m_Magnitudes);
-        jfloatArray localPhases = (jfloatArray)pEnv->NewLocalRef(m_Phases);
-
-        if (localMagnitudes && localPhases) {
-            pEnv->SetFloatArrayRegion(localMagnitudes, 0, size, magnitudes);
-            if (!jenv.clearException()) {
-                pEnv->SetFloatArrayRegion(localPhases, 0, size, phases);
-                jenv.clearException();
-            }
-        }
+        jobject localSpectrum = pEnv->NewLocalRef(m_Spectrum);
+        if (localSpectrum) {
+            pEnv->CallVoidMethod(localSpectrum, m_BandsUpdatedMethod, (jint)m_Current,
+                                 (jdouble)timestamp, (jdouble)duration, (jboolean)queryTimestamp);
+            pEnv->DeleteLocalRef(localSpectrum);
 
-        pEnv->DeleteLocalRef(localMagnitudes);
-        pEnv->DeleteLocalRef(localPhases);
+            bSucceeded = !jenv.reportException();
+        }
     }
+
+    return bSucceeded;
 }
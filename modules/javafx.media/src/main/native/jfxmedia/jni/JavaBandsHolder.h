@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2016, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -36,14 +36,18 @@ public:
     ~CJavaBandsHolder();
 
 public:
-    bool Init(JNIEnv* env, int bands, jfloatArray magnitudes, jfloatArray phases);
-    void UpdateBands(int size, const float* magnitudes, const float* phases);
+    bool Init(JNIEnv* env, jobject spectrum, int bands, jobject buffer);
+    bool UpdateBands(int size, const float* magnitudes, const float* phases,
+                     double timestamp, double duration, bool queryTimestamp);
 
 private:
     JavaVM      *m_jvm;
     int         m_Bands;
-    jfloatArray m_Magnitudes;
-    jfloatArray m_Phases;
+    jobject     m_Spectrum;     // NativeAudioSpectrum
+    jobject     m_Buffer;       // direct buffer backing m_pBands
+    float       *m_pBands;      // two halves of [magnitudes][phases]
+    int         m_Current;      // half last published to Java
+    jmethodID   m_BandsUpdatedMethod;
 };
 
 #endif // _JAVA_SPECTRUM_UPDATER_H_
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -47,7 +47,6 @@ jmethodID CJavaPlayerEventDispatcher::m_SendSubtitleTrackEventMethod = 0;
 jmethodID CJavaPlayerEventDispatcher::m_SendMarkerEventMethod = 0;
 jmethodID CJavaPlayerEventDispatcher::m_SendBufferProgressEventMethod = 0;
 jmethodID CJavaPlayerEventDispatcher::m_SendDurationUpdateEventMethod = 0;
-jmethodID CJavaPlayerEventDispatcher::m_SendAudioSpectrumEventMethod = 0;
 
 CJavaPlayerEventDispatcher::CJavaPlayerEventDispatcher()
 : m_PlayerVM(NULL),
@@ -153,12 +152,6 @@ void CJavaPlayerEventDispatcher::Init(JNIEnv *env, jobject PlayerInstance, CMedi
             hasException = (javaEnv.reportException() || (NULL == m_SendDurationUpdateEventMethod));
         }
 
-        if (!hasException)
-        {
-            m_SendAudioSpectrumEventMethod  = env->GetMethodID(klass, "sendAudioSpectrumEvent", "(DDZ)V");
-            hasException = (javaEnv.reportException() || (NULL == m_SendAudioSpectrumEventMethod));
-        }
-
         env->DeleteLocalRef(klass);
 
         areJMethodIDsInitialized = !hasException;
@@ -516,26 +509,6 @@ bool CJavaPlayerEventDispatcher::SendDurationUpdateEvent(double time)
     return bSucceeded;
 }
 
-bool CJavaPlayerEventDispatcher::SendAudioSpectrumEvent(double time, double duration,
-                                                        bool queryTimestamp)
-{
-    bool bSucceeded = false;
-    CJavaEnvironment jenv(m_PlayerVM);
-    JNIEnv *pEnv = jenv.getEnvironment();
-    if (pEnv) {
-        jobject localPlayer = pEnv->NewLocalRef(m_PlayerInstance);
-        if (localPlayer) {
-            pEnv->CallVoidMethod(localPlayer, m_SendAudioSpectrumEventMethod, time,
-                                              duration, queryTimestamp);
-            pEnv->DeleteLocalRef(localPlayer);
-
-            bSucceeded = !jenv.reportException();
-        }
-    }
-
-    return bSucceeded;
-}
-
 /******************************************************************************************
  * Creates any object with any arguments
  ******************************************************************************************/
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2020, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -59,7 +59,6 @@ public:
     virtual bool SendMarkerEvent(string name, double time);
     virtual bool SendBufferProgressEvent(double clipDuration, int64_t start, int64_t stop, int64_t position);
     virtual bool SendDurationUpdateEvent(double time);
-    virtual bool SendAudioSpectrumEvent(double time, double duration, bool queryTimestamp);
     virtual void Warning(int warningCode, const char* warningMessage);
 
 private:
@@ -80,7 +79,6 @@ private:
     static jmethodID m_SendMarkerEventMethod;
     static jmethodID m_SendBufferProgressEventMethod;
     static jmethodID m_SendDurationUpdateEventMethod;
-    static jmethodID m_SendAudioSpectrumEventMethod;
 
     static jobject CreateObject(JNIEnv *env, jmethodID *cid,
                                 const char* class_name, const char* signature,
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -32,6 +32,8 @@
 #include "GstAudioPlaybackPipeline.h"
 #include "GstPipelineFactory.h"
 
+class CGstFramePools;
+
 
 /**
  * class CGstAVPlaybackPipeline
@@ -83,6 +85,7 @@ private:
     gfloat                  m_EncodedVideoFrameRate;
     int                     m_videoCodecErrorCode;
     GstClockTime            m_FirstPTS;
+    CGstFramePools*         m_pFramePools;  // pools for the frames converted for this player
 };
 
 #endif  //_GST_AV_PLAYBACK_PIPELINE_H_
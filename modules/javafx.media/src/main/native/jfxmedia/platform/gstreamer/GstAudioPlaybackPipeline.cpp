@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -1500,7 +1500,11 @@ gboolean CGstAudioPlaybackPipeline::BusCallback(GstBus* bus, GstMessage* msg, sB
                 pPipeline->HLSBufferResume(false);
             }
             else if (gst_structure_has_name(pStr, HLS_PB_MESSAGE_NOT_FULL))
+            {
                 pPipeline->m_bHLSPBFull = false;
+                // A segment was consumed, a good time to follow the download rate.
+                pPipeline->UpdateHLSQueueLimits(GST_ELEMENT(GST_MESSAGE_SRC(msg)));
+            }
         }
             break;
 #endif  //ENABLE_PROGRESS_BUFFER
@@ -1519,29 +1523,33 @@ gboolean CGstAudioPlaybackPipeline::BusCallback(GstBus* bus, GstMessage* msg, sB
                     duration = GST_CLOCK_TIME_NONE;
 
                 size_t bandsNum = pPipeline->GetAudioSpectrum()->GetBands();
+                const float *magnitudes = NULL;
+                const float *phases = NULL;
 
                 if (bandsNum > 0)
                 {
-                    float *magnitudes = new float[bandsNum];
-                    float *phases = new float[bandsNum];
-
+                    // Bands are delivered as blocks of floats owned by the message.
                     const GValue *magnitudes_value = gst_structure_get_value(pStr, "magnitude");
                     const GValue *phases_value = gst_structure_get_value(pStr, "phase");
-                    for (int i=0; i < bandsNum; i++)
+                    if (magnitudes_value && G_VALUE_HOLDS(magnitudes_value, G_TYPE_BYTES) &&
+                        phases_value && G_VALUE_HOLDS(phases_value, G_TYPE_BYTES))
                     {
-                        magnitudes[i] = g_value_get_float( gst_value_list_get_value (magnitudes_value, i));
-                        phases[i] = g_value_get_float( gst_value_list_get_value (phases_value, i));
-                    }
-                    pPipeline->GetAudioSpectrum()->UpdateBands((int)bandsNum, magnitudes, phases);
+                        gsize magnitudes_size = 0, phases_size = 0;
+                        magnitudes = (const float*)g_bytes_get_data((GBytes*)g_value_get_boxed(magnitudes_value), &magnitudes_size);
+                        phases = (const float*)g_bytes_get_data((GBytes*)g_value_get_boxed(phases_value), &phases_size);
 
-                    delete [] magnitudes;
-                    delete [] phases;
+                        // Band count may have changed since the message was posted.
+                        if (magnitudes_size != bandsNum * sizeof(float) || phases_size != bandsNum * sizeof(float))
+                            magnitudes = phases = NULL;
+                    }
                 }
 
-                if (!pPipeline->m_pEventDispatcher->SendAudioSpectrumEvent(GST_TIME_AS_SECONDS((double)timestamp),
-                    GST_TIME_AS_SECONDS((double)duration), false)) // Always false, since GStreamer does not need it,
-                                                                   // but if it will be required such case needs to be
-                                                                   // tested.
+                // Copies the bands into the Java buffer and notifies Java in one call.
+                // queryTimestamp is always false, since GStreamer does not need it,
+                // but if it will be required such case needs to be tested.
+                if (!pPipeline->GetAudioSpectrum()->UpdateBands(magnitudes ? (int)bandsNum : 0, magnitudes, phases,
+                                                                GST_TIME_AS_SECONDS((double)timestamp),
+                                                                GST_TIME_AS_SECONDS((double)duration), false))
                 {
                     if(!pPipeline->m_pEventDispatcher->SendPlayerMediaErrorEvent(ERROR_JNI_SEND_AUDIO_SPECTRUM_EVENT))
                     {
@@ -2146,4 +2154,56 @@ void CGstAudioPlaybackPipeline::HLSBufferResume(bool bEOS)
         Play();
     }
 }
+
+/**
+ * CGstAudioPlaybackPipeline::UpdateHLSQueueLimits()
+ *
+ * Sizes the audio and video queues by the download rate measured by the HLS
+ * progress buffer and the bitrate of the data in the queues. The closer the
+ * stream bitrate comes to the download rate, the longer it takes to refill
+ * the queues after a segment boundary, so they are allowed to hold more.
+ * Streams without timestamps are left to the byte limit.
+ */
+void CGstAudioPlaybackPipeline::UpdateHLSQueueLimits(GstElement *pProgressBuffer)
+{
+    GstElement* queues[] = { m_Elements[AUDIO_QUEUE], m_Elements[VIDEO_QUEUE] };
+    gdouble bandwidth = 0.0;
+    guint64 total_bytes = 0;
+    guint64 level_time = 0;
+    guint64 size_time;
+
+    g_object_get(pProgressBuffer, "bandwidth", &bandwidth, NULL);
+    if (bandwidth <= 0.0)
+        return;
+
+    for (size_t i = 0; i < sizeof(queues) / sizeof(queues[0]); i++)
+    {
+        guint bytes = 0;
+        guint64 time = 0;
+
+        if (NULL == queues[i])
+            continue;
+
+        g_object_get(queues[i], "current-level-bytes", &bytes, "current-level-time", &time, NULL);
+        total_bytes += bytes;
+        level_time = MAX(level_time, time);
+    }
+
+    if (total_bytes == 0 || level_time == 0)
+        return;
+
+    // Fraction of the download rate taken by the stream
+    gdouble load = (gdouble)total_bytes * GST_SECOND / level_time / bandwidth;
+    if (load >= 1.0)
+        size_time = HLS_QUEUE_MAX_SIZE_TIME;
+    else
+        size_time = CLAMP((guint64)(HLS_QUEUE_MIN_SIZE_TIME / (1.0 - load)),
+                          HLS_QUEUE_MIN_SIZE_TIME, HLS_QUEUE_MAX_SIZE_TIME);
+
+    for (size_t i = 0; i < sizeof(queues) / sizeof(queues[0]); i++)
+    {
+        if (NULL != queues[i])
+            g_object_set(queues[i], "max-size-time", size_time, NULL);
+    }
+}
 #endif // ENABLE_PROGRESS_BUFFER
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -57,6 +57,14 @@ const int AUDIO_DECODER_HAS_SOURCE_PROBE = 1 << 1;
 #define HLS_PB_MESSAGE_FULL         "hls_pb_full"
 #define HLS_PB_MESSAGE_NOT_FULL     "hls_pb_not_full"
 
+// Limits of the audio and video queues in HLS mode. The time limit starts at
+// HLS_QUEUE_INITIAL_SIZE_TIME and follows the measured download rate, see
+// UpdateHLSQueueLimits(). The byte limit bounds queues of untimestamped data.
+#define HLS_QUEUE_INITIAL_SIZE_TIME (3 * GST_SECOND)
+#define HLS_QUEUE_MIN_SIZE_TIME     (2 * GST_SECOND)
+#define HLS_QUEUE_MAX_SIZE_TIME     (10 * GST_SECOND)
+#define HLS_QUEUE_MAX_SIZE_BYTES    (16 * 1024 * 1024)
+
 class CGstAudioPlaybackPipeline;
 struct sBusCallbackContent
 {
@@ -161,6 +169,7 @@ private:
     void                UpdateBufferPosition();
     void                HLSBufferStall();
     void                HLSBufferResume(bool bEOS);
+    void                UpdateHLSQueueLimits(GstElement *pProgressBuffer);
 #endif // ENABLE_PROGRESS_BUFFER
 
     int                 m_AudioFlags;
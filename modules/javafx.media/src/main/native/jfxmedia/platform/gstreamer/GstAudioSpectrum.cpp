@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -99,11 +99,15 @@ void CGstAudioSpectrum::SetBands(int bands, CBandsHolder* holder)
     CBandsHolder::ReleaseRef(old_holder);
 }
 
-void CGstAudioSpectrum::UpdateBands(int size, const float* magnitudes, const float* phases)
+bool CGstAudioSpectrum::UpdateBands(int size, const float* magnitudes, const float* phases,
+                                    double timestamp, double duration, bool queryTimestamp)
 {
+    bool result = true;
     CBandsHolder *holder = CBandsHolder::AddRef((CBandsHolder*)g_atomic_pointer_get(&m_pHolder));
-    holder->UpdateBands(size, magnitudes, phases);
+    if (holder != NULL)
+        result = holder->UpdateBands(size, magnitudes, phases, timestamp, duration, queryTimestamp);
     CBandsHolder::ReleaseRef(holder);
+    return result;
 }
 
 double CGstAudioSpectrum::GetInterval()
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -48,6 +48,24 @@
 #define HLS_VALUE_MIMETYPE_FMP4 3
 #define HLS_VALUE_MIMETYPE_AAC  4
 
+// Segments cached ahead of playback by hlsprogressbuffer.
+#define HLS_PREFETCH_SEGMENTS   4
+
+// Segment boundaries in HLS arrive in bursts, so a fixed count of buffers drains
+// too quickly on high latency links. Limit the queues by duration instead, with
+// a byte limit for data without timestamps. The pipeline adjusts the duration
+// to the measured download rate once playback starts.
+static void SetHLSQueueLimits(GstElementContainer* pElements)
+{
+    GstElement* queues[] = { (*pElements)[AUDIO_QUEUE], (*pElements)[VIDEO_QUEUE] };
+
+    for (size_t i = 0; i < sizeof(queues) / sizeof(queues[0]); i++)
+    {
+        if (NULL != queues[i])
+            g_object_set(queues[i], "max-size-bytes", (guint)HLS_QUEUE_MAX_SIZE_BYTES, "max-size-buffers", (guint)0,
+                         "max-size-time", (guint64)HLS_QUEUE_INITIAL_SIZE_TIME, NULL);
+    }
+}
 
 //*************************************************************************************************
 //********** class CGstPipelineFactory
@@ -288,6 +306,9 @@ uint32_t CGstPipelineFactory::CreateSourceElement(CLocator *locator, CStreamCall
         if (NULL == buffer)
             return ERROR_GSTREAMER_ELEMENT_CREATE;
 
+        if (pOptions->GetHLSModeEnabled())
+            g_object_set(buffer, "num-segments", (gint)HLS_PREFETCH_SEGMENTS, NULL);
+
         gst_bin_add_many(GST_BIN(source), javaSource, buffer, NULL);
 
         if (!gst_element_link(javaSource, buffer))
@@ -699,6 +720,9 @@ uint32_t CGstPipelineFactory::CreateAudioPipeline(bool bConvertFormat, CPipeline
     if (ERROR_NONE != uRetCode)
         return uRetCode;
 
+    if (pOptions->GetHLSModeEnabled())
+        SetHLSQueueLimits(pElements);
+
     pElements->add(PIPELINE, pipeline);
 
     *ppPipeline = new CGstAudioPlaybackPipeline(*pElements, flags, pOptions);
@@ -811,6 +835,9 @@ uint32_t CGstPipelineFactory::CreateAVPipeline(bool bConvertFormat, GstElement*
     if (ERROR_NONE != uRetCode)
         return uRetCode;
 
+    if (pOptions->GetHLSModeEnabled())
+        SetHLSQueueLimits(pElements);
+
     pElements->add(PIPELINE, pipeline);
     pElements->add(AV_DEMUXER, demuxer);
     if (audioDemuxer != NULL)
@@ -889,6 +916,9 @@ uint32_t CGstPipelineFactory::CreateAudioBin(const char* strParserName, const ch
         tail = audioconv;
     }
 
+    // Post-processing elements run in passthrough mode while idle: the
+    // equalizer with no bands or zero gains, the spectrum when it does not
+    // post messages, centered balance on stereo input and unity volume.
     GstElement *audioequalizer = CreateElement ("equalizer-nbands");
     GstElement *audiospectrum = CreateElement ("spectrum");
     if (NULL == audioequalizer || NULL == audiospectrum)
@@ -73,6 +73,137 @@ static GstBuffer *alloc_aligned_buffer(guint size)
     return gst_buffer_new_wrapped_full((GstMemoryFlags)0, alignedData, alignedSize, 0, alignedSize, newData, free_aligned_buffer);
 }
 
+// Converted frames are leased from a few buffer pools keyed by frame size and
+// go back to their pool when the Java peer disposes the frame. Each pool keeps
+// at most FRAME_POOL_MAX_BUFFERS frames; frames requested while all of them
+// are in use are allocated separately and freed on dispose.
+#define FRAME_POOL_MAX_BUFFERS  4
+
+CGstFramePools::CGstFramePools()
+{
+    m_RefCount = 1;
+    m_Clock = 0;
+    m_Hits = 0;
+    m_Misses = 0;
+    memset(m_Pools, 0, sizeof(m_Pools));
+    g_mutex_init(&m_Lock);
+}
+
+CGstFramePools::~CGstFramePools()
+{
+    gchar *msg = g_strdup_printf("Releasing converted frame pools: %" G_GUINT64_FORMAT
+                                 " frames leased, %" G_GUINT64_FORMAT " allocated", m_Hits, m_Misses);
+    LOGGER_LOGMSG(LOGGER_DEBUG, msg);
+    g_free(msg);
+
+    for (int i = 0; i < FRAME_POOL_COUNT; i++) {
+        ReleasePool(&m_Pools[i]);
+    }
+    g_mutex_clear(&m_Lock);
+}
+
+void CGstFramePools::Ref()
+{
+    g_atomic_int_inc(&m_RefCount);
+}
+
+void CGstFramePools::Unref()
+{
+    if (g_atomic_int_dec_and_test(&m_RefCount)) {
+        delete this;
+    }
+}
+
+// Must be called with m_Lock held.
+void CGstFramePools::ReleasePool(FramePool *entry)
+{
+    if (entry->pool != NULL) {
+        // Frames still held by Java are freed when they are disposed
+        gst_buffer_pool_set_active(entry->pool, FALSE);
+        gst_object_unref(entry->pool);
+    }
+    memset(entry, 0, sizeof(FramePool));
+}
+
+// Must be called with m_Lock held.
+CGstFramePools::FramePool *CGstFramePools::GetPool(guint size)
+{
+    FramePool *entry = &m_Pools[0];
+    GstStructure *config;
+    GstAllocationParams params;
+
+    for (int i = 0; i < FRAME_POOL_COUNT; i++) {
+        if (m_Pools[i].pool != NULL && m_Pools[i].size == size) {
+            return &m_Pools[i];
+        }
+        if (m_Pools[i].lastUsed < entry->lastUsed) {
+            entry = &m_Pools[i]; // least recently used, or unused
+        }
+    }
+
+    ReleasePool(entry);
+
+    entry->pool = gst_buffer_pool_new();
+    if (entry->pool == NULL) {
+        return NULL;
+    }
+
+    gst_allocation_params_init(&params);
+    params.align = 15; // 16 byte alignment, same as alloc_aligned_buffer()
+
+    config = gst_buffer_pool_get_config(entry->pool);
+    gst_buffer_pool_config_set_params(config, NULL, size, 0, FRAME_POOL_MAX_BUFFERS);
+    gst_buffer_pool_config_set_allocator(config, NULL, &params);
+    if (!gst_buffer_pool_set_config(entry->pool, config) ||
+        !gst_buffer_pool_set_active(entry->pool, TRUE)) {
+        gst_object_unref(entry->pool);
+        entry->pool = NULL;
+        return NULL;
+    }
+
+    entry->size = size;
+    return entry;
+}
+
+GstBuffer *CGstFramePools::AllocBuffer(guint size)
+{
+    GstBuffer *buffer = NULL;
+    GstBufferPool *pool = NULL;
+    GstBufferPoolAcquireParams params;
+    FramePool *entry;
+
+    g_mutex_lock(&m_Lock);
+    entry = GetPool(size);
+    if (entry != NULL) {
+        entry->lastUsed = ++m_Clock;
+        pool = (GstBufferPool*)gst_object_ref(entry->pool);
+    }
+    g_mutex_unlock(&m_Lock);
+
+    if (pool != NULL) {
+        memset(&params, 0, sizeof(params));
+        params.flags = GST_BUFFER_POOL_ACQUIRE_FLAG_DONTWAIT;
+        if (gst_buffer_pool_acquire_buffer(pool, &buffer, &params) != GST_FLOW_OK) {
+            buffer = NULL;
+        }
+        gst_object_unref(pool);
+    }
+
+    g_mutex_lock(&m_Lock);
+    if (buffer != NULL) {
+        m_Hits++;
+    } else {
+        m_Misses++;
+    }
+    g_mutex_unlock(&m_Lock);
+
+    if (buffer == NULL) {
+        buffer = alloc_aligned_buffer(size);
+    }
+
+    return buffer;
+}
+
 GstCaps *create_RGB_caps(CVideoFrame::FrameType type, guint width, guint height, guint encodedWidth, guint encodedHeight, guint stride)
 {
     gint red_mask, green_mask, blue_mask, alpha_mask;
@@ -114,6 +245,7 @@ CGstVideoFrame::CGstVideoFrame()
     m_pSample = NULL;
     m_pBuffer = NULL;
     m_bIsI420 = false;
+    m_pFramePools = NULL;
 }
 
 CGstVideoFrame::~CGstVideoFrame()
@@ -122,12 +254,20 @@ CGstVideoFrame::~CGstVideoFrame()
 
     if (NULL != m_pBuffer)
         Dispose();
+
+    if (NULL != m_pFramePools)
+        m_pFramePools->Unref();
 }
 
-bool CGstVideoFrame::Init(GstSample* sample)
+bool CGstVideoFrame::Init(GstSample* sample, CGstFramePools* pFramePools)
 {
     LOWLEVELPERF_COUNTERINC("CGstVideoFrame", 1, 1);
 
+    if (pFramePools != NULL) {
+        pFramePools->Ref();
+        m_pFramePools = pFramePools;
+    }
+
     // Increment the ref count as this object will be created
     // by the video sink and pushed into the FrameQueue.
     m_pSample = gst_sample_ref(sample);
@@ -341,6 +481,14 @@ void CGstVideoFrame::Dispose()
     }
 }
 
+GstBuffer *CGstVideoFrame::AllocBuffer(guint size)
+{
+    if (m_pFramePools != NULL) {
+        return m_pFramePools->AllocBuffer(size);
+    }
+    return alloc_aligned_buffer(size);
+}
+
 CVideoFrame *CGstVideoFrame::ConvertToFormat(FrameType type)
 {
     CGstVideoFrame *newFrame = NULL;
@@ -414,7 +562,7 @@ CGstVideoFrame *CGstVideoFrame::ConvertFromYCbCr420p(FrameType destType)
         return NULL;
     }
 
-    destBuffer = alloc_aligned_buffer(alloc_size);
+    destBuffer = AllocBuffer(alloc_size);
     if (!destBuffer) {
         return NULL;
     }
@@ -496,7 +644,7 @@ CGstVideoFrame *CGstVideoFrame::ConvertFromYCbCr420p(FrameType destType)
 
     if (0 == status && destSample) {
         CGstVideoFrame *newFrame = new CGstVideoFrame();
-        bool result = newFrame->Init(destSample) && newFrame->IsValid();
+        bool result = newFrame->Init(destSample, m_pFramePools) && newFrame->IsValid();
         // INLINE - gst_sample_unref()
         gst_buffer_unref(destBuffer); // else we'll have a massive memory leak!
         // INLINE - gst_sample_unref()
@@ -545,7 +693,7 @@ CGstVideoFrame *CGstVideoFrame::ConvertFromYCbCr422(FrameType destType)
         return NULL;
     }
 
-    destBuffer = alloc_aligned_buffer(alloc_size);
+    destBuffer = AllocBuffer(alloc_size);
     if (!destBuffer) {
         return NULL;
     }
@@ -599,7 +747,7 @@ CGstVideoFrame *CGstVideoFrame::ConvertFromYCbCr422(FrameType destType)
 
     if (0 == status && destBuffer) {
         CGstVideoFrame *newFrame = new CGstVideoFrame();
-        bool result = newFrame->Init(destSample) && newFrame->IsValid();
+        bool result = newFrame->Init(destSample, m_pFramePools) && newFrame->IsValid();
         // INLINE - gst_buffer_unref()
         gst_buffer_unref(destBuffer); // else we'll have a massive memory leak!
         // INLINE - gst_sample_unref()
@@ -626,7 +774,7 @@ CGstVideoFrame *CGstVideoFrame::ConvertSwapRGB(FrameType destType)
 
     size = gst_buffer_get_size(m_pBuffer);
 
-    destBuffer = alloc_aligned_buffer(size);
+    destBuffer = AllocBuffer(size);
     if (!destBuffer) {
         return NULL;
     }
@@ -713,7 +861,7 @@ CGstVideoFrame *CGstVideoFrame::ConvertSwapRGB(FrameType destType)
 
     if (destBuffer) {
         CGstVideoFrame *newFrame = new CGstVideoFrame();
-        bool result = newFrame->Init(destSample) && newFrame->IsValid();
+        bool result = newFrame->Init(destSample, m_pFramePools) && newFrame->IsValid();
         // INLINE - gst_buffer_unref()
         gst_buffer_unref(destBuffer); // else we'll have a massive memory leak!
         // INLINE - gst_sample_unref()
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2015, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -32,6 +32,49 @@
 #define FOURCC_I420 "I420"
 #define FOURCC_UYVY "UYVY"
 
+/**
+ * class CGstFramePools
+ *
+ * Buffer pools for the frames converted by one player, keyed by frame size.
+ * The pools are reference counted, since converted frames held by Java can
+ * outlive the player.
+ */
+class CGstFramePools
+{
+public:
+    CGstFramePools();
+
+    void Ref();
+    void Unref();
+
+    /*
+     * Returns a 16 byte aligned buffer of the given size, leased from the pool
+     * for that size if one of its buffers is free.
+     */
+    GstBuffer *AllocBuffer(guint size);
+
+private:
+    ~CGstFramePools();
+
+    enum { FRAME_POOL_COUNT = 4 };
+
+    typedef struct {
+        GstBufferPool *pool;
+        guint         size;
+        guint64       lastUsed;
+    } FramePool;
+
+    void        ReleasePool(FramePool *entry);
+    FramePool  *GetPool(guint size);
+
+    gint        m_RefCount;
+    GMutex      m_Lock;
+    FramePool   m_Pools[FRAME_POOL_COUNT];
+    guint64     m_Clock;
+    guint64     m_Hits;     // frames leased from a pool
+    guint64     m_Misses;   // frames allocated because the pool was exhausted
+};
+
 /**
  * class CGstVideoFrame
  *
@@ -46,9 +89,10 @@ public:
 
     /*
      * Initialize a VideoFrame that wraps the given GstBuffer. The frame caps are
-     * extracted from the buffer itself.
+     * extracted from the buffer itself. Frames converted from this one take
+     * their buffers from the given pools, if any.
      */
-    bool Init(GstSample* sample);
+    bool Init(GstSample* sample, CGstFramePools* pFramePools = NULL);
 
     virtual void Dispose();
 
@@ -69,7 +113,9 @@ private:
     void*       m_pvBufferBaseAddress;
     unsigned long m_ulBufferSize;
     bool        m_bIsI420;
+    CGstFramePools* m_pFramePools;
 
+    GstBuffer      *AllocBuffer(guint size);
     CGstVideoFrame *ConvertSwapRGB(FrameType destType);
     CGstVideoFrame *ConvertFromYCbCr420p(FrameType destType);
     CGstVideoFrame *ConvertFromYCbCr422(FrameType destType);
@@ -28,9 +28,7 @@
 #include <iostream>
 #include <Accelerate/Accelerate.h>
 
-AVFAudioSpectrumUnit::AVFAudioSpectrumUnit() : mSpectrumCallbackProc(NULL),
-                                               mSpectrumCallbackContext(NULL),
-                                               mEnabled(true),
+AVFAudioSpectrumUnit::AVFAudioSpectrumUnit() : mEnabled(true),
                                                mBandCount(128),
                                                mBands(NULL),
                                                mUpdateInterval(kDefaultAudioSpectrumUpdateInterval),
@@ -179,27 +177,20 @@ void AVFAudioSpectrumUnit::SetThreshold(int threshold) {
     }
 }
 
-void AVFAudioSpectrumUnit::UpdateBands(int size, const float* magnitudes, const float* phases) {
+bool AVFAudioSpectrumUnit::UpdateBands(int size, const float* magnitudes, const float* phases,
+                                       double timestamp, double duration, bool queryTimestamp) {
     // lock now otherwise the bands could change while we're processing
     lockBands();
     if (!mBands || size <= 0 || !mEnabled) {
         unlockBands();
-        return;
+        return true;
     }
 
-    // Update band data
-    mBands->UpdateBands(size, magnitudes, magnitudes);
-
-    // Call our listener to dispatch the spectrum event
-    if (mSpectrumCallbackProc) {
-        double duration = (double) mSamplesPerInterval / (double) 44100;
-        // We do not provide timestamp here. It will be queried from EventQueueThread
-        // due to reading current time from AVPlayer might hang when called
-        // from audio processing thread. This function is called from this thread.
-        mSpectrumCallbackProc(mSpectrumCallbackContext, duration, -1.0);
-    }
+    // Update band data and dispatch the spectrum event
+    bool result = mBands->UpdateBands(size, magnitudes, phases, timestamp, duration, queryTimestamp);
 
     unlockBands();
+    return result;
 }
 
 void AVFAudioSpectrumUnit::SetSampleRate(UInt32 rate) {
@@ -214,11 +205,6 @@ void AVFAudioSpectrumUnit::SetMaxFrames(UInt32 maxFrames) {
     mMaxFrames = maxFrames;
 }
 
-void AVFAudioSpectrumUnit::SetSpectrumCallbackProc(AVFSpectrumUnitCallbackProc proc, void *context) {
-    mSpectrumCallbackProc = proc;
-    mSpectrumCallbackContext = context;
-}
-
 static gboolean PostMessageCallback(GstElement * element, GstMessage * message) {
     if (message == NULL) {
         return FALSE;
@@ -244,19 +230,24 @@ static gboolean PostMessageCallback(GstElement * element, GstMessage * message)
         size_t bandsNum = pSpectrumUnit->GetBands();
 
         if (bandsNum > 0) {
-            float *magnitudes = new float[bandsNum];
-            float *phases = new float[bandsNum];
-
+            // Bands are delivered as blocks of floats owned by the message.
             const GValue *magnitudes_value = gst_structure_get_value(pStr, "magnitude");
             const GValue *phases_value = gst_structure_get_value(pStr, "phase");
-            for (int i = 0; i < bandsNum; i++) {
-                magnitudes[i] = g_value_get_float(gst_value_list_get_value(magnitudes_value, i));
-                phases[i] = g_value_get_float(gst_value_list_get_value(phases_value, i));
+            if (magnitudes_value && G_VALUE_HOLDS(magnitudes_value, G_TYPE_BYTES) &&
+                phases_value && G_VALUE_HOLDS(phases_value, G_TYPE_BYTES)) {
+                gsize magnitudes_size = 0, phases_size = 0;
+                const float *magnitudes = (const float*)g_bytes_get_data((GBytes*)g_value_get_boxed(magnitudes_value), &magnitudes_size);
+                const float *phases = (const float*)g_bytes_get_data((GBytes*)g_value_get_boxed(phases_value), &phases_size);
+
+                if (magnitudes_size == bandsNum * sizeof(float) && phases_size == bandsNum * sizeof(float)) {
+                    // We do not provide timestamp here. It will be queried from EventQueueThread
+                    // due to reading current time from AVPlayer might hang when called
+                    // from audio processing thread. This function is called from this thread.
+                    // Always true for queryTimestamp to avoid hang. See JDK-8240694.
+                    pSpectrumUnit->UpdateBands((int) bandsNum, magnitudes, phases,
+                                               -1.0, pSpectrumUnit->GetIntervalDuration(), true);
+                }
             }
-            pSpectrumUnit->UpdateBands((int) bandsNum, magnitudes, phases);
-
-            delete [] magnitudes;
-            delete [] phases;
         }
     }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2014, 2020, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2014, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -41,17 +41,6 @@
 #define kDefaultAudioSpectrumUpdateInterval 0.1 // every 1/10 second
 #define kDefaultAudioSpectrumThreshold -60.0    // -60 dB
 
-/*
- * Callback proc invoked by the audio spectrum unit. This call is made periodically
- * depending on the requested update interval. The band data is updated out-of-line.
- *
- * callbackContext: user specified context pointer
- * timeStamp: the beginning time in seconds of the sample period (from beginning of stream)
- * duration: the length of time in seconds of the sample period
- */
-typedef void (*AVFSpectrumUnitCallbackProc)(void *callbackContext, double duration,
-                                            double timestamp);
-
 class AVFAudioSpectrumUnit : public CAudioSpectrum {
 public:
     AVFAudioSpectrumUnit();
@@ -75,16 +64,19 @@ public:
     virtual int GetThreshold();
     virtual void SetThreshold(int threshold);
 
-    virtual void UpdateBands(int size, const float* magnitudes, const float* phases);
+    virtual bool UpdateBands(int size, const float* magnitudes, const float* phases,
+                             double timestamp, double duration, bool queryTimestamp);
+
+    // Length in seconds of one spectrum interval
+    double GetIntervalDuration() {
+        return (double) mSamplesPerInterval / (double) 44100;
+    }
 
     void SetSampleRate(UInt32 rate);
     void SetChannels(UInt32 count);
     void SetMaxFrames(UInt32 maxFrames);
-    void SetSpectrumCallbackProc(AVFSpectrumUnitCallbackProc proc, void *context);
 
 private:
-    AVFSpectrumUnitCallbackProc mSpectrumCallbackProc;
-    void *mSpectrumCallbackContext;
     bool mEnabled;
 
     pthread_mutex_t mBandLock;      // prevent bands from disappearing while we're processing
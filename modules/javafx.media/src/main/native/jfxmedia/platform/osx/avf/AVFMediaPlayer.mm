@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2014, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2014, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -107,8 +107,6 @@ static void append_log(NSMutableString *s, NSString *fmt, ...) {
 
 @implementation AVFMediaPlayer
 
-static void SpectrumCallbackProc(void *context, double duration, double timestamp);
-
 static CVReturn displayLinkCallback(CVDisplayLinkRef displayLink,
                                     const CVTimeStamp *inNow,
                                     const CVTimeStamp *inOutputTime,
@@ -212,9 +210,6 @@ static CVReturn displayLinkCallback(CVDisplayLinkRef displayLink,
         _displayLink = NULL;
 
         _audioProcessor = [[AVFAudioProcessor alloc] init];
-        if (_audioProcessor.audioSpectrum != nullptr) {
-            _audioProcessor.audioSpectrum->SetSpectrumCallbackProc(SpectrumCallbackProc, (__bridge void*)self);
-        }
 
         isDisposed = NO;
     }
@@ -486,7 +481,6 @@ static CVReturn displayLinkCallback(CVDisplayLinkRef displayLink,
             if (asPtr != nullptr) {
                 // Prevent future spectrum callbacks
                 asPtr->SetEnabled(FALSE);
-                asPtr->SetSpectrumCallbackProc(NULL, NULL);
                 asPtr->SetBands(0, NULL);
             }
 
@@ -736,13 +730,6 @@ static CVReturn displayLinkCallback(CVDisplayLinkRef displayLink,
     eventHandler->SendNewFrameEvent(frame);
 }
 
-- (void) sendSpectrumEventDuration:(double)duration timestamp:(double)timestamp {
-    if (eventHandler) {
-        // Always true for queryTimestamp to avoid hang. See JDK-8240694.
-        eventHandler->SendAudioSpectrumEvent(timestamp, duration, true);
-    }
-}
-
 - (NSString*) getContentTypeFromURL:(NSString*) URL {
     if (URL == nil) {
         return nil;
@@ -855,13 +842,6 @@ static CVReturn displayLinkCallback(CVDisplayLinkRef displayLink,
 
 @end
 
-static void SpectrumCallbackProc(void *context, double duration, double timestamp) {
-    if (context) {
-        AVFMediaPlayer *player = (__bridge AVFMediaPlayer*)context;
-        [player sendSpectrumEventDuration:duration timestamp:timestamp];
-    }
-}
-
 static CVReturn displayLinkCallback(CVDisplayLinkRef displayLink, const CVTimeStamp *inNow, const CVTimeStamp *inOutputTime, CVOptionFlags flagsIn, CVOptionFlags *flagsOut, void *displayLinkContext)
 {
     AVFMediaPlayer *self = (__bridge AVFMediaPlayer *)displayLinkContext;
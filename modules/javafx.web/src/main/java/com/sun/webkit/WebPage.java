@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -39,6 +39,8 @@ import com.sun.webkit.event.WCMouseEvent;
 import com.sun.webkit.event.WCMouseWheelEvent;
 import com.sun.webkit.graphics.*;
 import com.sun.webkit.network.CookieManager;
+import com.sun.webkit.perf.JNIAccounting;
+import com.sun.webkit.perf.NativeTrace;
 import static com.sun.webkit.network.URLs.newURL;
 import java.net.CookieHandler;
 import java.net.MalformedURLException;
@@ -151,6 +153,8 @@ public final class WebPage {
 
         // Initialize WTF, WebCore and JavaScriptCore.
         twkInitWebCore(useJIT, useDFGJIT, useCSS3D);
+        NativeTrace.initialize();
+        JNIAccounting.initialize();
 
         // Inform the native webkit code when either the JVM or the
         // JavaFX runtime is being shutdown
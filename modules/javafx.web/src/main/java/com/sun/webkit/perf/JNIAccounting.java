@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.webkit.perf;
+
+/**
+ * Reports the JNI upcalls of the web engine by call site. The native layer
+ * counts the upcalls of the instrumented call sites, and their total and
+ * maximum wall time. The exception checks of each call site, and the
+ * exceptions caught, are counted separately. The report lists the call sites
+ * by descending total time, then by descending number of checks.
+ * <p>
+ * The accounting is only compiled in when webkit is built with
+ * {@code -PWEBKIT_JNI_ACCOUNTING=true}. The report is printed when the JVM
+ * exits if {@code -Dcom.sun.webkit.jniAccounting=true} is set.
+ */
+public final class JNIAccounting {
+
+    private static final boolean PRINT_ON_EXIT = Boolean.getBoolean("com.sun.webkit.jniAccounting");
+
+    private JNIAccounting() {
+    }
+
+    /**
+     * Registers the report to be printed at exit if requested by the system
+     * property. Called once the native library is loaded.
+     */
+    public static void initialize() {
+        if (PRINT_ON_EXIT) {
+            if (!twkIsAvailable()) {
+                System.err.println("JNI accounting is not compiled into the web engine");
+                return;
+            }
+            Runtime.getRuntime().addShutdownHook(new Thread(() -> {
+                System.err.print(twkGetReport());
+            }));
+        }
+    }
+
+    /**
+     * Returns whether the web engine was built with JNI accounting.
+     */
+    public static boolean isAvailable() {
+        return twkIsAvailable();
+    }
+
+    /**
+     * Returns the report of the calls since the last reset, or {@code null}
+     * if JNI accounting is not available.
+     */
+    public static String getReport() {
+        return twkGetReport();
+    }
+
+    /**
+     * Resets the counts of all call sites.
+     */
+    public static void reset() {
+        twkReset();
+    }
+
+    private static native boolean twkIsAvailable();
+    private static native String twkGetReport();
+    private static native void twkReset();
+}
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.webkit.perf;
+
+import java.nio.ByteBuffer;
+
+/**
+ * Controls the native trace of the web engine. Native probes record begin
+ * and end events into a ring buffer per thread, and the rings are exported
+ * in the Chrome trace event format, which can be opened in
+ * {@code chrome://tracing} or Perfetto.
+ * <p>
+ * Tracing is enabled at startup with {@code -Dcom.sun.webkit.trace=<file>},
+ * and the trace is written to the file when the JVM exits.
+ */
+public final class NativeTrace {
+
+    private static final String TRACE_FILE = System.getProperty("com.sun.webkit.trace");
+
+    private NativeTrace() {
+    }
+
+    /**
+     * Enables tracing if requested by the system property. Called once the
+     * native library is loaded.
+     */
+    public static void initialize() {
+        if (TRACE_FILE != null && !TRACE_FILE.isEmpty()) {
+            twkSetEnabled(true);
+            Runtime.getRuntime().addShutdownHook(new Thread(() -> {
+                twkSetEnabled(false);
+                if (!twkWriteToFile(TRACE_FILE)) {
+                    System.err.println("Could not write the web trace to " + TRACE_FILE);
+                }
+            }));
+        }
+    }
+
+    public static void setEnabled(boolean enabled) {
+        twkSetEnabled(enabled);
+    }
+
+    public static boolean isEnabled() {
+        return twkIsEnabled();
+    }
+
+    /**
+     * Drops the events recorded so far.
+     */
+    public static void clear() {
+        twkClear();
+    }
+
+    /**
+     * Writes the recorded events to the file in JSON.
+     *
+     * @return {@code true} if the file was written
+     */
+    public static boolean writeTo(String path) {
+        return twkWriteToFile(path);
+    }
+
+    /**
+     * Copies the recorded events in JSON to the direct buffer, up to its
+     * capacity.
+     *
+     * @return the size of the whole trace in bytes, which is larger than the
+     * capacity of the buffer if the trace was cut short
+     */
+    public static int copyTo(ByteBuffer buffer) {
+        if (!buffer.isDirect()) {
+            throw new IllegalArgumentException("Buffer must be direct");
+        }
+        return twkCopyTo(buffer);
+    }
+
+    private static native void twkSetEnabled(boolean enabled);
+    private static native boolean twkIsEnabled();
+    private static native void twkClear();
+    private static native boolean twkWriteToFile(String path);
+    private static native int twkCopyTo(ByteBuffer buffer);
+}
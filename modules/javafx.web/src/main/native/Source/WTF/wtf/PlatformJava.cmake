@@ -8,8 +8,10 @@ list(APPEND WTF_INCLUDE_DIRECTORIES
 )
 
 list(APPEND WTF_PUBLIC_HEADERS
+    java/JNIAccounting.h
     java/JavaEnv.h
     java/JavaRef.h
+    java/JavaTrace.h
     java/DbgUtils.h
     java/JavaMath.h
     unicode/java/UnicodeJava.h
@@ -23,7 +25,9 @@ endif ()
 
 list(APPEND WTF_SOURCES
     java/FileSystemJava.cpp
+    java/JNIAccounting.cpp
     java/JavaEnv.cpp
+    java/JavaTrace.cpp
     java/MainThreadJava.cpp
     java/StringJava.cpp
     java/TextBreakIteratorInternalICUJava.cpp
@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+*/
+
+#include "config.h"
+
+#include <wtf/java/JNIAccounting.h>
+
+#include <wtf/java/JavaEnv.h>
+#include <wtf/text/WTFString.h>
+
+#if ENABLE(JAVA_JNI_ACCOUNTING)
+
+#include <algorithm>
+#include <string.h>
+#include <wtf/Lock.h>
+#include <wtf/NeverDestroyed.h>
+#include <wtf/StdLibExtras.h>
+#include <wtf/Vector.h>
+#include <wtf/text/StringBuilder.h>
+#include <wtf/text/StringCommon.h>
+
+namespace WTF {
+namespace JNIAccounting {
+
+namespace {
+
+Lock s_lock;
+// Sites are static locals of their call sites and are never freed.
+Vector<Site*>& sites()
+{
+    static NeverDestroyed<Vector<Site*>> sites;
+    return sites;
+}
+
+std::atomic<uint64_t> s_references[3];
+
+const char* baseName(const char* path)
+{
+    const char* slash = strrchr(path, '/');
+    const char* backslash = strrchr(path, '\\');
+    const char* separator = std::max(slash, backslash);
+    return separator ? separator + 1 : path;
+}
+
+} // namespace
+
+Site& registerSite(const char* file, int line)
+{
+    Site* site = new Site(file, line);
+    Locker locker { s_lock };
+    sites().append(site);
+    return *site;
+}
+
+void recordUpcall(Site& site, uint64_t time)
+{
+    site.upcalls.fetch_add(1, std::memory_order_relaxed);
+    site.totalTime.fetch_add(time, std::memory_order_relaxed);
+    uint64_t max = site.maxTime.load(std::memory_order_relaxed);
+    while (time > max && !site.maxTime.compare_exchange_weak(max, time, std::memory_order_relaxed)) { }
+}
+
+void recordCheck(Site& site, bool exception)
+{
+    site.checks.fetch_add(1, std::memory_order_relaxed);
+    if (exception)
+        site.exceptions.fetch_add(1, std::memory_order_relaxed);
+}
+
+void countReference(Reference reference)
+{
+    s_references[static_cast<size_t>(reference)].fetch_add(1, std::memory_order_relaxed);
+}
+
+String report()
+{
+    struct Entry {
+        const Site* site;
+        uint64_t upcalls;
+        uint64_t totalTime;
+        uint64_t maxTime;
+        uint64_t checks;
+        uint64_t exceptions;
+    };
+    Vector<Entry> entries;
+    {
+        Locker locker { s_lock };
+        for (const Site* site : sites()) {
+            uint64_t upcalls = site->upcalls.load(std::memory_order_relaxed);
+            uint64_t checks = site->checks.load(std::memory_order_relaxed);
+            if (!upcalls && !checks)
+                continue;
+            entries.append({ site, upcalls,
+                site->totalTime.load(std::memory_order_relaxed),
+                site->maxTime.load(std::memory_order_relaxed),
+                checks, site->exceptions.load(std::memory_order_relaxed) });
+        }
+    }
+    std::sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) {
+        return a.totalTime != b.totalTime ? a.totalTime > b.totalTime : a.checks > b.checks;
+    });
+
+    StringBuilder builder;
+    builder.append("JNI references: "_s,
+        s_references[static_cast<size_t>(Reference::NewGlobal)].load(std::memory_order_relaxed), " global created, "_s,
+        s_references[static_cast<size_t>(Reference::DeleteGlobal)].load(std::memory_order_relaxed), " global deleted, "_s,
+        s_references[static_cast<size_t>(Reference::DeleteLocal)].load(std::memory_order_relaxed), " local deleted\n"_s);
+    builder.append("total ms\tupcalls\tavg us\tmax us\tchecks\texceptions\tcall site\n"_s);
+    for (const Entry& entry : entries) {
+        builder.append(entry.totalTime / 1000000, '.', pad('0', 3, entry.totalTime / 1000 % 1000), '\t',
+            entry.upcalls, '\t', entry.upcalls ? entry.totalTime / entry.upcalls / 1000 : 0, '\t',
+            entry.maxTime / 1000, '\t', entry.checks, '\t', entry.exceptions, '\t',
+            unsafeSpan(baseName(entry.site->file)), ':', entry.site->line, '\n');
+    }
+    return builder.toString();
+}
+
+void reset()
+{
+    Locker locker { s_lock };
+    for (Site* site : sites()) {
+        site->upcalls.store(0, std::memory_order_relaxed);
+        site->totalTime.store(0, std::memory_order_relaxed);
+        site->maxTime.store(0, std::memory_order_relaxed);
+        site->checks.store(0, std::memory_order_relaxed);
+        site->exceptions.store(0, std::memory_order_relaxed);
+    }
+    for (auto& count : s_references)
+        count.store(0, std::memory_order_relaxed);
+}
+
+} // namespace JNIAccounting
+} // namespace WTF
+
+#endif // ENABLE(JAVA_JNI_ACCOUNTING)
+
+namespace WTF {
+
+extern "C" {
+
+/*
+ * Class:     com_sun_webkit_perf_JNIAccounting
+ * Method:    twkIsAvailable
+ * Signature: ()Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_sun_webkit_perf_JNIAccounting_twkIsAvailable
+  (JNIEnv*, jclass)
+{
+#if ENABLE(JAVA_JNI_ACCOUNTING)
+    return JNI_TRUE;
+#else
+    return JNI_FALSE;
+#endif
+}
+
+/*
+ * Class:     com_sun_webkit_perf_JNIAccounting
+ * Method:    twkGetReport
+ * Signature: ()Ljava/lang/String;
+ */
+JNIEXPORT jstring JNICALL Java_com_sun_webkit_perf_JNIAccounting_twkGetReport
+  (JNIEnv* env, jclass)
+{
+#if ENABLE(JAVA_JNI_ACCOUNTING)
+    return JNIAccounting::report().toJavaString(env).releaseLocal();
+#else
+    UNUSED_PARAM(env);
+    return nullptr;
+#endif
+}
+
+/*
+ * Class:     com_sun_webkit_perf_JNIAccounting
+ * Method:    twkReset
+ * Signature: ()V
+ */
+JNIEXPORT void JNICALL Java_com_sun_webkit_perf_JNIAccounting_twkReset
+  (JNIEnv*, jclass)
+{
+#if ENABLE(JAVA_JNI_ACCOUNTING)
+    JNIAccounting::reset();
+#endif
+}
+
+}
+
+} // namespace WTF
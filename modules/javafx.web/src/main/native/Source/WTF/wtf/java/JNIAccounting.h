@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+*/
+
+#pragma once
+
+#if ENABLE(JAVA_JNI_ACCOUNTING)
+
+#include <atomic>
+#include <chrono>
+#include <stdint.h>
+#include <wtf/Forward.h>
+
+// Accounting of JNI upcalls, built with -DENABLE_JAVA_JNI_ACCOUNTING=ON.
+// Upcalls wrapped in JNI_UPCALL are counted and timed per call site, from
+// the evaluation of the Call*Method arguments until it returns. Every
+// WTF::CheckAndClearException call site counts its checks and the
+// exceptions found, in a record of its own. References created and deleted
+// through JavaRef are counted too. The report is read from Java through
+// com.sun.webkit.perf.JNIAccounting.
+
+namespace WTF {
+namespace JNIAccounting {
+
+struct Site {
+    Site(const char* file, int line)
+        : file(file)
+        , line(line)
+    {
+    }
+
+    const char* const file;
+    const int line;
+    std::atomic<uint64_t> upcalls { 0 };
+    std::atomic<uint64_t> totalTime { 0 };
+    std::atomic<uint64_t> maxTime { 0 };
+    std::atomic<uint64_t> checks { 0 };
+    std::atomic<uint64_t> exceptions { 0 };
+};
+
+enum class Reference { NewGlobal, DeleteGlobal, DeleteLocal };
+
+Site& registerSite(const char* file, int line);
+void recordUpcall(Site&, uint64_t time);
+void recordCheck(Site&, bool exception);
+void countReference(Reference);
+
+ALWAYS_INLINE uint64_t now()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+template<typename Functor>
+ALWAYS_INLINE decltype(auto) timeUpcall(Site& site, const Functor& upcall)
+{
+    struct Timer {
+        Site& site;
+        uint64_t start;
+        ~Timer() { recordUpcall(site, now() - start); }
+    } timer { site, now() };
+    return upcall();
+}
+
+// Returns one line per call site reached since the last reset, by
+// descending total upcall time, then by descending number of checks.
+String report();
+void reset();
+
+} // namespace JNIAccounting
+} // namespace WTF
+
+#define JNI_ACCOUNTING_SITE() \
+    ([]() -> WTF::JNIAccounting::Site& { \
+        static WTF::JNIAccounting::Site& site = WTF::JNIAccounting::registerSite(__FILE__, __LINE__); \
+        return site; \
+    }())
+
+//example: jint size = JNI_UPCALL(env->CallIntMethod(obj, size_mID));
+//counts and times the upcall, and returns its result
+#define JNI_UPCALL(...) \
+    (WTF::JNIAccounting::timeUpcall(JNI_ACCOUNTING_SITE(), [&]() -> decltype(auto) { return __VA_ARGS__; }))
+
+#else
+
+#define JNI_UPCALL(...) (__VA_ARGS__)
+
+#endif // ENABLE(JAVA_JNI_ACCOUNTING)
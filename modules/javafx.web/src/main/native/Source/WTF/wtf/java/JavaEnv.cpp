@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -33,7 +33,8 @@ volatile bool g_ShuttingDown = false;
 namespace WTF {
 JGClass comSunWebkitFileSystem;
 
-bool CheckAndClearException(JNIEnv* env)
+// Parenthesized, so that the accounting macro in JavaEnv.h does not apply
+bool (CheckAndClearException)(JNIEnv* env)
 {
     if (JNI_TRUE == env->ExceptionCheck()) {
         env->ExceptionDescribe();
@@ -43,69 +44,6 @@ bool CheckAndClearException(JNIEnv* env)
     return false;
 }
 
-
-jclass PL_GetClass(JNIEnv* env)
-{
-    static JGClass cls(
-        env->FindClass("com/sun/webkit/perf/PerfLogger"));
-    return cls;
-}
-
-JLObject PL_GetLogger(JNIEnv* env, const char* name)
-{
-    static jmethodID mid =
-        env->GetStaticMethodID(PL_GetClass(env),
-            "getLogger",
-            "(Ljava/lang/String;)Lcom/sun/webkit/perf/PerfLogger;");
-    ASSERT(mid);
-
-    JLObject jlogger(env->CallStaticObjectMethod(PL_GetClass(env), mid,
-        (jstring)JLString(env->NewStringUTF(name))));
-    CheckAndClearException(env);
-
-    return jlogger;
-}
-
-void PL_ResumeCount(JNIEnv* env, jobject perfLogger, const char* probe)
-{
-    static jmethodID mid =
-        env->GetMethodID(PL_GetClass(env),
-            "resumeCount",
-            "(Ljava/lang/String;)V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(perfLogger, mid,
-        (jstring)JLString(env->NewStringUTF(probe)));
-    CheckAndClearException(env);
-}
-
-void PL_SuspendCount(JNIEnv* env, jobject perfLogger, const char* probe)
-{
-    static jmethodID mid =
-        env->GetMethodID(PL_GetClass(env),
-            "suspendCount",
-            "(Ljava/lang/String;)V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(perfLogger, mid,
-        (jstring)JLString(env->NewStringUTF(probe)));
-    CheckAndClearException(env);
-}
-
-bool PL_IsEnabled(JNIEnv* env, jobject perfLogger)
-{
-    static jmethodID mid =
-        env->GetMethodID(PL_GetClass(env),
-            "isEnabled",
-            "()Z");
-    ASSERT(mid);
-
-    static jboolean isEnabled = env->CallBooleanMethod(perfLogger, mid);
-    CheckAndClearException(env);
-
-    return isEnabled;
-}
-
 } // namespace WTF
 
 extern "C" {
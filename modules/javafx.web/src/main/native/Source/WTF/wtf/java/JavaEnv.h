@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,7 +25,9 @@
 
 #pragma once
 
+#include <wtf/java/JNIAccounting.h>
 #include <wtf/java/JavaRef.h>
+#include <wtf/java/JavaTrace.h>
 
 #include <jni.h>
 
@@ -47,35 +49,17 @@ ALWAYS_INLINE JNIEnv* JNICALL GetJavaEnv()
 
 bool CheckAndClearException(JNIEnv* env);
 
-JLObject PL_GetLogger(JNIEnv* env, const char* name);
-void PL_ResumeCount(JNIEnv* env, jobject perfLogger, const char* probe);
-void PL_SuspendCount(JNIEnv* env, jobject perfLogger, const char* probe);
-bool PL_IsEnabled(JNIEnv* env, jobject perfLogger);
-
-//Log wrapper
-struct EntryJavaLogger
+#if ENABLE(JAVA_JNI_ACCOUNTING)
+ALWAYS_INLINE bool CheckAndClearExceptionAt(JNIEnv* env, JNIAccounting::Site& site)
 {
-    JNIEnv     *m_env;
-    jobject     m_perfLogger;
-    const char *m_probe;
-
-    EntryJavaLogger(
-         JNIEnv *env,
-         jobject global_perfLogger,
-         const char* probe
-    ) : m_env(env)
-      , m_perfLogger(global_perfLogger)
-      , m_probe(probe)
-    {
-        PL_ResumeCount(m_env, m_perfLogger, m_probe);
-    }
-
-    ~EntryJavaLogger()
-    {
-        PL_SuspendCount(m_env, m_perfLogger, m_probe);
-    }
-};
+    bool exception = (CheckAndClearException)(env);
+    JNIAccounting::recordCheck(site, exception);
+    return exception;
+}
 
+// Every check is accounted to its own call site, see JNIAccounting.h
+#define CheckAndClearException(env) CheckAndClearExceptionAt(env, JNI_ACCOUNTING_SITE())
+#endif
 
 } // namespace WTF
 
@@ -118,12 +102,10 @@ using AttachThreadAsNonDaemonToJavaEnv = AttachThreadToJavaEnv<false>;
 } // namespace
 
 //example: LOG_PERF_RECORD(env, "XXXX", "setUpIterator")
-//the line
-//  com.sun.webkit.perf.XXXX.level = ALL
-//have to be added into the file <wk_root>/WebKitBuild/<Debug|Release>/dist/logging.properties
+//records the probe "XXXX.setUpIterator" in the native trace, which is
+//enabled with -Dcom.sun.webkit.trace=<file>, see JavaTrace.h
 #define LOG_PERF_RECORD(env, LOG_NAME, LOG_RECORD) \
-    static JGObject __logger__(WTF::PL_GetLogger(env, LOG_NAME)); \
-    WTF::EntryJavaLogger __el__(env, __logger__, LOG_RECORD);
+    JAVA_TRACE_SCOPE(LOG_NAME "." LOG_RECORD)
 
 #define jlong_to_ptr(a) ((void*)(uintptr_t)(a))
 #define ptr_to_jlong(a) ((jlong)(uintptr_t)(a))
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,6 +26,7 @@
 #pragma once
 
 #include <jni.h>
+#include <wtf/java/JNIAccounting.h>
 
 extern JavaVM* jvm;
 
@@ -61,6 +62,9 @@ public:
         JNIEnv* env = JavaScriptCore_GetJavaEnv();
         if (env && m_jref) {
             env->DeleteLocalRef(m_jref);
+#if ENABLE(JAVA_JNI_ACCOUNTING)
+            WTF::JNIAccounting::countReference(WTF::JNIAccounting::Reference::DeleteLocal);
+#endif
             m_jref = NULL;
         }
     }
@@ -140,6 +144,9 @@ public:
         JNIEnv* env = JavaScriptCore_GetJavaEnv();
         if (env && m_jref) {
             env->DeleteGlobalRef(m_jref);
+#if ENABLE(JAVA_JNI_ACCOUNTING)
+            WTF::JNIAccounting::countReference(WTF::JNIAccounting::Reference::DeleteGlobal);
+#endif
             m_jref = NULL;
         }
     }
@@ -147,6 +154,10 @@ public:
     static T copy(T ref)
     {
         JNIEnv* env = JavaScriptCore_GetJavaEnv();
+#if ENABLE(JAVA_JNI_ACCOUNTING)
+        if (env && ref)
+            WTF::JNIAccounting::countReference(WTF::JNIAccounting::Reference::NewGlobal);
+#endif
         return (env && ref)
             ? static_cast<T>(env->NewGlobalRef(ref))
             : 0;
@@ -0,0 +1,346 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+*/
+
+#include "config.h"
+
+#include <wtf/java/JavaTrace.h>
+
+#include <chrono>
+#include <stdio.h>
+#include <string.h>
+#include <wtf/Lock.h>
+#include <wtf/NeverDestroyed.h>
+#include <wtf/Vector.h>
+#include <wtf/java/JavaEnv.h>
+#include <wtf/text/CString.h>
+#include <wtf/text/StringBuilder.h>
+#include <wtf/text/WTFString.h>
+
+namespace WTF {
+namespace JavaTrace {
+
+std::atomic<bool> g_enabled { false };
+
+namespace {
+
+// Each thread writes its own ring, and the exporter reads all of them. An
+// event is a timestamp and a probe id with its phase, both stored relaxed.
+// The head counts all events ever written; the exporter rereads it after
+// copying, and drops the events that were overwritten in the meantime,
+// including the slot of the event being written at that head.
+class Ring {
+public:
+    static constexpr size_t capacity = 8192;
+
+    explicit Ring(unsigned tid)
+        : m_tid(tid)
+    {
+    }
+
+    unsigned tid() const { return m_tid; }
+
+    // Hands the ring of an exited thread to a new one. The events of the
+    // exited thread are dropped, so that they are not exported under the
+    // id of the new thread. Called with s_lock held.
+    void reuse(unsigned tid)
+    {
+        m_tid = tid;
+        clear();
+    }
+
+    void record(uint64_t timestamp, uint16_t probe, Phase phase)
+    {
+        uint64_t head = m_head.load(std::memory_order_relaxed);
+        Event& event = m_events[head & (capacity - 1)];
+        event.timestamp.store(timestamp, std::memory_order_relaxed);
+        event.probe.store(probe << 8 | static_cast<uint8_t>(phase), std::memory_order_relaxed);
+        m_head.store(head + 1, std::memory_order_release);
+    }
+
+    void clear()
+    {
+        m_start.store(m_head.load(std::memory_order_acquire), std::memory_order_relaxed);
+    }
+
+    template<typename Functor>
+    void forEachEvent(const Functor& functor) const
+    {
+        uint64_t end = m_head.load(std::memory_order_acquire);
+        uint64_t begin = std::max(m_start.load(std::memory_order_relaxed), end > capacity ? end - capacity : 0);
+        Vector<std::pair<uint64_t, uint32_t>> copy;
+        copy.reserveInitialCapacity(end - begin);
+        for (uint64_t i = begin; i < end; ++i) {
+            const Event& event = m_events[i & (capacity - 1)];
+            copy.append({ event.timestamp.load(std::memory_order_relaxed), event.probe.load(std::memory_order_relaxed) });
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        uint64_t newEnd = m_head.load(std::memory_order_relaxed);
+        uint64_t valid = newEnd + 1 > capacity ? newEnd + 1 - capacity : 0;
+        for (uint64_t i = std::max(begin, valid); i < end; ++i) {
+            auto& event = copy[i - begin];
+            functor(event.first, static_cast<uint16_t>(event.second >> 8), static_cast<Phase>(event.second & 0xff));
+        }
+    }
+
+private:
+    struct Event {
+        std::atomic<uint64_t> timestamp;
+        std::atomic<uint32_t> probe;
+    };
+
+    unsigned m_tid;
+    std::atomic<uint64_t> m_head { 0 };
+    std::atomic<uint64_t> m_start { 0 };
+    Event m_events[capacity];
+};
+
+Lock s_lock;
+unsigned s_lastTid;
+// Rings outlive their threads, so that their events can still be exported
+// until the ring is reused by a new thread.
+Vector<Ring*>& rings()
+{
+    static NeverDestroyed<Vector<Ring*>> rings;
+    return rings;
+}
+
+// The rings of exited threads
+Vector<Ring*>& freeRings()
+{
+    static NeverDestroyed<Vector<Ring*>> rings;
+    return rings;
+}
+
+Vector<const char*>& probeNames()
+{
+    static NeverDestroyed<Vector<const char*>> names;
+    return names;
+}
+
+// Puts the ring of the thread on the free list when the thread exits.
+class RingOwner {
+public:
+    Ring* ring() const { return m_ring; }
+    void setRing(Ring* ring) { m_ring = ring; }
+
+    ~RingOwner();
+
+private:
+    Ring* m_ring { nullptr };
+};
+
+thread_local RingOwner t_ring;
+// Set once the owner is destroyed, so that probes in later thread_local
+// destructors do not take a ring that would never be released.
+thread_local bool t_exited;
+
+RingOwner::~RingOwner()
+{
+    t_exited = true;
+    if (m_ring) {
+        Locker locker { s_lock };
+        freeRings().append(m_ring);
+        m_ring = nullptr;
+    }
+}
+
+Ring* currentRing()
+{
+    if (t_exited)
+        return nullptr;
+    Ring* ring = t_ring.ring();
+    if (!ring) {
+        Locker locker { s_lock };
+        unsigned tid = ++s_lastTid;
+        if (!freeRings().isEmpty()) {
+            ring = freeRings().takeLast();
+            ring->reuse(tid);
+        } else {
+            ring = new Ring(tid);
+            rings().append(ring);
+        }
+        t_ring.setRing(ring);
+    }
+    return ring;
+}
+
+uint64_t now()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void appendEscaped(StringBuilder& builder, const char* name)
+{
+    for (const char* c = name; *c; ++c) {
+        if (*c == '"' || *c == '\\')
+            builder.append('\\');
+        builder.append(*c);
+    }
+}
+
+CString toJSON()
+{
+    Locker locker { s_lock };
+    StringBuilder builder;
+    builder.append("{\"traceEvents\":["_s);
+    bool first = true;
+    for (Ring* ring : rings()) {
+        ring->forEachEvent([&](uint64_t timestamp, uint16_t probe, Phase phase) {
+            if (probe >= probeNames().size())
+                return;
+            if (!first)
+                builder.append(",\n"_s);
+            first = false;
+            builder.append("{\"name\":\""_s);
+            appendEscaped(builder, probeNames()[probe]);
+            builder.append("\",\"ph\":\""_s,
+                phase == Phase::Begin ? "B"_s : "E"_s,
+                "\",\"pid\":1,\"tid\":"_s, ring->tid(),
+                ",\"ts\":"_s, timestamp / 1000, '.',
+                static_cast<char>('0' + timestamp % 1000 / 100),
+                static_cast<char>('0' + timestamp % 100 / 10),
+                static_cast<char>('0' + timestamp % 10), '}');
+        });
+    }
+    builder.append("],\"displayTimeUnit\":\"ns\"}\n"_s);
+    return builder.toString().utf8();
+}
+
+} // namespace
+
+void setEnabled(bool enabled)
+{
+    g_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+uint16_t probeId(const char* name)
+{
+    Locker locker { s_lock };
+    auto& names = probeNames();
+    for (size_t i = 0; i < names.size(); ++i) {
+        if (!strcmp(names[i], name))
+            return static_cast<uint16_t>(i);
+    }
+    names.append(name);
+    return static_cast<uint16_t>(names.size() - 1);
+}
+
+void record(uint16_t probe, Phase phase)
+{
+    if (Ring* ring = currentRing())
+        ring->record(now(), probe, phase);
+}
+
+void clear()
+{
+    Locker locker { s_lock };
+    for (Ring* ring : rings())
+        ring->clear();
+}
+
+size_t exportTo(char* buffer, size_t capacity)
+{
+    CString json = toJSON();
+    memcpy(buffer, json.data(), std::min(capacity, json.length()));
+    return json.length();
+}
+
+bool writeToFile(const char* path)
+{
+    CString json = toJSON();
+    FILE* file = fopen(path, "w");
+    if (!file)
+        return false;
+    bool written = fwrite(json.data(), 1, json.length(), file) == json.length();
+    return !fclose(file) && written;
+}
+
+} // namespace JavaTrace
+
+extern "C" {
+
+/*
+ * Class:     com_sun_webkit_perf_NativeTrace
+ * Method:    twkSetEnabled
+ * Signature: (Z)V
+ */
+JNIEXPORT void JNICALL Java_com_sun_webkit_perf_NativeTrace_twkSetEnabled
+  (JNIEnv*, jclass, jboolean enabled)
+{
+    JavaTrace::setEnabled(jbool_to_bool(enabled));
+}
+
+/*
+ * Class:     com_sun_webkit_perf_NativeTrace
+ * Method:    twkIsEnabled
+ * Signature: ()Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_sun_webkit_perf_NativeTrace_twkIsEnabled
+  (JNIEnv*, jclass)
+{
+    return bool_to_jbool(JavaTrace::isEnabled());
+}
+
+/*
+ * Class:     com_sun_webkit_perf_NativeTrace
+ * Method:    twkClear
+ * Signature: ()V
+ */
+JNIEXPORT void JNICALL Java_com_sun_webkit_perf_NativeTrace_twkClear
+  (JNIEnv*, jclass)
+{
+    JavaTrace::clear();
+}
+
+/*
+ * Class:     com_sun_webkit_perf_NativeTrace
+ * Method:    twkCopyTo
+ * Signature: (Ljava/nio/ByteBuffer;)I
+ */
+JNIEXPORT jint JNICALL Java_com_sun_webkit_perf_NativeTrace_twkCopyTo
+  (JNIEnv* env, jclass, jobject buffer)
+{
+    char* address = static_cast<char*>(env->GetDirectBufferAddress(buffer));
+    jlong capacity = env->GetDirectBufferCapacity(buffer);
+    if (!address || capacity < 0)
+        return -1;
+    return static_cast<jint>(JavaTrace::exportTo(address, static_cast<size_t>(capacity)));
+}
+
+/*
+ * Class:     com_sun_webkit_perf_NativeTrace
+ * Method:    twkWriteToFile
+ * Signature: (Ljava/lang/String;)Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_sun_webkit_perf_NativeTrace_twkWriteToFile
+  (JNIEnv* env, jclass, jstring path)
+{
+    return bool_to_jbool(JavaTrace::writeToFile(String::fromJavaString(env, path).utf8().data()));
+}
+
+}
+
+} // namespace WTF
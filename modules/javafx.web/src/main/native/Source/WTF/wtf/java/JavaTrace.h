@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+// Native tracing for the web port. Probes record begin and end events with
+// nanosecond timestamps into a ring buffer owned by the recording thread,
+// without locks or JNI calls. The rings are exported in the Chrome trace
+// event format, see com.sun.webkit.perf.NativeTrace. A probe costs one
+// relaxed load while tracing is off.
+
+namespace WTF {
+namespace JavaTrace {
+
+extern std::atomic<bool> g_enabled;
+
+ALWAYS_INLINE bool isEnabled()
+{
+    return g_enabled.load(std::memory_order_relaxed);
+}
+
+void setEnabled(bool);
+
+// Returns the id of the probe with the given name, registering the name on
+// the first call. The name must be a string literal.
+uint16_t probeId(const char* name);
+
+enum class Phase : uint8_t { Begin, End };
+
+void record(uint16_t probe, Phase);
+
+// Drops all recorded events.
+void clear();
+
+// Writes the recorded events as JSON to the buffer, up to its capacity,
+// and returns the size of the whole JSON text.
+size_t exportTo(char* buffer, size_t capacity);
+
+bool writeToFile(const char* path);
+
+class Scope {
+public:
+    ALWAYS_INLINE explicit Scope(uint16_t probe)
+        : m_probe(probe)
+        , m_active(isEnabled())
+    {
+        if (m_active)
+            record(m_probe, Phase::Begin);
+    }
+
+    ALWAYS_INLINE ~Scope()
+    {
+        if (m_active)
+            record(m_probe, Phase::End);
+    }
+
+private:
+    uint16_t m_probe;
+    bool m_active;
+};
+
+} // namespace JavaTrace
+} // namespace WTF
+
+//example: JAVA_TRACE_SCOPE("WebPage::paint")
+//records the time spent in the enclosing scope
+#define JAVA_TRACE_SCOPE(PROBE) \
+    static const uint16_t __traceProbe__ = WTF::JavaTrace::probeId(PROBE); \
+    WTF::JavaTrace::Scope __traceScope__(__traceProbe__);
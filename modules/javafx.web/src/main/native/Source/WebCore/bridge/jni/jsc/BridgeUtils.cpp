@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -45,6 +45,7 @@
 #include "runtime_object.h"
 #include "runtime_root.h"
 #include <wtf/java/JavaRef.h>
+#include <wtf/java/JavaTrace.h>
 #include <wtf/text/WTFString.h>
 #include <JavaScriptCore/JSArray.h>
 #include <JavaScriptCore/JSLock.h>
@@ -324,6 +325,7 @@ extern "C" {
 JNIEXPORT jobject JNICALL Java_com_sun_webkit_dom_JSObject_evalImpl
 (JNIEnv *env, jclass, jlong peer, jint peer_type, jstring str)
 {
+    JAVA_TRACE_SCOPE("JSObject.eval");
     if (str == nullptr) {
         throwNullPointerException(env);
         return nullptr;
@@ -342,6 +344,7 @@ JNIEXPORT jobject JNICALL Java_com_sun_webkit_dom_JSObject_evalImpl
 JNIEXPORT jobject JNICALL Java_com_sun_webkit_dom_JSObject_getMemberImpl
 (JNIEnv *env, jclass, jlong peer, jint peer_type, jstring str)
 {
+    JAVA_TRACE_SCOPE("JSObject.getMember");
     if (str == nullptr) {
         throwNullPointerException(env);
         return nullptr;
@@ -363,6 +366,7 @@ JNIEXPORT jobject JNICALL Java_com_sun_webkit_dom_JSObject_getMemberImpl
 JNIEXPORT void JNICALL Java_com_sun_webkit_dom_JSObject_setMemberImpl
 (JNIEnv *env, jclass, jlong peer, jint peer_type, jstring str, jobject value, jobject accessControlContext)
 {
+    JAVA_TRACE_SCOPE("JSObject.setMember");
     if (str == nullptr) {
         throwNullPointerException(env);
         return;
@@ -387,6 +391,7 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_dom_JSObject_setMemberImpl
 JNIEXPORT void JNICALL Java_com_sun_webkit_dom_JSObject_removeMemberImpl
 (JNIEnv *env, jclass, jlong peer, jint peer_type, jstring str)
 {
+    JAVA_TRACE_SCOPE("JSObject.removeMember");
     if (str == nullptr) {
         throwNullPointerException(env);
         return;
@@ -406,6 +411,7 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_dom_JSObject_removeMemberImpl
 JNIEXPORT jobject JNICALL Java_com_sun_webkit_dom_JSObject_getSlotImpl
   (JNIEnv *env, jclass, jlong peer, jint peer_type, jint index)
 {
+    JAVA_TRACE_SCOPE("JSObject.getSlot");
     JSObjectRef object;
     JSContextRef ctx;
     RefPtr<JSC::Bindings::RootObject> rootObject(checkJSPeer(peer, peer_type, object, ctx));
@@ -421,6 +427,7 @@ JNIEXPORT jobject JNICALL Java_com_sun_webkit_dom_JSObject_getSlotImpl
 JNIEXPORT void JNICALL Java_com_sun_webkit_dom_JSObject_setSlotImpl
 (JNIEnv *env, jclass, jlong peer, jint peer_type, jint index, jobject value, jobject accessControlContext)
 {
+    JAVA_TRACE_SCOPE("JSObject.setSlot");
     JSObjectRef object;
     JSContextRef ctx;
     RefPtr<JSC::Bindings::RootObject> rootObject(checkJSPeer(peer, peer_type, object, ctx));
@@ -436,6 +443,7 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_dom_JSObject_setSlotImpl
 JNIEXPORT jstring JNICALL Java_com_sun_webkit_dom_JSObject_toStringImpl
 (JNIEnv *env, jclass, jlong peer, jint peer_type)
 {
+    JAVA_TRACE_SCOPE("JSObject.toString");
     JSObjectRef object;
     JSContextRef ctx;
     if (!checkJSPeer(peer, peer_type, object, ctx)) {
@@ -452,6 +460,7 @@ JNIEXPORT jstring JNICALL Java_com_sun_webkit_dom_JSObject_toStringImpl
 JNIEXPORT jobject JNICALL Java_com_sun_webkit_dom_JSObject_callImpl
   (JNIEnv *env, jclass, jlong peer, jint peer_type, jstring methodName, jobjectArray args, jobject accessControlContext)
 {
+    JAVA_TRACE_SCOPE("JSObject.call");
     if (methodName == nullptr || args == nullptr) {
         throwNullPointerException(env);
         return nullptr;
@@ -47,6 +47,7 @@
 #include <JavaScriptCore/FunctionPrototype.h>
 #include <JavaScriptCore/JSLock.h>
 #include <JavaScriptCore/JSString.h>
+#include <wtf/java/JavaTrace.h>
 
 using namespace JSC::Bindings;
 using namespace JSC;
@@ -244,6 +245,7 @@ JSValue JavaInstance::getMethod(JSGlobalObject* lexicalGlobalObject, PropertyNam
 
 JSValue JavaInstance::invokeMethod(JSGlobalObject* globalObject, CallFrame* callFrame, RuntimeMethod* runtimeMethod)
 {
+    JAVA_TRACE_SCOPE("JavaInstance::invokeMethod");
     VM& vm = globalObject->vm();
     auto scope = DECLARE_THROW_SCOPE(vm);
 
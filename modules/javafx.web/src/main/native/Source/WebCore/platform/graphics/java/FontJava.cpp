@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -51,25 +51,25 @@ void Font::platformInit()
     static jmethodID getXHeight_mID = env->GetMethodID(PG_GetFontClass(env),
         "getXHeight", "()F");
     ASSERT(getXHeight_mID);
-    m_fontMetrics.setXHeight(env->CallFloatMethod(*jFont, getXHeight_mID));
+    m_fontMetrics.setXHeight(JNI_UPCALL(env->CallFloatMethod(*jFont, getXHeight_mID)));
     WTF::CheckAndClearException(env);
 
     static jmethodID getCapHeight_mID = env->GetMethodID(PG_GetFontClass(env),
         "getCapHeight", "()F");
     ASSERT(getCapHeight_mID);
-    m_fontMetrics.setCapHeight(env->CallFloatMethod(*jFont, getCapHeight_mID));
+    m_fontMetrics.setCapHeight(JNI_UPCALL(env->CallFloatMethod(*jFont, getCapHeight_mID)));
     WTF::CheckAndClearException(env);
 
     static jmethodID getAscent_mID = env->GetMethodID(PG_GetFontClass(env),
         "getAscent", "()F");
     ASSERT(getAscent_mID);
-    m_fontMetrics.setAscent(env->CallFloatMethod(*jFont, getAscent_mID));
+    m_fontMetrics.setAscent(JNI_UPCALL(env->CallFloatMethod(*jFont, getAscent_mID)));
     WTF::CheckAndClearException(env);
 
     static jmethodID getDescent_mID = env->GetMethodID(PG_GetFontClass(env),
         "getDescent", "()F");
     ASSERT(getDescent_mID);
-    m_fontMetrics.setDescent(env->CallFloatMethod(*jFont, getDescent_mID));
+    m_fontMetrics.setDescent(JNI_UPCALL(env->CallFloatMethod(*jFont, getDescent_mID)));
     WTF::CheckAndClearException(env);
 
     static jmethodID getLineSpacing_mID = env->GetMethodID(PG_GetFontClass(env),
@@ -77,13 +77,13 @@ void Font::platformInit()
     ASSERT(getLineSpacing_mID);
     // Match CoreGraphics metrics.
     m_fontMetrics.setLineSpacing(lroundf(
-        env->CallFloatMethod(*jFont, getLineSpacing_mID)));
+        JNI_UPCALL(env->CallFloatMethod(*jFont, getLineSpacing_mID))));
     WTF::CheckAndClearException(env);
 
     static jmethodID getLineGap_mID = env->GetMethodID(PG_GetFontClass(env),
         "getLineGap", "()F");
     ASSERT(getLineGap_mID);
-    m_fontMetrics.setLineGap(env->CallFloatMethod(*jFont, getLineGap_mID));
+    m_fontMetrics.setLineGap(JNI_UPCALL(env->CallFloatMethod(*jFont, getLineGap_mID)));
     WTF::CheckAndClearException(env);
 }
 
@@ -101,7 +101,7 @@ void Font::determinePitch()
             PG_GetFontClass(env), "hasUniformLineMetrics", "()Z");
     ASSERT(hasUniformLineMetrics_mID);
 
-    m_treatAsFixedPitch = jbool_to_bool(env->CallBooleanMethod(*jFont, hasUniformLineMetrics_mID));
+    m_treatAsFixedPitch = jbool_to_bool(JNI_UPCALL(env->CallBooleanMethod(*jFont, hasUniformLineMetrics_mID)));
     WTF::CheckAndClearException(env);
 }
 
@@ -134,7 +134,7 @@ float Font::platformWidthForGlyph(Glyph c) const
         "getGlyphWidth", "(I)D");
     ASSERT(getGlyphWidth_mID);
 
-    float res = env->CallDoubleMethod(*jFont, getGlyphWidth_mID, (jint)c);
+    float res = JNI_UPCALL(env->CallDoubleMethod(*jFont, getGlyphWidth_mID, (jint)c));
     WTF::CheckAndClearException(env);
 
     return res;
@@ -152,7 +152,7 @@ FloatRect Font::platformBoundsForGlyph(Glyph c) const
     static jmethodID getGlyphBoundingBox_mID = env->GetMethodID(PG_GetFontClass(env), "getGlyphBoundingBox", "(I)[F");
     ASSERT(getGlyphBoundingBox_mID);
 
-    jfloatArray boundingBox = (jfloatArray)env->CallObjectMethod(*jFont, getGlyphBoundingBox_mID, (jint)c);
+    jfloatArray boundingBox = (jfloatArray)JNI_UPCALL(env->CallObjectMethod(*jFont, getGlyphBoundingBox_mID, (jint)c));
     jfloat *bBox = env->GetFloatArrayElements(boundingBox,0);
     auto bb = FloatRect { bBox[0], bBox[1], bBox[2], bBox[3] };
     env->ReleaseFloatArrayElements(boundingBox, bBox, 0);
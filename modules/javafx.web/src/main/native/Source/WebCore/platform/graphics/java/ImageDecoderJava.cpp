@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2017, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -69,9 +69,9 @@ ImageDecoderJava::ImageDecoderJava()
         "()Lcom/sun/webkit/graphics/WCImageDecoder;");
     ASSERT(midGetImageDecoder);
 
-    m_nativeDecoder = JLObject(env->CallObjectMethod(
+    m_nativeDecoder = JLObject(JNI_UPCALL(env->CallObjectMethod(
         PL_GetGraphicsManager(env),
-        midGetImageDecoder));
+        midGetImageDecoder)));
 
     WTF::CheckAndClearException(env);
 }
@@ -93,12 +93,13 @@ ImageDecoderJava::~ImageDecoderJava()
             "()V");
     ASSERT(midDestroy);
 
-    env->CallVoidMethod(m_nativeDecoder, midDestroy);
+    JNI_UPCALL(env->CallVoidMethod(m_nativeDecoder, midDestroy));
     WTF::CheckAndClearException(env);
 }
 
 void ImageDecoderJava::setData(const FragmentedSharedBuffer& data, bool allDataReceived)
 {
+    JAVA_TRACE_SCOPE("ImageDecoderJava::setData");
     JNIEnv* env = WTF::GetJavaEnv();
     if (!env || !m_nativeDecoder) {
         return;
@@ -117,7 +118,7 @@ void ImageDecoderJava::setData(const FragmentedSharedBuffer& data, bool allDataR
         if (jArray && !WTF::CheckAndClearException(env)) {
             // not OOME in Java
             env->SetByteArrayRegion(jArray, 0, length, (const jbyte*)someData.span().data());
-            env->CallVoidMethod(m_nativeDecoder, midAddImageData, (jbyteArray)jArray);
+            JNI_UPCALL(env->CallVoidMethod(m_nativeDecoder, midAddImageData, (jbyteArray)jArray));
             WTF::CheckAndClearException(env);
         }
         m_receivedDataSize += length;
@@ -125,7 +126,7 @@ void ImageDecoderJava::setData(const FragmentedSharedBuffer& data, bool allDataR
 
     if (allDataReceived) {
         m_isAllDataReceived = true;
-        env->CallVoidMethod(m_nativeDecoder, midAddImageData, 0);
+        JNI_UPCALL(env->CallVoidMethod(m_nativeDecoder, midAddImageData, 0));
         WTF::CheckAndClearException(env);
     }
 }
@@ -143,8 +144,8 @@ bool ImageDecoderJava::isSizeAvailable() const
         "()[I");
     ASSERT(midGetImageSize);
 
-    JLocalRef<jintArray> jsize((jintArray)env->CallObjectMethod(
-                m_nativeDecoder, midGetImageSize));
+    JLocalRef<jintArray> jsize((jintArray)JNI_UPCALL(env->CallObjectMethod(
+                m_nativeDecoder, midGetImageSize)));
     WTF::CheckAndClearException(env);
 
     jint* size = (jint*)env->GetPrimitiveArrayCritical((jintArray)jsize, 0);
@@ -168,7 +169,7 @@ size_t ImageDecoderJava::frameCount() const
         "()I");
     ASSERT(midGetFrameCount);
 
-    jint count = env->CallIntMethod(m_nativeDecoder, midGetFrameCount);
+    jint count = JNI_UPCALL(env->CallIntMethod(m_nativeDecoder, midGetFrameCount));
     WTF::CheckAndClearException(env);
 
     return count < 1
@@ -178,6 +179,7 @@ size_t ImageDecoderJava::frameCount() const
 
 PlatformImagePtr ImageDecoderJava::createFrameImageAtIndex(size_t idx, SubsamplingLevel, const DecodingOptions&)
 {
+    JAVA_TRACE_SCOPE("ImageDecoderJava::createFrameImageAtIndex");
     JNIEnv* env = WTF::GetJavaEnv();
     if (!env || !m_nativeDecoder) {
         return { };
@@ -189,10 +191,10 @@ PlatformImagePtr ImageDecoderJava::createFrameImageAtIndex(size_t idx, Subsampli
         "(I)Lcom/sun/webkit/graphics/WCImageFrame;");
     ASSERT(midGetFrame);
 
-    JLObject frame(env->CallObjectMethod(
+    JLObject frame(JNI_UPCALL(env->CallObjectMethod(
         m_nativeDecoder,
         midGetFrame,
-        idx));
+        idx)));
     WTF::CheckAndClearException(env);
 
     if(!frame)
@@ -203,9 +205,9 @@ PlatformImagePtr ImageDecoderJava::createFrameImageAtIndex(size_t idx, Subsampli
         "getSize",
         "()[I");
     ASSERT(midGetSize);
-    JLocalRef<jintArray> jsize((jintArray)env->CallObjectMethod(
+    JLocalRef<jintArray> jsize((jintArray)JNI_UPCALL(env->CallObjectMethod(
                         jobject(frame),
-                        midGetSize));
+                        midGetSize)));
     if (!jsize) {
         return ImageJava::create(RQRef::create(frame), nullptr, 0, 0);
     }
@@ -228,10 +230,10 @@ WTF::Seconds ImageDecoderJava::frameDurationAtIndex(size_t idx) const
         "getFrameDuration",
         "(I)I");
     ASSERT(midGetDuration);
-    jint duration = env->CallIntMethod(
+    jint duration = JNI_UPCALL(env->CallIntMethod(
                         m_nativeDecoder,
                         midGetDuration,
-                        idx);
+                        idx));
     return WTF::Seconds::fromMilliseconds(duration);
 }
 
@@ -259,10 +261,10 @@ IntSize ImageDecoderJava::frameSizeAtIndex(size_t idx, SubsamplingLevel) const
         "getFrameSize",
         "(I)[I");
     ASSERT(midGetFrameSize);
-    JLocalRef<jintArray> jsize((jintArray)env->CallObjectMethod(
+    JLocalRef<jintArray> jsize((jintArray)JNI_UPCALL(env->CallObjectMethod(
                         m_nativeDecoder,
                         midGetFrameSize,
-                        idx));
+                        idx)));
     if (!jsize) {
         return m_size;
     }
@@ -297,9 +299,9 @@ bool ImageDecoderJava::frameIsCompleteAtIndex(size_t idx) const
         "getFrameCompleteStatus",
         "(I)Z");
     ASSERT(midGetFrameIsComplete);
-    return (bool)env->CallBooleanMethod(m_nativeDecoder,
+    return (bool)JNI_UPCALL(env->CallBooleanMethod(m_nativeDecoder,
             midGetFrameIsComplete,
-            idx);
+            idx));
 }
 
 unsigned ImageDecoderJava::frameBytesAtIndex(size_t idx, SubsamplingLevel samplingLevel) const
@@ -326,9 +328,9 @@ String ImageDecoderJava::filenameExtension() const
         "()Ljava/lang/String;");
     ASSERT(midGetFileExtention);
 
-    JLString ext((jstring)env->CallObjectMethod(
+    JLString ext((jstring)JNI_UPCALL(env->CallObjectMethod(
         m_nativeDecoder,
-        midGetFileExtention));
+        midGetFileExtention)));
     WTF::CheckAndClearException(env);
 
     return String(env, ext);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -64,7 +64,7 @@ PlatformPathPtr PathJava::emptyPlatformPath()
            "createWCPath", "()Lcom/sun/webkit/graphics/WCPath;");
        ASSERT(mid);
 
-       JLObject ref(env->CallObjectMethod(PL_GetGraphicsManager(env), mid));
+       JLObject ref(JNI_UPCALL(env->CallObjectMethod(PL_GetGraphicsManager(env), mid)));
        ASSERT(ref);
        WTF::CheckAndClearException(env);
        return RQRef::create(ref);
@@ -77,7 +77,7 @@ RefPtr<RQRef> createEmptyPath()
         "createWCPath", "()Lcom/sun/webkit/graphics/WCPath;");
     ASSERT(mid);
 
-    JLObject ref(env->CallObjectMethod(PL_GetGraphicsManager(env), mid));
+    JLObject ref(JNI_UPCALL(env->CallObjectMethod(PL_GetGraphicsManager(env), mid)));
     ASSERT(ref);
     WTF::CheckAndClearException(env);
     return RQRef::create(ref);
@@ -102,7 +102,7 @@ RefPtr<RQRef> copyPath(RefPtr<RQRef> p)
         "(Lcom/sun/webkit/graphics/WCPath;)Lcom/sun/webkit/graphics/WCPath;");
     ASSERT(mid);
 
-    JLObject ref(env->CallObjectMethod(PL_GetGraphicsManager(env), mid, (jobject)*p));
+    JLObject ref(JNI_UPCALL(env->CallObjectMethod(PL_GetGraphicsManager(env), mid, (jobject)*p)));
     ASSERT(ref);
     WTF::CheckAndClearException(env);
 
@@ -166,7 +166,7 @@ void PathJava::add(PathMoveTo moveto)
         "(DD)V");
     ASSERT(mid);
 
-    env->CallVoidMethod(*m_platformPath, mid, (jdouble)moveto.point.x(), (jdouble)moveto.point.y());
+    JNI_UPCALL(env->CallVoidMethod(*m_platformPath, mid, (jdouble)moveto.point.x(), (jdouble)moveto.point.y()));
     WTF::CheckAndClearException(env);
 }
 
@@ -180,7 +180,7 @@ void PathJava::add(PathLineTo lineTo)
         "(DD)V");
     ASSERT(mid);
 
-    env->CallVoidMethod(*m_platformPath, mid, (jdouble)lineTo.point.x(), (jdouble)lineTo.point.y());
+    JNI_UPCALL(env->CallVoidMethod(*m_platformPath, mid, (jdouble)lineTo.point.x(), (jdouble)lineTo.point.y()));
     WTF::CheckAndClearException(env);
 }
 
@@ -194,7 +194,7 @@ void PathJava::add(PathQuadCurveTo quadTo)
                                             "(DDDD)V");
     ASSERT(mid);
 
-    env->CallVoidMethod(*m_platformPath, mid, (jdouble)quadTo.controlPoint.x(), (jdouble)quadTo.controlPoint.y(), (jdouble)quadTo.endPoint.x(), (jdouble)quadTo.endPoint.y());
+    JNI_UPCALL(env->CallVoidMethod(*m_platformPath, mid, (jdouble)quadTo.controlPoint.x(), (jdouble)quadTo.controlPoint.y(), (jdouble)quadTo.endPoint.x(), (jdouble)quadTo.endPoint.y()));
     WTF::CheckAndClearException(env);
 }
 
@@ -208,10 +208,10 @@ void PathJava::add(PathBezierCurveTo bezierTo)
         "addBezierCurveTo", "(DDDDDD)V");
     ASSERT(mid);
 
-    env->CallVoidMethod(*m_platformPath, mid,
+    JNI_UPCALL(env->CallVoidMethod(*m_platformPath, mid,
                         (jdouble)bezierTo.controlPoint1.x(), (jdouble)bezierTo.controlPoint1.y(),
                         (jdouble)bezierTo.controlPoint2.x(), (jdouble)bezierTo.controlPoint2.y(),
-                        (jdouble)bezierTo.endPoint.x(), (jdouble)bezierTo.endPoint.y());
+                        (jdouble)bezierTo.endPoint.x(), (jdouble)bezierTo.endPoint.y()));
     WTF::CheckAndClearException(env);
 }
 
@@ -230,9 +230,9 @@ void PathJava::add(PathArcTo arcTo)
         "(DDDDD)V");
     ASSERT(mid);
 
-    env->CallVoidMethod(*m_platformPath, mid,
+    JNI_UPCALL(env->CallVoidMethod(*m_platformPath, mid,
                         (jdouble)arcTo.controlPoint1.x(), (jdouble)arcTo.controlPoint1.y(),
-                        (jdouble)arcTo.controlPoint2.x(), (jdouble)arcTo.controlPoint2.y(), (jdouble)arcTo.radius);
+                        (jdouble)arcTo.controlPoint2.x(), (jdouble)arcTo.controlPoint2.y(), (jdouble)arcTo.radius));
     WTF::CheckAndClearException(env);
 }
 
@@ -253,9 +253,9 @@ void PathJava::add(PathArc arc)
         "(DDDDDZ)V");
     ASSERT(mid);
 
-    env->CallVoidMethod(*m_platformPath, mid, (jdouble)arc.center.x(), (jdouble)arc.center.y(),
+    JNI_UPCALL(env->CallVoidMethod(*m_platformPath, mid, (jdouble)arc.center.x(), (jdouble)arc.center.y(),
         (jdouble)arc.radius, (jdouble)arc.startAngle, (jdouble)arc.endAngle,
-        bool_to_jbool(clockwise));
+        bool_to_jbool(clockwise)));
     WTF::CheckAndClearException(env);
 }
 void PathJava::add(PathClosedArc closedArc)
@@ -277,9 +277,9 @@ void PathJava::add(PathEllipseInRect ellipseInRect)
         "(DDDD)V");
     ASSERT(mid);
 
-    env->CallVoidMethod(*m_platformPath, mid,
+    JNI_UPCALL(env->CallVoidMethod(*m_platformPath, mid,
                         (jdouble)ellipseInRect.rect.x(), (jdouble)ellipseInRect.rect.y(),
-                        (jdouble)ellipseInRect.rect.width(), (jdouble)ellipseInRect.rect.height());
+                        (jdouble)ellipseInRect.rect.width(), (jdouble)ellipseInRect.rect.height()));
     WTF::CheckAndClearException(env);
 }
 
@@ -293,8 +293,8 @@ void PathJava::add(PathRect rect)
         "(DDDD)V");
     ASSERT(mid);
 
-    env->CallVoidMethod(*m_platformPath, mid, (jdouble)rect.rect.x(), (jdouble)rect.rect.y(),
-                              (jdouble)rect.rect.width(), (jdouble)rect.rect.height());
+    JNI_UPCALL(env->CallVoidMethod(*m_platformPath, mid, (jdouble)rect.rect.x(), (jdouble)rect.rect.y(),
+                              (jdouble)rect.rect.width(), (jdouble)rect.rect.height()));
     WTF::CheckAndClearException(env);
 }
 
@@ -314,7 +314,7 @@ void PathJava::add(PathCloseSubpath)
         "closeSubpath", "()V");
     ASSERT(mid);
 
-    env->CallVoidMethod(*m_platformPath, mid);
+    JNI_UPCALL(env->CallVoidMethod(*m_platformPath, mid));
     WTF::CheckAndClearException(env);
 }
 
@@ -366,7 +366,7 @@ bool PathJava::isEmpty() const
                                             "isEmpty", "()Z");
     ASSERT(mid);
 
-    jboolean res = env->CallBooleanMethod(*m_platformPath, mid);
+    jboolean res = JNI_UPCALL(env->CallBooleanMethod(*m_platformPath, mid));
     WTF::CheckAndClearException(env);
 
     return jbool_to_bool(res);
@@ -389,10 +389,10 @@ bool PathJava::transform(const AffineTransform& transform)
         "transform", "(DDDDDD)V");
     ASSERT(mid);
 
-    env->CallVoidMethod(*m_platformPath, mid,
+    JNI_UPCALL(env->CallVoidMethod(*m_platformPath, mid,
                         (jdouble)transform.a(), (jdouble)transform.b(),
                         (jdouble)transform.c(), (jdouble)transform.d(),
-                        (jdouble)transform.e(), (jdouble)transform.f());
+                        (jdouble)transform.e(), (jdouble)transform.f()));
     WTF::CheckAndClearException(env);
     return true;
 }
@@ -410,8 +410,8 @@ bool PathJava::contains(const FloatPoint &point, WindRule rule) const
         "(IDD)Z");
     ASSERT(mid);
 
-    jboolean res = env->CallBooleanMethod(*m_platformPath, mid, (jint)rule,
-        (jdouble)point.x(), (jdouble)point.y());
+    jboolean res = JNI_UPCALL(env->CallBooleanMethod(*m_platformPath, mid, (jint)rule,
+        (jdouble)point.x(), (jdouble)point.y()));
     WTF::CheckAndClearException(env);
 
     return jbool_to_bool(res);
@@ -451,9 +451,9 @@ bool PathJava::strokeContains(const FloatPoint& p, const Function<void(GraphicsC
     JLocalRef<jdoubleArray> dashArray(env->NewDoubleArray(size));
     env->SetDoubleArrayRegion(dashArray, 0, size, dashes.span().data());
 
-    jboolean res = env->CallBooleanMethod(*m_platformPath, mid, (jdouble)p.x(),
+    jboolean res = JNI_UPCALL(env->CallBooleanMethod(*m_platformPath, mid, (jdouble)p.x(),
         (jdouble)p.y(), (jdouble) thickness, (jdouble) miterLimit,
-        (jint) cap, (jint) join, (jdouble) dashOffset, (jdoubleArray) dashArray);
+        (jint) cap, (jint) join, (jdouble) dashOffset, (jdoubleArray) dashArray));
 
     WTF::CheckAndClearException(env);
 
@@ -480,7 +480,7 @@ FloatRect PathJava::strokeBoundingRect(const Function<void(GraphicsContext&)>& s
             "()Lcom/sun/webkit/graphics/WCRectangle;");
     ASSERT(mid);
 
-    JLObject rect(env->CallObjectMethod(*m_platformPath, mid));
+    JLObject rect(JNI_UPCALL(env->CallObjectMethod(*m_platformPath, mid)));
     WTF::CheckAndClearException(env);
     if (rect) {
         static jfieldID rectxFID = env->GetFieldID(PG_GetRectangleClass(env), "x", "F");
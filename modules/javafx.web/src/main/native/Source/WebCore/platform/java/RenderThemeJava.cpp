@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -191,7 +191,7 @@ bool RenderThemeJava::paintWidget(
 
     auto [r, g, b, a] = bgColor.toColorTypeLossy<SRGBA<uint8_t>>().resolved();
     RefPtr<RQRef> widgetRef = RQRef::create(
-        env->CallObjectMethod(jobject(*jRenderTheme), mid,
+        JNI_UPCALL(env->CallObjectMethod(jobject(*jRenderTheme), mid,
             ptr_to_jlong(&object),
             (jint)widgetIndex,
             (jint)state,
@@ -201,7 +201,7 @@ bool RenderThemeJava::paintWidget(
                 ? nullptr
                 : env->NewDirectByteBuffer(
                     const_cast<jbyte*>(extParams.span().data()),
-                    extParams.size())))
+                    extParams.size()))))
         );
     if (!widgetRef.get()) {
         //switch to WebKit default render
@@ -278,7 +278,7 @@ void RenderThemeJava::setRadioSize(RenderStyle& style) const
     static jmethodID mid = env->GetMethodID(PG_GetRenderThemeClass(env), "getRadioButtonSize", "()I");
     ASSERT(mid);
 
-    int radioSize = env->CallIntMethod((jobject)PG_GetRenderThemeObjectFromPage(env, nullptr), mid);
+    int radioSize = JNI_UPCALL(env->CallIntMethod((jobject)PG_GetRenderThemeObjectFromPage(env, nullptr), mid));
 
     WTF::CheckAndClearException(env);
 
@@ -376,7 +376,7 @@ void getSliderThumbSize(jint sliderType, int *width, int *height)
     jmethodID mid = env->GetStaticMethodID(cls, "fwkGetSliderThumbSize", "(I)I");
     ASSERT(mid);
 
-    jint size = env->CallStaticIntMethod(cls, mid, sliderType);
+    jint size = JNI_UPCALL(env->CallStaticIntMethod(cls, mid, sliderType));
     WTF::CheckAndClearException(env);
     *width = (size >> 16) & 0xFFFF;
     *height = size & 0xFFFF;
@@ -449,7 +449,7 @@ Color RenderThemeJava::getSelectionColor(int index) const
     ASSERT(mid);
 
     // Get from default theme object.
-    uint32_t color = env->CallIntMethod((jobject)PG_GetRenderThemeObjectFromPage(env, nullptr), mid, index);
+    uint32_t color = JNI_UPCALL(env->CallIntMethod((jobject)PG_GetRenderThemeObjectFromPage(env, nullptr), mid, index));
     WTF::CheckAndClearException(env);
 
     return SRGBA<uint8_t> { static_cast<uint8_t>(color >> 16), static_cast<uint8_t>(color >> 8),
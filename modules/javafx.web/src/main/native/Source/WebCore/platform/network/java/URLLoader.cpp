@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -142,7 +142,7 @@ void URLLoader::cancel()
         JNIEnv* env = WTF::GetJavaEnv();
         initRefs(env);
 
-        env->CallVoidMethod(m_ref, cancelMethod);
+        JNI_UPCALL(env->CallVoidMethod(m_ref, cancelMethod));
         WTF::CheckAndClearException(env);
 
         m_ref.clear();
@@ -193,7 +193,7 @@ JLObject URLLoader::load(bool asynchronous,
     JNIEnv* env = WTF::GetJavaEnv();
     initRefs(env);
 
-    JLObject loader = env->CallStaticObjectMethod(
+    JLObject loader = JNI_UPCALL(env->CallStaticObjectMethod(
             networkContextClass,
             loadMethod,
             (jobject) webPage,
@@ -202,7 +202,7 @@ JLObject URLLoader::load(bool asynchronous,
             (jstring) request.httpMethod().toJavaString(env),
             (jstring) headerString.toJavaString(env),
             (jobjectArray) toJava(request.httpBody().get()),
-            ptr_to_jlong(target));
+            ptr_to_jlong(target)));
     WTF::CheckAndClearException(env);
 
     return loader;
@@ -238,22 +238,22 @@ JLObjectArray URLLoader::toJava(const FormData* formData)
                         (jsize) 0,
                         (jsize) data.size(),
                         (const jbyte*) data.span().data());
-                resultElement = env->CallStaticObjectMethod(
+                resultElement = JNI_UPCALL(env->CallStaticObjectMethod(
                         formDataElementClass,
                         createFromByteArrayMethod,
-                        (jbyteArray) byteArray);
+                        (jbyteArray) byteArray));
             },
             [&] (const FormDataElement::EncodedFileData& data) -> void {
-                resultElement = env->CallStaticObjectMethod(
+                resultElement = JNI_UPCALL(env->CallStaticObjectMethod(
                         formDataElementClass,
                         createFromFileMethod,
-                        (jstring) data.filename.toJavaString(env));
+                        (jstring) data.filename.toJavaString(env)));
             },
             [&] (const FormDataElement::EncodedBlobData& data) -> void {
-                resultElement = env->CallStaticObjectMethod(
+                resultElement = JNI_UPCALL(env->CallStaticObjectMethod(
                         formDataElementClass,
                         createFromFileMethod,
-                        (jstring) data.url.string().toJavaString(env));
+                        (jstring) data.url.string().toJavaString(env)));
             }
         );
         env->SetObjectArrayElement(
@@ -448,6 +448,7 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_network_URLLoaderBase_twkDidSendData
   (JNIEnv*, jclass, jlong totalBytesSent, jlong totalBytesToBeSent, jlong data)
 {
     using namespace WebCore;
+    JAVA_TRACE_SCOPE("URLLoader::didSendData");
     URLLoader::Target* target =
             static_cast<URLLoader::Target*>(jlong_to_ptr(data));
     ASSERT(target);
@@ -460,6 +461,7 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_network_URLLoaderBase_twkWillSendRequ
    jstring headers, jstring url, jlong data)
 {
     using namespace WebCore;
+    JAVA_TRACE_SCOPE("URLLoader::willSendRequest");
     URLLoader::Target* target =
             static_cast<URLLoader::Target*>(jlong_to_ptr(data));
     ASSERT(target);
@@ -482,6 +484,7 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_network_URLLoaderBase_twkDidReceiveRe
    jstring url, jlong data)
 {
     using namespace WebCore;
+    JAVA_TRACE_SCOPE("URLLoader::didReceiveResponse");
     URLLoader::Target* target =
             static_cast<URLLoader::Target*>(jlong_to_ptr(data));
     ASSERT(target);
@@ -503,6 +506,7 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_network_URLLoaderBase_twkDidReceiveDa
    jlong data)
 {
     using namespace WebCore;
+    JAVA_TRACE_SCOPE("URLLoader::didReceiveData");
     URLLoader::Target* target =
             static_cast<URLLoader::Target*>(jlong_to_ptr(data));
     ASSERT(target);
@@ -517,6 +521,7 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_network_URLLoaderBase_twkDidFinishLoa
   (JNIEnv*, jclass, jlong data)
 {
     using namespace WebCore;
+    JAVA_TRACE_SCOPE("URLLoader::didFinishLoading");
     URLLoader::Target* target =
             static_cast<URLLoader::Target*>(jlong_to_ptr(data));
     ASSERT(target);
@@ -528,6 +533,7 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_network_URLLoaderBase_twkDidFail
    jlong data)
 {
     using namespace WebCore;
+    JAVA_TRACE_SCOPE("URLLoader::didFail");
     URLLoader::Target* target =
             static_cast<URLLoader::Target*>(jlong_to_ptr(data));
     ASSERT(target);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -224,6 +224,7 @@ static void drawDebugBorder(GraphicsContext& context,
 }
 
 void WebPage::prePaint() {
+    JAVA_TRACE_SCOPE("WebPage::prePaint");
     if (m_rootLayer) {
         if (m_syncLayers) {
             m_syncLayers = false;
@@ -252,6 +253,7 @@ RefPtr<RQRef> WebPage::jRenderTheme()
 
 void WebPage::paint(jobject rq, jint x, jint y, jint w, jint h)
 {
+    JAVA_TRACE_SCOPE("WebPage::paint");
     if (m_rootLayer) {
         return;
     }
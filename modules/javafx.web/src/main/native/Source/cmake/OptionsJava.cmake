@@ -10,6 +10,8 @@ SET_AND_EXPOSE_TO_BUILD(USE_TEXTURE_MAPPER ON)
 SET_AND_EXPOSE_TO_BUILD(USE_NPOBJECT OFF)
 SET_AND_EXPOSE_TO_BUILD(ENABLE_JAVA_BRIDGE ON)
 SET_AND_EXPOSE_TO_BUILD(ENABLE_JAVA_JSC ON)
+option(ENABLE_JAVA_JNI_ACCOUNTING "Count and time JNI upcalls, and count exceptions, per call site" OFF)
+SET_AND_EXPOSE_TO_BUILD(ENABLE_JAVA_JNI_ACCOUNTING ${ENABLE_JAVA_JNI_ACCOUNTING})
 if (ICU_UNICODE)
     SET_AND_EXPOSE_TO_BUILD(USE_ICU_UNICODE TRUE)
 else ()
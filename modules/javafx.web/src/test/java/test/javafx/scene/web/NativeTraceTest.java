@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.javafx.scene.web;
+
+import com.sun.webkit.WebPage;
+import com.sun.webkit.WebPageShim;
+import com.sun.webkit.perf.NativeTrace;
+import java.nio.ByteBuffer;
+import java.nio.charset.StandardCharsets;
+import java.util.HashMap;
+import java.util.Map;
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+import javafx.scene.web.WebEngineShim;
+import org.junit.jupiter.api.AfterEach;
+import org.junit.jupiter.api.Test;
+import static org.junit.jupiter.api.Assertions.assertEquals;
+import static org.junit.jupiter.api.Assertions.assertFalse;
+import static org.junit.jupiter.api.Assertions.assertNotNull;
+import static org.junit.jupiter.api.Assertions.assertTrue;
+
+public class NativeTraceTest extends TestBase {
+
+    private static final Pattern EVENT = Pattern.compile(
+            "\\{\"name\":\"([^\"]*)\",\"ph\":\"([BE])\",\"pid\":1,\"tid\":(\\d+),\"ts\":[0-9.]+\\}");
+
+    @AfterEach
+    public void disableTrace() {
+        NativeTrace.setEnabled(false);
+        NativeTrace.clear();
+    }
+
+    private static String export() {
+        ByteBuffer buffer = ByteBuffer.allocateDirect(1 << 20);
+        int size = NativeTrace.copyTo(buffer);
+        assertTrue(size > 0 && size <= buffer.capacity(), "Trace size " + size);
+        byte[] json = new byte[size];
+        buffer.get(json);
+        return new String(json, StandardCharsets.UTF_8);
+    }
+
+    /**
+     * Loads and paints a page with tracing on, and checks that the exported
+     * trace holds the paints as begin and end pairs on each thread.
+     */
+    @Test public void testPaintEventsArePaired() {
+        NativeTrace.clear();
+        NativeTrace.setEnabled(true);
+        assertTrue(NativeTrace.isEnabled());
+        loadContent("<html><body><p>paint</p></body></html>");
+        String json = submit(() -> {
+            WebPage webPage = WebEngineShim.getPage(getEngine());
+            assertNotNull(webPage);
+            for (int i = 0; i < 3; i++) {
+                assertNotNull(WebPageShim.paint(webPage, 0, 0, 800, 600));
+            }
+            NativeTrace.setEnabled(false);
+            return export();
+        });
+
+        assertTrue(json.startsWith("{\"traceEvents\":["), json);
+        assertTrue(json.endsWith("],\"displayTimeUnit\":\"ns\"}\n"), json);
+        Map<String, Integer> depths = new HashMap<>();
+        int paints = 0;
+        Matcher matcher = EVENT.matcher(json);
+        while (matcher.find()) {
+            if (!matcher.group(1).equals("WebPage::paint")) {
+                continue;
+            }
+            String tid = matcher.group(3);
+            int depth = depths.getOrDefault(tid, 0) + (matcher.group(2).equals("B") ? 1 : -1);
+            assertTrue(depth >= 0, "End without begin on thread " + tid);
+            depths.put(tid, depth);
+            if (depth == 0) {
+                paints++;
+            }
+        }
+        assertTrue(paints >= 3, "Paints traced: " + paints);
+        depths.forEach((tid, depth) ->
+                assertEquals(0, depth, "Begin without end on thread " + tid));
+    }
+
+    @Test public void testClearDropsEvents() {
+        NativeTrace.setEnabled(true);
+        loadContent("<html><body><p>paint</p></body></html>");
+        String json = submit(() -> {
+            WebPageShim.paint(WebEngineShim.getPage(getEngine()), 0, 0, 800, 600);
+            NativeTrace.setEnabled(false);
+            NativeTrace.clear();
+            return export();
+        });
+        assertFalse(json.contains("\"WebPage::paint\""), json);
+    }
+}
@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package decora;
+
+import com.sun.scenario.effect.impl.sw.sse.SSERendererDelegate;
+import java.util.Arrays;
+import java.util.LinkedHashMap;
+import java.util.Map;
+import java.util.Random;
+import java.util.concurrent.CountDownLatch;
+import java.util.function.Supplier;
+import javafx.application.Platform;
+import javafx.scene.effect.Blend;
+import javafx.scene.effect.BlendMode;
+import javafx.scene.effect.ColorAdjust;
+import javafx.scene.effect.DisplacementMap;
+import javafx.scene.effect.Effect;
+import javafx.scene.effect.FloatMap;
+import javafx.scene.effect.ImageInput;
+import javafx.scene.effect.Lighting;
+import javafx.scene.effect.PerspectiveTransform;
+import javafx.scene.effect.SepiaTone;
+import javafx.scene.image.ImageView;
+import javafx.scene.image.PixelWriter;
+import javafx.scene.image.WritableImage;
+
+/**
+ * Measures the time the software pipeline takes to apply each of the
+ * effects with generated Decora SSE peers to a large image, for each
+ * width of their vector loops the processor supports.
+ *
+ * Usage:
+ *   java -Dprism.order=sw [-Ddecora.sse.threads=N]
+ *        --add-exports javafx.graphics/com.sun.scenario.effect.impl.sw.sse=ALL-UNNAMED
+ *        decora.DecoraSSEBenchmark [size] [runs]
+ *
+ * decora.sse.threads sets how many threads the peers split the rows
+ * across, 1 for the calling thread only.
+ */
+public class DecoraSSEBenchmark {
+
+    private static WritableImage createImage(int size, long seed) {
+        Random random = new Random(seed);
+        WritableImage image = new WritableImage(size, size);
+        PixelWriter pw = image.getPixelWriter();
+        for (int y = 0; y < size; y++) {
+            for (int x = 0; x < size; x++) {
+                int a = (x + y) % 3 == 0 ? 0xff : random.nextInt(256);
+                int r = x * 255 / size;
+                int g = y * 255 / size;
+                int b = random.nextInt(256);
+                pw.setArgb(x, y, (a << 24) | (r << 16) | (g << 8) | b);
+            }
+        }
+        return image;
+    }
+
+    private static Map<String, Supplier<Effect>> createEffects(WritableImage bot, WritableImage top) {
+        int size = (int) bot.getWidth();
+        Map<String, Supplier<Effect>> effects = new LinkedHashMap<>();
+        effects.put("ColorAdjust", () -> new ColorAdjust(0.3, 0.4, -0.2, 0.5));
+        effects.put("SepiaTone", () -> new SepiaTone(0.8));
+        for (BlendMode mode : new BlendMode[] {
+                BlendMode.MULTIPLY, BlendMode.OVERLAY, BlendMode.COLOR_BURN, BlendMode.SOFT_LIGHT }) {
+            effects.put("Blend " + mode, () -> {
+                Blend blend = new Blend(mode, new ImageInput(bot), new ImageInput(top));
+                blend.setOpacity(0.8);
+                return blend;
+            });
+        }
+        effects.put("PerspectiveTransform", () -> new PerspectiveTransform(
+                size * 0.1, size * 0.05, size * 0.9, 0,
+                size, size, 0, size * 0.95));
+        effects.put("DisplacementMap", () -> {
+            FloatMap map = new FloatMap(size / 4, size / 4);
+            for (int y = 0; y < map.getHeight(); y++) {
+                for (int x = 0; x < map.getWidth(); x++) {
+                    map.setSamples(x, y, (float) Math.sin(y / 8.0) * 0.02f, (float) Math.cos(x / 8.0) * 0.02f);
+                }
+            }
+            return new DisplacementMap(map);
+        });
+        effects.put("Lighting", Lighting::new);
+        return effects;
+    }
+
+    private static double medianMillis(ImageView view, int runs) {
+        long[] times = new long[runs];
+        // warm up
+        view.snapshot(null, null);
+        for (int i = 0; i < runs; i++) {
+            long start = System.nanoTime();
+            view.snapshot(null, null);
+            times[i] = System.nanoTime() - start;
+        }
+        Arrays.sort(times);
+        return times[runs / 2] / 1e6;
+    }
+
+    public static void main(String[] args) throws Exception {
+        int size = args.length > 0 ? Integer.parseInt(args[0]) : 1024;
+        int runs = args.length > 1 ? Integer.parseInt(args[1]) : 20;
+
+        CountDownLatch startupLatch = new CountDownLatch(1);
+        Platform.startup(startupLatch::countDown);
+        startupLatch.await();
+
+        CountDownLatch doneLatch = new CountDownLatch(1);
+        Platform.runLater(() -> {
+            try {
+                WritableImage bot = createImage(size, 1);
+                WritableImage top = createImage(size, 2);
+                int maxLanes = SSERendererDelegate.setVectorLanes(8);
+                System.out.printf("%-22s", "effect \\ lanes");
+                for (int lanes = 1; lanes <= maxLanes; lanes *= 2) {
+                    if (lanes != 2) {
+                        System.out.printf(" %10s", lanes + " (ms)");
+                    }
+                }
+                System.out.println();
+                for (Map.Entry<String, Supplier<Effect>> e : createEffects(bot, top).entrySet()) {
+                    ImageView view = new ImageView(bot);
+                    view.setEffect(e.getValue().get());
+                    System.out.printf("%-22s", e.getKey());
+                    for (int lanes = 1; lanes <= maxLanes; lanes *= 2) {
+                        if (lanes != 2) {
+                            SSERendererDelegate.setVectorLanes(lanes);
+                            System.out.printf(" %10.1f", medianMillis(view, runs));
+                        }
+                    }
+                    System.out.println();
+                }
+                SSERendererDelegate.setVectorLanes(maxLanes);
+            } finally {
+                doneLatch.countDown();
+            }
+        });
+        doneLatch.await();
+
+        Platform.exit();
+    }
+}
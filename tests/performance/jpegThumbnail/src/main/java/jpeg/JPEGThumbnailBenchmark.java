@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package jpeg;
+
+import java.awt.image.BufferedImage;
+import java.io.ByteArrayInputStream;
+import java.io.ByteArrayOutputStream;
+import java.io.IOException;
+import java.lang.management.ManagementFactory;
+import java.lang.management.MemoryPoolMXBean;
+import java.lang.management.MemoryType;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.Arrays;
+import java.util.concurrent.CountDownLatch;
+import javafx.application.Platform;
+import javafx.scene.image.Image;
+import javax.imageio.ImageIO;
+
+/**
+ * Measures the time and the peak heap use of loading a large JPEG at
+ * thumbnail sizes, against loading it at full size.
+ *
+ * Usage: JPEGThumbnailBenchmark [image.jpg] [runs]
+ *
+ * Without an image, a 6000x4000 (24 MP) JPEG is generated.
+ */
+public class JPEGThumbnailBenchmark {
+
+    private static final int[][] SIZES = {
+        { 0, 0 }, { 1920, 1080 }, { 800, 600 }, { 320, 240 }, { 160, 120 }, { 64, 64 }
+    };
+
+    private static byte[] createImage() throws IOException {
+        int width = 6000;
+        int height = 4000;
+        BufferedImage image = new BufferedImage(width, height, BufferedImage.TYPE_INT_RGB);
+        for (int y = 0; y < height; y++) {
+            for (int x = 0; x < width; x++) {
+                int r = x * 255 / width;
+                int g = y * 255 / height;
+                int b = (((x / 50) ^ (y / 50)) & 1) != 0 ? 200 : 40;
+                image.setRGB(x, y, (r << 16) | (g << 8) | b);
+            }
+        }
+        ByteArrayOutputStream out = new ByteArrayOutputStream();
+        ImageIO.write(image, "jpeg", out);
+        return out.toByteArray();
+    }
+
+    private static long peakHeapUsed() {
+        long peak = 0;
+        for (MemoryPoolMXBean pool : ManagementFactory.getMemoryPoolMXBeans()) {
+            if (pool.getType() == MemoryType.HEAP) {
+                peak += pool.getPeakUsage().getUsed();
+            }
+        }
+        return peak;
+    }
+
+    private static void resetPeakHeapUsed() {
+        System.gc();
+        for (MemoryPoolMXBean pool : ManagementFactory.getMemoryPoolMXBeans()) {
+            if (pool.getType() == MemoryType.HEAP) {
+                pool.resetPeakUsage();
+            }
+        }
+    }
+
+    public static void main(String[] args) throws Exception {
+        byte[] jpeg = args.length > 0 ? Files.readAllBytes(Path.of(args[0])) : createImage();
+        int runs = args.length > 1 ? Integer.parseInt(args[1]) : 10;
+
+        CountDownLatch startupLatch = new CountDownLatch(1);
+        Platform.startup(startupLatch::countDown);
+        startupLatch.await();
+
+        System.out.printf("%12s %12s %12s %14s%n", "requested", "loaded", "median ms", "peak heap MB");
+        for (int[] size : SIZES) {
+            long[] times = new long[runs];
+            long peak = 0;
+            Image image = null;
+            for (int i = 0; i < runs; i++) {
+                resetPeakHeapUsed();
+                long baseline = peakHeapUsed();
+                long start = System.nanoTime();
+                image = new Image(new ByteArrayInputStream(jpeg), size[0], size[1], true, true);
+                times[i] = System.nanoTime() - start;
+                peak = Math.max(peak, peakHeapUsed() - baseline);
+                if (image.isError()) {
+                    throw new IOException("Loading failed", image.getException());
+                }
+            }
+            Arrays.sort(times);
+            System.out.printf("%12s %12s %12.1f %14.1f%n",
+                    size[0] == 0 ? "full" : size[0] + "x" + size[1],
+                    (int) image.getWidth() + "x" + (int) image.getHeight(),
+                    times[runs / 2] / 1e6, peak / (1024.0 * 1024.0));
+        }
+
+        Platform.exit();
+    }
+}
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.com.sun.glass.ui.gtk;
+
+import static org.junit.jupiter.api.Assertions.assertEquals;
+import static org.junit.jupiter.api.Assertions.assertTrue;
+import static org.junit.jupiter.api.Assumptions.assumeTrue;
+import com.sun.glass.ui.Application;
+import com.sun.glass.ui.gtk.GtkTimerShim;
+import com.sun.javafx.PlatformUtil;
+import com.sun.javafx.tk.Toolkit;
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.TimeUnit;
+import javafx.animation.AnimationTimer;
+import org.junit.jupiter.api.AfterAll;
+import org.junit.jupiter.api.BeforeAll;
+import org.junit.jupiter.api.Test;
+import test.util.Util;
+
+/**
+ * Checks the jitter statistics of the GTK pulse timer: the ticks come at
+ * the exact refresh rate, not at a period rounded to whole milliseconds,
+ * and are on time on average.
+ */
+public class GtkTimerTest {
+
+    private static final long RUN_NANOS = TimeUnit.SECONDS.toNanos(2);
+
+    // Generous, for loaded test machines
+    private static final long MAX_MEAN_LATENESS_NANOS = TimeUnit.MILLISECONDS.toNanos(4);
+
+    @BeforeAll
+    public static void setupOnce() {
+        CountDownLatch startupLatch = new CountDownLatch(1);
+        Util.startup(startupLatch, startupLatch::countDown);
+    }
+
+    @AfterAll
+    public static void teardownOnce() {
+        Util.shutdown();
+    }
+
+    @Test
+    public void testPulseRateAndLateness() throws Exception {
+        assumeTrue(PlatformUtil.isLinux());
+        String[] application = new String[1];
+        Util.runAndWait(() -> application[0] = Application.GetApplication().getClass().getSimpleName());
+        assumeTrue("GtkApplication".equals(application[0]), "Not running on GTK");
+
+        // Keep pulses coming while the timer is measured
+        AnimationTimer animation = new AnimationTimer() {
+            @Override
+            public void handle(long now) {
+            }
+        };
+        Util.runAndWait(animation::start);
+        Util.sleep(200);
+
+        try {
+            long[] before = GtkTimerShim.getStatistics();
+            long start = System.nanoTime();
+            Util.sleep(TimeUnit.NANOSECONDS.toMillis(RUN_NANOS));
+            long[] after = GtkTimerShim.getStatistics();
+            long elapsed = System.nanoTime() - start;
+
+            // Ticks and skipped ticks together follow the deadlines; at 60 Hz
+            // a 16 ms period would add 5 ticks over two seconds
+            long periodNanos = TimeUnit.SECONDS.toNanos(1) / Toolkit.getToolkit().getRefreshRate();
+            long expected = elapsed / periodNanos;
+            long deadlines = (after[0] - before[0]) + (after[1] - before[1]);
+            assertEquals((double) expected, (double) deadlines, 2.0, "Ticks in " + elapsed + " ns");
+
+            long mean = (after[2] * after[0] - before[2] * before[0]) / Math.max(1, after[0] - before[0]);
+            assertTrue(mean < MAX_MEAN_LATENESS_NANOS, "Mean lateness " + mean + " ns");
+        } finally {
+            Util.runAndWait(animation::stop);
+        }
+    }
+}
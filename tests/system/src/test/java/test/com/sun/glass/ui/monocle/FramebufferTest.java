@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2014, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2014, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,7 +25,10 @@
 
 package test.com.sun.glass.ui.monocle;
 
+import static org.junit.jupiter.api.Assertions.assertEquals;
 import java.nio.ByteBuffer;
+import java.nio.IntBuffer;
+import java.util.Arrays;
 import org.junit.jupiter.api.Test;
 import com.sun.glass.ui.monocle.FramebufferShim;
 
@@ -67,4 +70,74 @@ public class FramebufferTest {
         windowBuffer.clear();
     }
 
+    private static ByteBuffer window(int width, int height, int pixel) {
+        ByteBuffer buffer = ByteBuffer.allocate(width * height * 4);
+        int[] pixels = new int[width * height];
+        Arrays.fill(pixels, pixel);
+        buffer.asIntBuffer().put(pixels);
+        return buffer;
+    }
+
+    private static void frame(FramebufferShim fb, int y) {
+        fb.reset();
+        fb.composePixels(window(10, 10, 0xff00ff00), 20, y, 10, 10, 1f);
+    }
+
+    @Test
+    public void testClearOnlyComposedRows() {
+        ByteBuffer screenBuffer = ByteBuffer.allocate(100 * 100 * 4);
+        IntBuffer screen = screenBuffer.asIntBuffer();
+        FramebufferShim fb = new FramebufferShim(screenBuffer, 100, 100, 32, true);
+        // nothing is known about the buffer before the first frame
+        frame(fb, 20);
+        assertEquals(0, fb.getDirtyTop());
+        assertEquals(100, fb.getDirtyBottom());
+        fb.clearDirtyRows();
+
+        // the window moves from rows 20-29 to rows 50-59
+        frame(fb, 50);
+        assertEquals(20, fb.getDirtyTop());
+        assertEquals(60, fb.getDirtyBottom());
+        assertEquals(0, screen.get(25 * 100 + 25));
+        assertEquals(0xff00ff00, screen.get(55 * 100 + 25));
+        fb.clearDirtyRows();
+
+        // the window stays put
+        frame(fb, 50);
+        assertEquals(50, fb.getDirtyTop());
+        assertEquals(60, fb.getDirtyBottom());
+    }
+
+    @Test
+    public void testClearRowsOfEachPage() {
+        ByteBuffer screenBuffer = ByteBuffer.allocate(2 * 100 * 100 * 4);
+        IntBuffer screen = screenBuffer.asIntBuffer();
+        FramebufferShim fb = new FramebufferShim(screenBuffer, 100, 100, 32, true);
+        int page = 100 * 100 * 4;
+        frame(fb, 10);
+        fb.setStartAddress(page);
+        frame(fb, 40);
+        fb.setStartAddress(0);
+        // the first page still shows the window at rows 10-19
+        frame(fb, 70);
+        assertEquals(0, screen.get(15 * 100 + 25));
+        assertEquals(0xff00ff00, screen.get(75 * 100 + 25));
+        assertEquals(0xff00ff00, screen.get(page / 4 + 45 * 100 + 25));
+    }
+
+    @Test
+    public void testNearlyOpaqueAlpha() {
+        int translucent = 0x80402010;
+        int[] results = new int[2];
+        float[] alphas = { 1f, 255f / 256f };
+        for (int i = 0; i < alphas.length; i++) {
+            ByteBuffer screenBuffer = ByteBuffer.allocate(10 * 10 * 4);
+            FramebufferShim fb = new FramebufferShim(screenBuffer, 10, 10, 32, false);
+            fb.reset();
+            fb.composePixels(window(10, 10, 0xff808080), 0, 0, 10, 10, 1f);
+            fb.composePixels(window(10, 10, translucent), 0, 0, 10, 10, alphas[i]);
+            results[i] = screenBuffer.asIntBuffer().get(0);
+        }
+        assertEquals(results[0], results[1]);
+    }
 }
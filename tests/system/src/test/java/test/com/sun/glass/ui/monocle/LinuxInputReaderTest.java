@@ -0,0 +1,254 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.com.sun.glass.ui.monocle;
+
+import static org.junit.jupiter.api.Assertions.assertArrayEquals;
+import static org.junit.jupiter.api.Assertions.assertEquals;
+import static org.junit.jupiter.api.Assertions.assertNotEquals;
+import static org.junit.jupiter.api.Assertions.assertTrue;
+import static org.junit.jupiter.api.Assumptions.assumeTrue;
+import java.io.FileOutputStream;
+import java.io.IOException;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.concurrent.TimeUnit;
+import java.util.stream.IntStream;
+import org.junit.jupiter.api.AfterEach;
+import org.junit.jupiter.api.BeforeAll;
+import org.junit.jupiter.api.BeforeEach;
+import org.junit.jupiter.api.Test;
+import org.junit.jupiter.api.Timeout;
+import org.junit.jupiter.api.Timeout.ThreadMode;
+import com.sun.glass.ui.monocle.LinuxInputReaderShim;
+import com.sun.glass.ui.monocle.LinuxInputShim;
+import com.sun.glass.ui.monocle.LinuxSystemShim;
+import com.sun.javafx.PlatformUtil;
+
+/**
+ * Feeds input_event structures through a FIFO to the native reader behind
+ * LinuxInputReader and checks the frames it writes out. Each frame is
+ * flattened to the device id, the event count and then the type, code and
+ * value of each event. A read waits until input arrives, so the tests time
+ * out on a separate thread instead of blocking when input is lost.
+ */
+@Timeout(value = 15000, unit = TimeUnit.MILLISECONDS, threadMode = ThreadMode.SEPARATE_THREAD)
+public class LinuxInputReaderTest {
+
+    private static final int ID = 7;
+    /** The size of struct input_event: a struct timeval, two shorts and an int */
+    private static final int INPUT_EVENT_SIZE =
+            "64".equals(System.getProperty("sun.arch.data.model")) ? 24 : 16;
+    private static final int FRAME_HEADER_SIZE = 8;
+    private static final int EVENT_SIZE = 8;
+    /** The room the native reader keeps free to report removed devices */
+    private static final int REMOVAL_RESERVE = 16 * FRAME_HEADER_SIZE;
+
+    private static final int EV_SYN = LinuxInputShim.EV_SYN;
+    private static final int EV_KEY = LinuxInputShim.EV_KEY;
+    private static final int EV_REL = LinuxInputShim.EV_REL;
+    private static final int EV_ABS = LinuxInputShim.EV_ABS;
+    private static final int SYN_REPORT = LinuxInputShim.SYN_REPORT;
+    private static final int SYN_DROPPED = LinuxInputShim.SYN_DROPPED;
+    private static final int BTN_LEFT = LinuxInputShim.BTN_LEFT;
+    private static final int REL_X = LinuxInputShim.REL_X;
+    private static final int REL_Y = LinuxInputShim.REL_Y;
+    private static final int ABS_X = LinuxInputShim.ABS_X;
+    private static final int ABS_MT_SLOT = LinuxInputShim.ABS_MT_SLOT;
+
+    private Path dir;
+    private long fd = -1l;
+    private FileOutputStream device;
+    private long reader;
+
+    @BeforeAll
+    public static void loadLibrary() {
+        assumeTrue(PlatformUtil.isLinux());
+        try {
+            LinuxSystemShim.loadLibrary();
+        } catch (UnsatisfiedLinkError e) {
+            assumeTrue(false, "The Monocle native library is not available");
+        }
+    }
+
+    @BeforeEach
+    public void setUp() throws IOException {
+        dir = Files.createTempDirectory("LinuxInputReaderTest");
+        String path = dir.resolve("event").toString();
+        assertEquals(0, LinuxSystemShim.mkfifo(path, LinuxSystemShim.S_IRWXU));
+        // Opened without a writer, so that closing the writer ends the input
+        fd = LinuxSystemShim.open(path, LinuxSystemShim.O_RDONLY | LinuxSystemShim.O_NONBLOCK);
+        assertNotEquals(-1l, fd);
+        device = new FileOutputStream(path);
+        reader = LinuxInputReaderShim.open();
+        assertNotEquals(0l, reader);
+        assertTrue(LinuxInputReaderShim.addDevice(reader, fd, ID));
+    }
+
+    @AfterEach
+    public void tearDown() throws IOException {
+        if (device != null) {
+            device.close();
+        }
+        if (fd != -1l) {
+            LinuxSystemShim.close(fd);
+        }
+        if (dir != null) {
+            Files.deleteIfExists(dir.resolve("event"));
+            Files.delete(dir);
+        }
+    }
+
+    /** Writes events given as triples of type, code and value */
+    private void write(int... events) throws IOException {
+        ByteBuffer buffer = ByteBuffer.allocate(events.length / 3 * INPUT_EVENT_SIZE);
+        buffer.order(ByteOrder.nativeOrder());
+        for (int i = 0; i < events.length; i += 3) {
+            buffer.position(i / 3 * INPUT_EVENT_SIZE + INPUT_EVENT_SIZE - 8);
+            buffer.putShort((short) events[i]);
+            buffer.putShort((short) events[i + 1]);
+            buffer.putInt(events[i + 2]);
+        }
+        device.write(buffer.array());
+    }
+
+    private int[] read(int capacity) {
+        ByteBuffer batch = ByteBuffer.allocateDirect(capacity);
+        batch.order(ByteOrder.nativeOrder());
+        int bytes = LinuxInputReaderShim.read(reader, batch);
+        assertTrue(bytes >= 0, "Read failed");
+        batch.limit(bytes);
+        IntStream.Builder values = IntStream.builder();
+        while (batch.hasRemaining()) {
+            values.add(batch.getInt());
+            int count = batch.getInt();
+            values.add(count);
+            for (int i = 0; i < count; i++) {
+                values.add(batch.getShort());
+                values.add(batch.getShort());
+                values.add(batch.getInt());
+            }
+        }
+        return values.build().toArray();
+    }
+
+    private int[] read() {
+        return read(64 * 1024);
+    }
+
+    /** The size of a buffer with room for the given number of frames */
+    private static int capacity(int frames, int eventsPerFrame) {
+        return REMOVAL_RESERVE + frames * (FRAME_HEADER_SIZE + eventsPerFrame * EVENT_SIZE);
+    }
+
+    @Test
+    public void testRelativeMotionMerged() throws IOException {
+        write(EV_REL, REL_X, 1,
+              EV_REL, REL_X, 2,
+              EV_REL, REL_Y, 3,
+              EV_KEY, BTN_LEFT, 1,
+              EV_REL, REL_X, 4,
+              EV_SYN, SYN_REPORT, 0);
+        // motion after the button press is not merged with motion before it
+        assertArrayEquals(new int[] {
+                ID, 5,
+                EV_REL, REL_X, 3,
+                EV_REL, REL_Y, 3,
+                EV_KEY, BTN_LEFT, 1,
+                EV_REL, REL_X, 4,
+                EV_SYN, SYN_REPORT, 0 }, read());
+    }
+
+    @Test
+    public void testAbsolutePositionMerged() throws IOException {
+        write(EV_ABS, ABS_MT_SLOT, 0,
+              EV_ABS, ABS_X, 10,
+              EV_ABS, ABS_X, 20,
+              EV_ABS, ABS_MT_SLOT, 1,
+              EV_ABS, ABS_X, 30,
+              EV_ABS, ABS_X, 40,
+              EV_SYN, SYN_REPORT, 0);
+        // the last position wins within each slot
+        assertArrayEquals(new int[] {
+                ID, 5,
+                EV_ABS, ABS_MT_SLOT, 0,
+                EV_ABS, ABS_X, 20,
+                EV_ABS, ABS_MT_SLOT, 1,
+                EV_ABS, ABS_X, 40,
+                EV_SYN, SYN_REPORT, 0 }, read());
+    }
+
+    @Test
+    public void testDroppedFrames() throws IOException {
+        write(EV_REL, REL_X, 1,
+              EV_SYN, SYN_DROPPED, 0,
+              EV_REL, REL_X, 5,
+              EV_SYN, SYN_REPORT, 0,
+              EV_REL, REL_Y, 7,
+              EV_SYN, SYN_REPORT, 0);
+        // the frame cut short and the rest up to the next report are dropped
+        assertArrayEquals(new int[] {
+                ID, 2,
+                EV_REL, REL_Y, 7,
+                EV_SYN, SYN_REPORT, 0 }, read());
+    }
+
+    @Test
+    public void testBacklog() throws IOException {
+        for (int i = 1; i <= 5; i++) {
+            write(EV_REL, REL_X, i,
+                  EV_SYN, SYN_REPORT, 0);
+        }
+        int capacity = capacity(2, 2);
+        assertArrayEquals(new int[] {
+                ID, 2, EV_REL, REL_X, 1, EV_SYN, SYN_REPORT, 0,
+                ID, 2, EV_REL, REL_X, 2, EV_SYN, SYN_REPORT, 0 }, read(capacity));
+        // input arriving while frames are held back is read after them
+        write(EV_REL, REL_X, 6,
+              EV_SYN, SYN_REPORT, 0);
+        assertArrayEquals(new int[] {
+                ID, 2, EV_REL, REL_X, 3, EV_SYN, SYN_REPORT, 0,
+                ID, 2, EV_REL, REL_X, 4, EV_SYN, SYN_REPORT, 0 }, read(capacity));
+        assertArrayEquals(new int[] {
+                ID, 2, EV_REL, REL_X, 5, EV_SYN, SYN_REPORT, 0,
+                ID, 2, EV_REL, REL_X, 6, EV_SYN, SYN_REPORT, 0 }, read(capacity));
+    }
+
+    @Test
+    public void testRemoval() throws IOException {
+        write(EV_KEY, BTN_LEFT, 1,
+              EV_SYN, SYN_REPORT, 0);
+        device.close();
+        device = null;
+        assertArrayEquals(new int[] {
+                ID, 2,
+                EV_KEY, BTN_LEFT, 1,
+                EV_SYN, SYN_REPORT, 0 }, read());
+        assertArrayEquals(new int[] { ID, -1 }, read());
+    }
+
+}
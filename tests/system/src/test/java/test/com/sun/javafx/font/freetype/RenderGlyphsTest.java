@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.com.sun.javafx.font.freetype;
+
+import static org.junit.jupiter.api.Assertions.assertArrayEquals;
+import static org.junit.jupiter.api.Assertions.assertEquals;
+import static org.junit.jupiter.api.Assertions.assertNotNull;
+import static org.junit.jupiter.api.Assertions.assertTrue;
+import static org.junit.jupiter.api.Assumptions.assumeTrue;
+import com.sun.javafx.PlatformUtil;
+import com.sun.javafx.font.CompositeFontResource;
+import com.sun.javafx.font.FontResource;
+import com.sun.javafx.font.PrismFontFactory;
+import com.sun.javafx.font.freetype.OSFreetypeShim;
+import java.nio.ByteBuffer;
+import java.util.Arrays;
+import org.junit.jupiter.api.AfterAll;
+import org.junit.jupiter.api.BeforeAll;
+import org.junit.jupiter.api.Test;
+
+/**
+ * Checks that glyphs rendered in one batch by OSFreetype.renderGlyphs get
+ * the same metrics and bitmaps as glyphs rendered one at a time, and the
+ * same metrics as the glyph slot after FT_Load_Glyph.
+ */
+public class RenderGlyphsTest {
+
+    private static final int FLAGS = OSFreetypeShim.FT_LOAD_RENDER |
+                                     OSFreetypeShim.FT_LOAD_NO_HINTING |
+                                     OSFreetypeShim.FT_LOAD_NO_BITMAP |
+                                     OSFreetypeShim.FT_LOAD_IGNORE_TRANSFORM |
+                                     OSFreetypeShim.FT_LOAD_TARGET_NORMAL;
+    /* Sizes in 26.6 fixed point */
+    private static final long[] SIZES = { 12 * 64, 31 * 64 + 32, 72 * 64 };
+    private static final int METRICS = OSFreetypeShim.GLYPH_METRICS_SIZE;
+
+    private static long[] handles;
+    private static long face;
+    private static int[] codes;
+
+    @BeforeAll
+    public static void setupOnce() {
+        assumeTrue(PlatformUtil.isLinux());
+        FontResource resource = PrismFontFactory.getFontFactory()
+                .createFont("System Regular", 12f).getFontResource();
+        if (resource instanceof CompositeFontResource composite) {
+            resource = composite.getSlotResource(0);
+        }
+        handles = OSFreetypeShim.openFace(resource.getFileName());
+        assertNotNull(handles, "Cannot open " + resource.getFileName());
+        face = handles[1];
+        codes = new int['~' - ' ' + 1];
+        for (int i = 0; i < codes.length; i++) {
+            codes[i] = OSFreetypeShim.getCharIndex(face, ' ' + i);
+        }
+    }
+
+    @AfterAll
+    public static void teardownOnce() {
+        if (handles != null) {
+            OSFreetypeShim.closeFace(handles);
+        }
+    }
+
+    private static byte[] bitmap(ByteBuffer atlas, int[] metrics, int glyph) {
+        int m = glyph * METRICS;
+        byte[] bitmap = new byte[metrics[m + OSFreetypeShim.GLYPH_WIDTH] * metrics[m + OSFreetypeShim.GLYPH_ROWS]];
+        atlas.get(metrics[m + OSFreetypeShim.GLYPH_OFFSET], bitmap);
+        return bitmap;
+    }
+
+    private static int[] withoutOffset(int[] metrics, int glyph) {
+        return Arrays.copyOfRange(metrics, glyph * METRICS, glyph * METRICS + OSFreetypeShim.GLYPH_OFFSET);
+    }
+
+    @Test
+    public void testBatchMatchesSingleGlyphs() {
+        ByteBuffer atlas = ByteBuffer.allocateDirect(1 << 20);
+        ByteBuffer single = ByteBuffer.allocateDirect(1 << 16);
+        for (long size : SIZES) {
+            int[] metrics = new int[codes.length * METRICS];
+            assertEquals(codes.length, OSFreetypeShim.renderGlyphs(face, size, FLAGS, codes,
+                    codes.length, atlas, metrics));
+            for (int i = 0; i < codes.length; i++) {
+                String glyph = "'" + (char) (' ' + i) + "' at " + size / 64f;
+                int[] one = new int[METRICS];
+                assertEquals(1, OSFreetypeShim.renderGlyphs(face, size, FLAGS,
+                        new int[] { codes[i] }, 1, single, one));
+                assertArrayEquals(withoutOffset(one, 0), withoutOffset(metrics, i), glyph);
+                assertArrayEquals(bitmap(single, one, 0), bitmap(atlas, metrics, i), glyph);
+                assertArrayEquals(OSFreetypeShim.loadGlyph(face, size, codes[i], FLAGS),
+                        withoutOffset(metrics, i), glyph);
+            }
+        }
+    }
+
+    @Test
+    public void testBatchResumesAfterFullAtlas() {
+        long size = 36 * 64;
+        ByteBuffer full = ByteBuffer.allocateDirect(1 << 20);
+        int[] expected = new int[codes.length * METRICS];
+        assertEquals(codes.length, OSFreetypeShim.renderGlyphs(face, size, FLAGS, codes,
+                codes.length, full, expected));
+
+        ByteBuffer atlas = ByteBuffer.allocateDirect(3000);
+        int start = 0;
+        int calls = 0;
+        while (start < codes.length) {
+            int[] rest = Arrays.copyOfRange(codes, start, codes.length);
+            int[] metrics = new int[rest.length * METRICS];
+            int count = OSFreetypeShim.renderGlyphs(face, size, FLAGS, rest, rest.length, atlas, metrics);
+            assertTrue(count > 0, "No glyph fits an empty atlas");
+            for (int i = 0; i < count; i++) {
+                assertArrayEquals(withoutOffset(expected, start + i), withoutOffset(metrics, i));
+                assertArrayEquals(bitmap(full, expected, start + i), bitmap(atlas, metrics, i));
+            }
+            if (start + count < codes.length) {
+                // the glyph that did not fit still reports its size
+                assertArrayEquals(withoutOffset(expected, start + count), withoutOffset(metrics, count));
+            }
+            start += count;
+            calls++;
+        }
+        assertTrue(calls > 1, "The atlas never filled up");
+    }
+}
@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.com.sun.javafx.iio;
+
+import static org.junit.jupiter.api.Assertions.assertArrayEquals;
+import static org.junit.jupiter.api.Assertions.assertEquals;
+import static org.junit.jupiter.api.Assumptions.assumeTrue;
+import com.sun.javafx.iio.ImageFrame;
+import com.sun.javafx.iio.ImageStorage;
+import com.sun.javafx.iio.jpeg.JPEGImageLoaderShim;
+import java.awt.Color;
+import java.awt.Font;
+import java.awt.GradientPaint;
+import java.awt.Graphics2D;
+import java.awt.image.BufferedImage;
+import java.io.ByteArrayInputStream;
+import java.io.ByteArrayOutputStream;
+import java.io.IOException;
+import java.nio.ByteBuffer;
+import java.util.Random;
+import javax.imageio.IIOImage;
+import javax.imageio.ImageIO;
+import javax.imageio.ImageTypeSpecifier;
+import javax.imageio.ImageWriteParam;
+import javax.imageio.ImageWriter;
+import javax.imageio.metadata.IIOMetadata;
+import javax.imageio.stream.ImageOutputStream;
+import org.junit.jupiter.api.AfterEach;
+import org.junit.jupiter.api.BeforeAll;
+import org.junit.jupiter.api.Test;
+import org.w3c.dom.Element;
+import org.w3c.dom.Node;
+import org.w3c.dom.NodeList;
+
+/**
+ * Checks that the SSE2 IDCT and color conversion of the bundled libjpeg
+ * decode to the same pixels as its C code. The images are encoded like the
+ * IJG reference images: 227x149, baseline and progressive, with 2x2 chroma
+ * subsampling, plus full resolution chroma and grayscale variants.
+ * Images with 16-bit quantizers above 32767 must use the C IDCT.
+ */
+public class JPEGSSE2DecodeTest {
+
+    private static final String JPEG_METADATA_FORMAT = "javax_imageio_jpeg_image_1.0";
+    private static final int WIDTH = 227;
+    private static final int HEIGHT = 149;
+    private static final float[] QUALITIES = { 0.25f, 0.75f, 1.0f };
+
+    @BeforeAll
+    public static void setupOnce() {
+        assumeTrue(JPEGImageLoaderShim.setSSE2Enabled(true), "No SSE2 JPEG decoder on this platform");
+    }
+
+    @AfterEach
+    public void restoreSSE2() {
+        JPEGImageLoaderShim.setSSE2Enabled(true);
+    }
+
+    private static BufferedImage createImage(int type) {
+        BufferedImage image = new BufferedImage(WIDTH, HEIGHT, type);
+        Graphics2D g = image.createGraphics();
+        g.setPaint(new GradientPaint(0, 0, Color.ORANGE, WIDTH, HEIGHT, Color.BLUE));
+        g.fillRect(0, 0, WIDTH, HEIGHT);
+        g.setColor(Color.WHITE);
+        g.setFont(new Font(Font.SANS_SERIF, Font.BOLD, 40));
+        g.drawString("JavaFX", 20, HEIGHT / 2);
+        g.dispose();
+        // noise in one corner, for coefficients that saturate the output
+        Random random = new Random(38);
+        for (int y = 0; y < HEIGHT / 3; y++) {
+            for (int x = 0; x < WIDTH / 3; x++) {
+                image.setRGB(x, y, random.nextInt());
+            }
+        }
+        return image;
+    }
+
+    private static byte[] encode(BufferedImage image, float quality,
+                                 boolean progressive, boolean subsampled) throws IOException {
+        ImageWriter writer = ImageIO.getImageWritersByFormatName("jpeg").next();
+        try {
+            ImageWriteParam param = writer.getDefaultWriteParam();
+            param.setCompressionMode(ImageWriteParam.MODE_EXPLICIT);
+            param.setCompressionQuality(quality);
+            if (progressive) {
+                param.setProgressiveMode(ImageWriteParam.MODE_DEFAULT);
+            }
+            IIOMetadata metadata = writer.getDefaultImageMetadata(new ImageTypeSpecifier(image), param);
+            if (!subsampled) {
+                Node tree = metadata.getAsTree(JPEG_METADATA_FORMAT);
+                NodeList components = ((Element) tree).getElementsByTagName("componentSpec");
+                for (int i = 0; i < components.getLength(); i++) {
+                    Element component = (Element) components.item(i);
+                    component.setAttribute("HsamplingFactor", "1");
+                    component.setAttribute("VsamplingFactor", "1");
+                }
+                metadata.setFromTree(JPEG_METADATA_FORMAT, tree);
+            }
+            ByteArrayOutputStream out = new ByteArrayOutputStream();
+            try (ImageOutputStream ios = ImageIO.createImageOutputStream(out)) {
+                writer.setOutput(ios);
+                writer.write(null, new IIOImage(image, null, metadata), param);
+            }
+            return out.toByteArray();
+        } finally {
+            writer.dispose();
+        }
+    }
+
+    private static byte[] decode(byte[] jpeg, boolean sse2) throws IOException {
+        assertEquals(sse2, JPEGImageLoaderShim.setSSE2Enabled(sse2));
+        ImageFrame[] frames = ImageStorage.getInstance().loadAll(
+                new ByteArrayInputStream(jpeg), null, 0, 0, false, 1.0f, false);
+        ByteBuffer data = ((ByteBuffer) frames[0].getImageData()).duplicate();
+        data.rewind();
+        byte[] pixels = new byte[data.remaining()];
+        data.get(pixels);
+        return pixels;
+    }
+
+    /**
+     * Rewrites every DQT segment with 16-bit entries of 32768 plus the
+     * original value, leaving the scans as they are.
+     */
+    private static byte[] withLargeQuantizers(byte[] jpeg) {
+        ByteArrayOutputStream out = new ByteArrayOutputStream();
+        out.write(jpeg, 0, 2);
+        int i = 2;
+        while (i < jpeg.length) {
+            int marker = jpeg[i + 1] & 0xff;
+            int length = (jpeg[i + 2] & 0xff) << 8 | (jpeg[i + 3] & 0xff);
+            if (marker == 0xda) {
+                out.write(jpeg, i, jpeg.length - i);
+                break;
+            }
+            if (marker != 0xdb) {
+                out.write(jpeg, i, length + 2);
+            } else {
+                ByteArrayOutputStream tables = new ByteArrayOutputStream();
+                int p = i + 4;
+                while (p < i + 2 + length) {
+                    boolean wide = (jpeg[p] & 0xf0) != 0;
+                    tables.write(0x10 | (jpeg[p++] & 0x0f));
+                    for (int k = 0; k < 64; k++) {
+                        int value = wide ? (jpeg[p] & 0xff) << 8 | (jpeg[p + 1] & 0xff) : jpeg[p] & 0xff;
+                        p += wide ? 2 : 1;
+                        value += 32768;
+                        tables.write(value >> 8);
+                        tables.write(value);
+                    }
+                }
+                out.write(0xff);
+                out.write(0xdb);
+                out.write((tables.size() + 2) >> 8);
+                out.write(tables.size() + 2);
+                out.write(tables.toByteArray(), 0, tables.size());
+            }
+            i += length + 2;
+        }
+        return out.toByteArray();
+    }
+
+    private void check(int type, boolean progressive, boolean subsampled) throws IOException {
+        BufferedImage image = createImage(type);
+        for (float quality : QUALITIES) {
+            byte[] jpeg = encode(image, quality, progressive, subsampled);
+            assertArrayEquals(decode(jpeg, false), decode(jpeg, true), "Quality " + quality);
+        }
+    }
+
+    @Test
+    public void testBaseline() throws IOException {
+        check(BufferedImage.TYPE_INT_RGB, false, true);
+    }
+
+    @Test
+    public void testProgressive() throws IOException {
+        check(BufferedImage.TYPE_INT_RGB, true, true);
+    }
+
+    @Test
+    public void testFullResolutionChroma() throws IOException {
+        check(BufferedImage.TYPE_INT_RGB, false, false);
+    }
+
+    @Test
+    public void testGrayscale() throws IOException {
+        check(BufferedImage.TYPE_BYTE_GRAY, false, true);
+    }
+
+    @Test
+    public void testLargeQuantizers() throws IOException {
+        BufferedImage image = createImage(BufferedImage.TYPE_INT_RGB);
+        for (float quality : QUALITIES) {
+            byte[] jpeg = withLargeQuantizers(encode(image, quality, false, true));
+            assertArrayEquals(decode(jpeg, false), decode(jpeg, true), "Quality " + quality);
+        }
+    }
+}
@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.com.sun.javafx.iio;
+
+import static org.junit.jupiter.api.Assertions.assertEquals;
+import static org.junit.jupiter.api.Assertions.assertTrue;
+import com.sun.javafx.iio.ImageFrame;
+import com.sun.javafx.iio.jpeg.JPEGImageLoaderShim;
+import java.awt.image.BufferedImage;
+import java.io.ByteArrayInputStream;
+import java.io.ByteArrayOutputStream;
+import java.io.IOException;
+import java.nio.ByteBuffer;
+import javax.imageio.IIOImage;
+import javax.imageio.ImageIO;
+import javax.imageio.ImageWriteParam;
+import javax.imageio.ImageWriter;
+import javax.imageio.stream.ImageOutputStream;
+import org.junit.jupiter.api.BeforeAll;
+import org.junit.jupiter.api.Test;
+
+/**
+ * Checks that large JPEGs decoded to thumbnails are scaled by the inverse
+ * DCT, and resampled only for what is left to the requested size.
+ */
+public class JPEGThumbnailTest {
+
+    private static final int WIDTH = 4000;
+    private static final int HEIGHT = 3000;
+
+    // Smooth content, so that a decoded pixel can be checked against the
+    // source at the same relative position
+    private static final int MAX_CHANNEL_ERROR = 12;
+
+    private static byte[] jpeg;
+
+    private static int sourceRGB(double fx, double fy) {
+        int r = (int) (255 * fx);
+        int g = (int) (255 * fy);
+        int b = (int) (127.5 + 127.5 * Math.sin(Math.PI * (fx + fy)));
+        return (r << 16) | (g << 8) | b;
+    }
+
+    private static byte[] encode(int width, int height) throws IOException {
+        BufferedImage image = new BufferedImage(width, height, BufferedImage.TYPE_INT_RGB);
+        for (int y = 0; y < height; y++) {
+            for (int x = 0; x < width; x++) {
+                image.setRGB(x, y, sourceRGB((x + 0.5) / width, (y + 0.5) / height));
+            }
+        }
+        ImageWriter writer = ImageIO.getImageWritersByFormatName("jpeg").next();
+        try {
+            ImageWriteParam param = writer.getDefaultWriteParam();
+            param.setCompressionMode(ImageWriteParam.MODE_EXPLICIT);
+            param.setCompressionQuality(0.9f);
+            ByteArrayOutputStream out = new ByteArrayOutputStream();
+            try (ImageOutputStream ios = ImageIO.createImageOutputStream(out)) {
+                writer.setOutput(ios);
+                writer.write(null, new IIOImage(image, null, null), param);
+            }
+            return out.toByteArray();
+        } finally {
+            writer.dispose();
+        }
+    }
+
+    @BeforeAll
+    public static void setupOnce() throws IOException {
+        jpeg = encode(WIDTH, HEIGHT);
+    }
+
+    private static ImageFrame load(byte[] data, int width, int height, int[] decoded) throws IOException {
+        return JPEGImageLoaderShim.load(new ByteArrayInputStream(data), width, height, true, true, decoded);
+    }
+
+    private static void checkPixels(ImageFrame frame) {
+        int width = frame.getWidth();
+        int height = frame.getHeight();
+        ByteBuffer data = (ByteBuffer) frame.getImageData();
+        for (int y = 0; y < height; y++) {
+            for (int x = 0; x < width; x++) {
+                int expected = sourceRGB((x + 0.5) / width, (y + 0.5) / height);
+                int offset = y * frame.getStride() + x * 3;
+                for (int c = 0; c < 3; c++) {
+                    int e = (expected >> (16 - 8 * c)) & 0xff;
+                    int a = data.get(offset + c) & 0xff;
+                    assertTrue(Math.abs(e - a) <= MAX_CHANNEL_ERROR,
+                            "Pixel " + x + ", " + y + " channel " + c + ": expected " + e + ", was " + a);
+                }
+            }
+        }
+    }
+
+    @Test
+    public void testThumbnail() throws IOException {
+        int[] decoded = new int[3];
+        ImageFrame frame = load(jpeg, 400, 300, decoded);
+
+        // 1/8 is the smallest scale that still reaches 400x300
+        assertEquals(1, decoded[0]);
+        assertEquals(500, decoded[1]);
+        assertEquals(375, decoded[2]);
+        assertEquals(400, frame.getWidth());
+        assertEquals(300, frame.getHeight());
+        assertEquals(400 * 3, frame.getStride());
+        checkPixels(frame);
+    }
+
+    @Test
+    public void testExactScale() throws IOException {
+        int[] decoded = new int[3];
+        ImageFrame frame = load(jpeg, 1000, 750, decoded);
+
+        assertEquals(2, decoded[0]);
+        assertEquals(1000, decoded[1]);
+        assertEquals(750, decoded[2]);
+        assertEquals(1000, frame.getWidth());
+        assertEquals(750, frame.getHeight());
+        checkPixels(frame);
+    }
+
+    @Test
+    public void testRoundedSideIsKept() throws IOException {
+        // 2001 / 4 = 500.25, which libjpeg rounds up to 501 and
+        // computeDimensions rounds down to 500
+        byte[] data = encode(3000, 2001);
+        int[] decoded = new int[3];
+        ImageFrame frame = load(data, 750, 0, decoded);
+
+        assertEquals(2, decoded[0]);
+        assertEquals(750, decoded[1]);
+        assertEquals(501, decoded[2]);
+        assertEquals(750, frame.getWidth());
+        assertEquals(501, frame.getHeight());
+        checkPixels(frame);
+
+        // A bounding box of 750x500 does not leave room for the extra row
+        frame = load(data, 750, 500, decoded);
+        assertEquals(750, frame.getWidth());
+        assertEquals(500, frame.getHeight());
+    }
+}
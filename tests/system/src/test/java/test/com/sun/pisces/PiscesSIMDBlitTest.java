@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.com.sun.pisces;
+
+import static org.junit.jupiter.api.Assertions.assertArrayEquals;
+import static org.junit.jupiter.api.Assumptions.assumeTrue;
+import com.sun.pisces.JavaSurface;
+import com.sun.pisces.PiscesRenderer;
+import com.sun.pisces.RendererBase;
+import com.sun.pisces.Transform6;
+import java.util.Random;
+import java.util.concurrent.CountDownLatch;
+import java.util.function.Consumer;
+import org.junit.jupiter.api.AfterAll;
+import org.junit.jupiter.api.AfterEach;
+import org.junit.jupiter.api.BeforeAll;
+import org.junit.jupiter.api.Test;
+import test.util.Util;
+
+/**
+ * Checks that the SSE2 and NEON versions of the Pisces SrcOver blits give
+ * the same pixels as the scalar versions, for random premultiplied
+ * destinations, colors, textures and coverage.
+ */
+public class PiscesSIMDBlitTest {
+
+    // Not a multiple of 4, so every row ends with scalar pixels
+    private static final int WIDTH = 61;
+    private static final int HEIGHT = 23;
+    private static final int ITERATIONS = 200;
+
+    private final Random random = new Random(31);
+
+    @BeforeAll
+    public static void setupOnce() {
+        System.setProperty("glass.platform", "Headless");
+        System.setProperty("prism.order", "sw");
+        CountDownLatch startupLatch = new CountDownLatch(1);
+        Util.startup(startupLatch, startupLatch::countDown);
+    }
+
+    @AfterAll
+    public static void teardownOnce() {
+        Util.shutdown();
+    }
+
+    @AfterEach
+    public void restoreSIMD() {
+        PiscesRenderer.setSIMDEnabled(true);
+    }
+
+    private int randomPremultiplied() {
+        int a = switch (random.nextInt(4)) {
+            case 0 -> 0;
+            case 1 -> 255;
+            default -> random.nextInt(256);
+        };
+        int r = random.nextInt(a + 1);
+        int g = random.nextInt(a + 1);
+        int b = random.nextInt(a + 1);
+        return (a << 24) | (r << 16) | (g << 8) | b;
+    }
+
+    private int[] randomPixels() {
+        int[] data = new int[WIDTH * HEIGHT];
+        for (int i = 0; i < data.length; i++) {
+            data[i] = randomPremultiplied();
+        }
+        return data;
+    }
+
+    private byte[] randomMask() {
+        byte[] mask = new byte[WIDTH * HEIGHT];
+        boolean sparse = random.nextBoolean();
+        for (int i = 0; i < mask.length; i++) {
+            int kind = random.nextInt(sparse ? 8 : 4);
+            mask[i] = kind == 0 ? (byte) 0xff : kind < 3 ? (byte) random.nextInt(256) : 0;
+        }
+        return mask;
+    }
+
+    private void setRandomPaint(PiscesRenderer pr, boolean texture, int[] textureData,
+                                int red, int green, int blue, int alpha) {
+        if (texture) {
+            pr.setTexture(RendererBase.TYPE_INT_ARGB_PRE, textureData, WIDTH, HEIGHT, WIDTH,
+                    new Transform6(1 << 16, 0, 0, 1 << 16, 0, 0), false, false, true);
+        } else {
+            pr.setColor(red, green, blue, alpha);
+        }
+    }
+
+    private int[] render(boolean simd, int[] destination, Consumer<PiscesRenderer> drawing) {
+        PiscesRenderer.setSIMDEnabled(simd);
+        int[] data = destination.clone();
+        JavaSurface surface = new JavaSurface(data, RendererBase.TYPE_INT_ARGB_PRE, WIDTH, HEIGHT);
+        PiscesRenderer pr = new PiscesRenderer(surface);
+        pr.setCompositeRule(RendererBase.COMPOSITE_SRC_OVER);
+        drawing.accept(pr);
+        return data;
+    }
+
+    private void checkMask(boolean texture) {
+        for (int i = 0; i < ITERATIONS; i++) {
+            int[] destination = randomPixels();
+            int[] textureData = randomPixels();
+            byte[] mask = randomMask();
+            int red = random.nextInt(256);
+            int green = random.nextInt(256);
+            int blue = random.nextInt(256);
+            int alpha = random.nextBoolean() ? 255 : random.nextInt(256);
+            int x = random.nextInt(4);
+            int width = WIDTH - x - random.nextInt(4);
+
+            Consumer<PiscesRenderer> drawing = pr -> {
+                setRandomPaint(pr, texture, textureData, red, green, blue, alpha);
+                pr.fillAlphaMask(mask, x, 0, width, HEIGHT, 0, WIDTH);
+            };
+            int[] expected = render(false, destination, drawing);
+            int[] actual = render(true, destination, drawing);
+            assertArrayEquals(expected, actual, "Iteration " + i);
+        }
+    }
+
+    private void checkCoverage(boolean texture) {
+        byte[] alphaMap = new byte[257];
+        for (int i = 0; i < alphaMap.length; i++) {
+            alphaMap[i] = (byte) Math.min(255, i);
+        }
+        for (int i = 0; i < ITERATIONS; i++) {
+            int[] destination = randomPixels();
+            int[] textureData = randomPixels();
+            int[][] rows = new int[HEIGHT][WIDTH];
+            for (int[] deltas : rows) {
+                int sum = 0;
+                for (int j = 0; j < WIDTH; j++) {
+                    int delta = random.nextInt(3) == 0 ? 0 : random.nextInt(129) - 64;
+                    delta = Math.max(-sum, Math.min(256 - sum, delta));
+                    deltas[j] = delta;
+                    sum += delta;
+                }
+            }
+            int red = random.nextInt(256);
+            int green = random.nextInt(256);
+            int blue = random.nextInt(256);
+            int alpha = random.nextBoolean() ? 255 : random.nextInt(256);
+
+            Consumer<PiscesRenderer> drawing = pr -> {
+                setRandomPaint(pr, texture, textureData, red, green, blue, alpha);
+                for (int y = 0; y < HEIGHT; y++) {
+                    // emitAndClearAlphaRow() clears the deltas
+                    int[] deltas = rows[y].clone();
+                    pr.emitAndClearAlphaRow(alphaMap, deltas, y, 0, WIDTH - 1, y);
+                }
+            };
+            int[] expected = render(false, destination, drawing);
+            int[] actual = render(true, destination, drawing);
+            assertArrayEquals(expected, actual, "Iteration " + i);
+        }
+    }
+
+    @Test
+    public void testColorMask() {
+        assumeTrue(PiscesRenderer.setSIMDEnabled(true), "No SIMD blits on this platform");
+        checkMask(false);
+    }
+
+    @Test
+    public void testTextureMask() {
+        assumeTrue(PiscesRenderer.setSIMDEnabled(true), "No SIMD blits on this platform");
+        checkMask(true);
+    }
+
+    @Test
+    public void testColorCoverage() {
+        assumeTrue(PiscesRenderer.setSIMDEnabled(true), "No SIMD blits on this platform");
+        checkCoverage(false);
+    }
+
+    @Test
+    public void testTextureCoverage() {
+        assumeTrue(PiscesRenderer.setSIMDEnabled(true), "No SIMD blits on this platform");
+        checkCoverage(true);
+    }
+}
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.com.sun.pisces;
+
+import static org.junit.jupiter.api.Assertions.assertArrayEquals;
+import static org.junit.jupiter.api.Assumptions.assumeTrue;
+import com.sun.pisces.JavaSurface;
+import com.sun.pisces.PiscesRenderer;
+import com.sun.pisces.RendererBase;
+import com.sun.pisces.Transform6;
+import java.util.Random;
+import java.util.concurrent.CountDownLatch;
+import org.junit.jupiter.api.AfterAll;
+import org.junit.jupiter.api.AfterEach;
+import org.junit.jupiter.api.BeforeAll;
+import org.junit.jupiter.api.Test;
+import test.util.Util;
+
+/**
+ * Checks that the SSE2 and NEON versions of the Pisces bilinear texture
+ * paint give the same pixels as the scalar version, for random translate
+ * and scale transforms, with and without repeat and alpha.
+ */
+public class PiscesSIMDPaintTest {
+
+    // Not a multiple of 4, so every row ends with scalar pixels
+    private static final int WIDTH = 61;
+    private static final int HEIGHT = 23;
+    private static final int ITERATIONS = 200;
+
+    private final Random random = new Random(34);
+
+    @BeforeAll
+    public static void setupOnce() {
+        System.setProperty("glass.platform", "Headless");
+        System.setProperty("prism.order", "sw");
+        CountDownLatch startupLatch = new CountDownLatch(1);
+        Util.startup(startupLatch, startupLatch::countDown);
+    }
+
+    @AfterAll
+    public static void teardownOnce() {
+        Util.shutdown();
+    }
+
+    @AfterEach
+    public void restoreSIMD() {
+        PiscesRenderer.setSIMDEnabled(true);
+    }
+
+    private int randomPremultiplied(boolean hasAlpha) {
+        int a = hasAlpha ? random.nextInt(256) : 255;
+        int r = random.nextInt(a + 1);
+        int g = random.nextInt(a + 1);
+        int b = random.nextInt(a + 1);
+        return (a << 24) | (r << 16) | (g << 8) | b;
+    }
+
+    private int[] render(boolean simd, int[] texture, int textureWidth, int textureHeight,
+                         Transform6 transform, boolean repeat, boolean hasAlpha) {
+        PiscesRenderer.setSIMDEnabled(simd);
+        int[] data = new int[WIDTH * HEIGHT];
+        JavaSurface surface = new JavaSurface(data, RendererBase.TYPE_INT_ARGB_PRE, WIDTH, HEIGHT);
+        PiscesRenderer pr = new PiscesRenderer(surface);
+        pr.setCompositeRule(RendererBase.COMPOSITE_SRC);
+        pr.setTexture(RendererBase.TYPE_INT_ARGB_PRE, texture, textureWidth, textureHeight,
+                textureWidth, transform, repeat, true, hasAlpha);
+        pr.fillRect(0, 0, WIDTH << 16, HEIGHT << 16);
+        return data;
+    }
+
+    private void checkTexture(boolean scale, boolean repeat, boolean hasAlpha) {
+        for (int i = 0; i < ITERATIONS; i++) {
+            int textureWidth = 1 + random.nextInt(40);
+            int textureHeight = 1 + random.nextInt(30);
+            int[] texture = new int[textureWidth * textureHeight];
+            for (int j = 0; j < texture.length; j++) {
+                texture[j] = randomPremultiplied(hasAlpha);
+            }
+            // texture to device, from a quarter to four times the texture size
+            int m00 = scale ? (1 << 14) + random.nextInt(1 << 18) : 1 << 16;
+            int m11 = scale ? (1 << 14) + random.nextInt(1 << 18) : 1 << 16;
+            int m02 = random.nextInt(40 << 16) - (20 << 16);
+            int m12 = random.nextInt(20 << 16) - (10 << 16);
+            Transform6 transform = new Transform6(m00, 0, 0, m11, m02, m12);
+
+            int[] expected = render(false, texture, textureWidth, textureHeight, transform, repeat, hasAlpha);
+            int[] actual = render(true, texture, textureWidth, textureHeight, transform, repeat, hasAlpha);
+            assertArrayEquals(expected, actual, "Iteration " + i);
+        }
+    }
+
+    @Test
+    public void testTranslate() {
+        assumeTrue(PiscesRenderer.setSIMDEnabled(true), "No SIMD paint on this platform");
+        checkTexture(false, false, true);
+        checkTexture(false, true, true);
+    }
+
+    @Test
+    public void testScale() {
+        assumeTrue(PiscesRenderer.setSIMDEnabled(true), "No SIMD paint on this platform");
+        checkTexture(true, false, true);
+        checkTexture(true, false, false);
+    }
+
+    @Test
+    public void testScaleRepeat() {
+        assumeTrue(PiscesRenderer.setSIMDEnabled(true), "No SIMD paint on this platform");
+        checkTexture(true, true, true);
+        checkTexture(true, true, false);
+    }
+}
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+package test.com.sun.pisces;
+
+import static org.junit.jupiter.api.Assertions.assertArrayEquals;
+import com.sun.pisces.GradientColorMap;
+import com.sun.pisces.JavaSurface;
+import com.sun.pisces.PiscesRenderer;
+import com.sun.pisces.RendererBase;
+import com.sun.pisces.Transform6;
+import java.util.ArrayList;
+import java.util.List;
+import java.util.Random;
+import java.util.concurrent.CountDownLatch;
+import java.util.function.Consumer;
+import org.junit.jupiter.api.AfterAll;
+import org.junit.jupiter.api.BeforeAll;
+import org.junit.jupiter.api.Test;
+import test.util.Util;
+
+/**
+ * Checks that fills split into row bands and run on the Pisces worker
+ * threads give the same pixels as fills rendered on the calling thread.
+ * The worker count can only grow, so all the single-threaded references
+ * are rendered (with prism.swthreads=1) before four workers are started.
+ */
+public class PiscesWorkersTest {
+
+    // Large enough to be banded, with fractional top and bottom rows
+    private static final int WIDTH = 517;
+    private static final int HEIGHT = 389;
+
+    private static int[] texture;
+    private static final int TEXTURE_WIDTH = 37;
+    private static final int TEXTURE_HEIGHT = 29;
+
+    @BeforeAll
+    public static void setupOnce() {
+        System.setProperty("glass.platform", "Headless");
+        System.setProperty("prism.order", "sw");
+        System.setProperty("prism.swthreads", "1");
+        CountDownLatch startupLatch = new CountDownLatch(1);
+        Util.startup(startupLatch, startupLatch::countDown);
+
+        Random random = new Random(33);
+        texture = new int[TEXTURE_WIDTH * TEXTURE_HEIGHT];
+        for (int i = 0; i < texture.length; i++) {
+            int a = random.nextInt(256);
+            texture[i] = (a << 24) | (random.nextInt(a + 1) << 16)
+                    | (random.nextInt(a + 1) << 8) | random.nextInt(a + 1);
+        }
+    }
+
+    @AfterAll
+    public static void teardownOnce() {
+        Util.shutdown();
+    }
+
+    private static final int[] FRACTIONS = { 0x0000, 0x6000, 0x10000 };
+    private static final int[] COLORS = { 0xFF2040C0, 0x80E0A010, 0xFF10C060 };
+
+    private static final Transform6 IDENTITY = new Transform6(1 << 16, 0, 0, 1 << 16, 0, 0);
+
+    private static List<Consumer<PiscesRenderer>> paints() {
+        List<Consumer<PiscesRenderer>> paints = new ArrayList<>();
+        for (int cycle : new int[] { GradientColorMap.CYCLE_NONE,
+                                     GradientColorMap.CYCLE_REPEAT,
+                                     GradientColorMap.CYCLE_REFLECT }) {
+            paints.add(pr -> pr.setLinearGradient(30 << 16, 20 << 16, 210 << 16, 170 << 16,
+                    FRACTIONS, COLORS, cycle, IDENTITY));
+            paints.add(pr -> pr.setRadialGradient(260 << 16, 190 << 16, 230 << 16, 170 << 16,
+                    120 << 16, FRACTIONS, COLORS, cycle, IDENTITY));
+        }
+        // rotated and scaled gradient
+        paints.add(pr -> pr.setLinearGradient(0, 0, 100 << 16, 0,
+                FRACTIONS, COLORS, GradientColorMap.CYCLE_REFLECT,
+                new Transform6(46341, -46341, 46341, 46341, 100 << 16, 50 << 16)));
+        for (boolean repeat : new boolean[] { false, true }) {
+            // translated, then scaled, texture
+            paints.add(pr -> pr.setTexture(RendererBase.TYPE_INT_ARGB_PRE, texture,
+                    TEXTURE_WIDTH, TEXTURE_HEIGHT, TEXTURE_WIDTH,
+                    new Transform6(1 << 16, 0, 0, 1 << 16, (13 << 16) + 0x8000, 7 << 16),
+                    repeat, true, true));
+            paints.add(pr -> pr.setTexture(RendererBase.TYPE_INT_ARGB_PRE, texture,
+                    TEXTURE_WIDTH, TEXTURE_HEIGHT, TEXTURE_WIDTH,
+                    new Transform6(0x38000, 0, 0, 0x5C000, -(11 << 16), 3 << 16),
+                    repeat, true, true));
+        }
+        return paints;
+    }
+
+    private static int[] render(Consumer<PiscesRenderer> paint, int compositeRule) {
+        int[] data = new int[WIDTH * HEIGHT];
+        for (int i = 0; i < data.length; i++) {
+            data[i] = 0xFF000000 | (i * 0x010203);
+        }
+        JavaSurface surface = new JavaSurface(data, RendererBase.TYPE_INT_ARGB_PRE, WIDTH, HEIGHT);
+        PiscesRenderer pr = new PiscesRenderer(surface);
+        pr.setCompositeRule(compositeRule);
+        paint.accept(pr);
+        // fractional edges on all four sides
+        pr.fillRect(0x34000, 0x2C000, (WIDTH - 7) << 16, ((HEIGHT - 6) << 16) + 0x9000);
+        return data;
+    }
+
+    @Test
+    public void testBandedFillsMatchSingleThreaded() {
+        List<Consumer<PiscesRenderer>> paints = paints();
+        int[] rules = { RendererBase.COMPOSITE_SRC, RendererBase.COMPOSITE_SRC_OVER };
+
+        List<int[]> expected = new ArrayList<>();
+        for (Consumer<PiscesRenderer> paint : paints) {
+            for (int rule : rules) {
+                expected.add(render(paint, rule));
+            }
+        }
+
+        PiscesRenderer.setWorkerThreads(4);
+
+        int n = 0;
+        for (int i = 0; i < paints.size(); i++) {
+            for (int rule : rules) {
+                assertArrayEquals(expected.get(n++), render(paints.get(i), rule),
+                        "Paint " + i + ", composite rule " + rule);
+            }
+        }
+    }
+}
@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.com.sun.scenario.effect.impl.sw.sse;
+
+import static org.junit.jupiter.api.Assertions.assertArrayEquals;
+import static org.junit.jupiter.api.Assumptions.assumeTrue;
+import com.sun.scenario.effect.impl.sw.sse.SSEBoxBlurPeerShim;
+import com.sun.scenario.effect.impl.sw.sse.SSEBoxShadowPeerShim;
+import com.sun.scenario.effect.impl.sw.sse.SSERendererDelegate;
+import java.util.Arrays;
+import java.util.Random;
+import org.junit.jupiter.api.AfterEach;
+import org.junit.jupiter.api.BeforeAll;
+import org.junit.jupiter.api.Test;
+
+/**
+ * Checks that the SSE2 versions of the Decora box blur and box shadow
+ * filters give the same pixels as the scalar versions, for random images,
+ * box sizes, spreads and shadow colors.
+ */
+public class SSEBoxFilterTest {
+
+    private static final int ITERATIONS = 500;
+
+    private final Random random = new Random(35);
+
+    private interface Filter {
+        void apply(int[] dst, int dstw, int dsth, int dstscan,
+                   int[] src, int srcw, int srch, int srcscan);
+    }
+
+    @BeforeAll
+    public static void setupOnce() {
+        boolean supported;
+        try {
+            supported = SSERendererDelegate.isSupported();
+        } catch (UnsatisfiedLinkError e) {
+            supported = false;
+        }
+        assumeTrue(supported, "No Decora SSE library on this platform");
+        assumeTrue(SSERendererDelegate.setSSE2Enabled(true), "No SSE2 box filters on this platform");
+    }
+
+    @AfterEach
+    public void restoreSSE2() {
+        SSERendererDelegate.setSSE2Enabled(true);
+    }
+
+    private int randomPixel() {
+        return switch (random.nextInt(4)) {
+            case 0 -> 0;
+            case 1 -> 0xff000000 | random.nextInt(1 << 24);
+            default -> random.nextInt();
+        };
+    }
+
+    private float randomFraction() {
+        return switch (random.nextInt(4)) {
+            case 0 -> 0f;
+            case 1 -> 1f;
+            default -> random.nextInt(1001) / 1000f;
+        };
+    }
+
+    private int[] filter(boolean sse2, Filter filter, int dstw, int dsth, int dstscan,
+                         int[] src, int srcw, int srch, int srcscan) {
+        SSERendererDelegate.setSSE2Enabled(sse2);
+        // the padding at the end of each row must stay untouched
+        int[] dst = new int[dstscan * dsth];
+        Arrays.fill(dst, 0x12345678);
+        filter.apply(dst, dstw, dsth, dstscan, src, srcw, srch, srcscan);
+        return dst;
+    }
+
+    private void check(boolean horizontal, Filter filter) {
+        for (int i = 0; i < ITERATIONS; i++) {
+            // wide enough now and then for more than one column block
+            int srcw = 1 + random.nextInt(random.nextInt(8) == 0 ? 600 : 70);
+            int srch = 1 + random.nextInt(40);
+            int grow = random.nextInt(40);
+            int dstw = horizontal ? srcw + grow : srcw;
+            int dsth = horizontal ? srch : srch + grow;
+            int srcscan = srcw + random.nextInt(5);
+            int dstscan = dstw + random.nextInt(5);
+            int[] src = new int[srcscan * srch];
+            for (int j = 0; j < src.length; j++) {
+                src[j] = randomPixel();
+            }
+
+            int[] expected = filter(false, filter, dstw, dsth, dstscan, src, srcw, srch, srcscan);
+            int[] actual = filter(true, filter, dstw, dsth, dstscan, src, srcw, srch, srcscan);
+            assertArrayEquals(expected, actual, "Iteration " + i);
+        }
+    }
+
+    @Test
+    public void testBlurHorizontal() {
+        check(true, SSEBoxBlurPeerShim::filterHorizontal);
+    }
+
+    @Test
+    public void testBlurVertical() {
+        check(false, SSEBoxBlurPeerShim::filterVertical);
+    }
+
+    @Test
+    public void testShadowHorizontalBlack() {
+        for (int i = 0; i < 5; i++) {
+            float spread = randomFraction();
+            check(true, (dst, dstw, dsth, dstscan, src, srcw, srch, srcscan) ->
+                    SSEBoxShadowPeerShim.filterHorizontalBlack(dst, dstw, dsth, dstscan,
+                            src, srcw, srch, srcscan, spread));
+        }
+    }
+
+    @Test
+    public void testShadowVerticalBlack() {
+        for (int i = 0; i < 5; i++) {
+            float spread = randomFraction();
+            check(false, (dst, dstw, dsth, dstscan, src, srcw, srch, srcscan) ->
+                    SSEBoxShadowPeerShim.filterVerticalBlack(dst, dstw, dsth, dstscan,
+                            src, srcw, srch, srcscan, spread));
+        }
+    }
+
+    @Test
+    public void testShadowVertical() {
+        for (int i = 0; i < 5; i++) {
+            float spread = randomFraction();
+            float[] color = { randomFraction(), randomFraction(), randomFraction(), randomFraction() };
+            check(false, (dst, dstw, dsth, dstscan, src, srcw, srch, srcscan) ->
+                    SSEBoxShadowPeerShim.filterVertical(dst, dstw, dsth, dstscan,
+                            src, srcw, srch, srcscan, spread, color));
+        }
+    }
+}
@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.com.sun.scenario.effect.impl.sw.sse;
+
+import static org.junit.jupiter.api.Assertions.assertArrayEquals;
+import static org.junit.jupiter.api.Assertions.assertTrue;
+import static org.junit.jupiter.api.Assumptions.assumeTrue;
+import com.sun.scenario.effect.Blend;
+import com.sun.scenario.effect.impl.sw.sse.SSEBlendPeerShim;
+import com.sun.scenario.effect.impl.sw.sse.SSEColorAdjustPeerShim;
+import com.sun.scenario.effect.impl.sw.sse.SSEPerspectiveTransformPeerShim;
+import com.sun.scenario.effect.impl.sw.sse.SSERendererDelegate;
+import java.util.Arrays;
+import java.util.Random;
+import org.junit.jupiter.api.AfterEach;
+import org.junit.jupiter.api.BeforeAll;
+import org.junit.jupiter.api.Test;
+
+/**
+ * Checks the generated Decora SSE peers: filtering the destination in
+ * row bands gives the same pixels as filtering it in one pass, and the
+ * vector loops give the pixels of the scalar loop, to within the one
+ * step -ffast-math may round a component differently.
+ */
+public class SSEGeneratedPeerTest {
+
+    private static final int ITERATIONS = 50;
+
+    private static int maxLanes;
+
+    private final Random random = new Random(36);
+
+    private interface Filter {
+        void apply(int numBands, int[] dst, int dstw, int dsth, int dstscan);
+    }
+
+    @BeforeAll
+    public static void setupOnce() {
+        boolean supported;
+        try {
+            supported = SSERendererDelegate.isSupported();
+        } catch (UnsatisfiedLinkError e) {
+            supported = false;
+        }
+        assumeTrue(supported, "No Decora SSE library on this platform");
+        maxLanes = SSERendererDelegate.setVectorLanes(8);
+    }
+
+    @AfterEach
+    public void restoreLanes() {
+        SSERendererDelegate.setVectorLanes(maxLanes);
+    }
+
+    private int randomPixel() {
+        int a = switch (random.nextInt(4)) {
+            case 0 -> 0;
+            case 1 -> 0xff;
+            default -> random.nextInt(256);
+        };
+        // premultiplied, as the peers expect
+        int r = random.nextInt(a + 1);
+        int g = random.nextInt(4) == 0 ? r : random.nextInt(a + 1);
+        int b = random.nextInt(a + 1);
+        return (a << 24) | (r << 16) | (g << 8) | b;
+    }
+
+    private int[] randomImage(int scan, int h) {
+        int[] img = new int[scan * h];
+        for (int i = 0; i < img.length; i++) {
+            img[i] = randomPixel();
+        }
+        return img;
+    }
+
+    private int[] filter(Filter filter, int lanes, int numBands, int dstw, int dsth, int dstscan) {
+        SSERendererDelegate.setVectorLanes(lanes);
+        // the padding at the end of each row must stay untouched
+        int[] dst = new int[dstscan * dsth];
+        Arrays.fill(dst, 0x12345678);
+        filter.apply(numBands, dst, dstw, dsth, dstscan);
+        return dst;
+    }
+
+    private static void assertClose(int[] expected, int[] actual, String message) {
+        for (int i = 0; i < expected.length; i++) {
+            for (int shift = 0; shift < 32; shift += 8) {
+                int e = (expected[i] >> shift) & 0xff;
+                int a = (actual[i] >> shift) & 0xff;
+                assertTrue(Math.abs(e - a) <= 1, message + ": pixel " + i + " is " +
+                        Integer.toHexString(actual[i]) + ", expected " +
+                        Integer.toHexString(expected[i]));
+            }
+        }
+    }
+
+    private void check(Filter filter, int dstw, int dsth, int dstscan, String message) {
+        int[] scalar = filter(filter, 1, 1, dstw, dsth, dstscan);
+        for (int lanes = 4; lanes <= maxLanes; lanes *= 2) {
+            int[] single = filter(filter, lanes, 1, dstw, dsth, dstscan);
+            assertClose(scalar, single, message + ", " + lanes + " lanes");
+            int numBands = 2 + random.nextInt(6);
+            int[] banded = filter(filter, lanes, numBands, dstw, dsth, dstscan);
+            assertArrayEquals(single, banded, message + ", " + lanes + " lanes, " + numBands + " bands");
+        }
+        int[] banded = filter(filter, 1, 2 + random.nextInt(6), dstw, dsth, dstscan);
+        assertArrayEquals(scalar, banded, message + ", scalar, banded");
+    }
+
+    @Test
+    public void testColorAdjust() {
+        for (int i = 0; i < ITERATIONS; i++) {
+            int srcw = 1 + random.nextInt(60);
+            int srch = 1 + random.nextInt(40);
+            int srcscan = srcw + random.nextInt(5);
+            int[] src = randomImage(srcscan, srch);
+            // wider than the source now and then, so that columns repeat
+            int dstw = 1 + random.nextInt(80);
+            int dsth = 1 + random.nextInt(40);
+            int dstscan = dstw + random.nextInt(5);
+            float brightness = random.nextFloat() * 2f;
+            float contrast = 0.25f + random.nextFloat() * 3.75f;
+            float hue = random.nextFloat() * 2f - 1f;
+            float saturation = random.nextFloat() * 2f;
+            check((numBands, dst, w, h, scan) ->
+                    SSEColorAdjustPeerShim.filter(numBands, dst, w, h, scan,
+                            src, srcw, srch, srcscan,
+                            brightness, contrast, hue, saturation),
+                  dstw, dsth, dstscan, "Iteration " + i);
+        }
+    }
+
+    @Test
+    public void testBlend() {
+        for (Blend.Mode mode : Blend.Mode.values()) {
+            for (int i = 0; i < ITERATIONS / 5; i++) {
+                int dstw = 1 + random.nextInt(80);
+                int dsth = 1 + random.nextInt(40);
+                int dstscan = dstw + random.nextInt(5);
+                int[] bot = randomImage(dstscan, dsth);
+                int[] top = randomImage(dstscan, dsth);
+                float opacity = random.nextInt(3) == 0 ? 1f : random.nextFloat();
+                check((numBands, dst, w, h, scan) ->
+                        SSEBlendPeerShim.filter(mode, numBands, dst, w, h, scan,
+                                bot, top, opacity),
+                      dstw, dsth, dstscan, mode + ", iteration " + i);
+            }
+        }
+    }
+
+    @Test
+    public void testPerspectiveTransform() {
+        for (int i = 0; i < ITERATIONS; i++) {
+            int srcw = 1 + random.nextInt(60);
+            int srch = 1 + random.nextInt(40);
+            int srcscan = srcw + random.nextInt(5);
+            int[] src = randomImage(srcscan, srch);
+            int dstw = 1 + random.nextInt(80);
+            int dsth = 1 + random.nextInt(40);
+            int dstscan = dstw + random.nextInt(5);
+            // around the identity, mapping some pixels outside the source
+            float[][] tx = new float[3][3];
+            for (int r = 0; r < 3; r++) {
+                for (int c = 0; c < 3; c++) {
+                    tx[r][c] = (r == c ? 1f : 0f) + (random.nextFloat() - 0.5f) * 0.4f;
+                }
+            }
+            check((numBands, dst, w, h, scan) ->
+                    SSEPerspectiveTransformPeerShim.filter(numBands, dst, w, h, scan,
+                            src, srcw, srch, srcscan, tx),
+                  dstw, dsth, dstscan, "Iteration " + i);
+        }
+    }
+}
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.javafx.scene.media;
+
+import static org.junit.jupiter.api.Assertions.assertNull;
+import static org.junit.jupiter.api.Assertions.assertTrue;
+import com.sun.net.httpserver.HttpExchange;
+import com.sun.net.httpserver.HttpServer;
+import java.io.IOException;
+import java.io.OutputStream;
+import java.net.InetAddress;
+import java.net.InetSocketAddress;
+import java.nio.charset.StandardCharsets;
+import java.util.Locale;
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.Executors;
+import java.util.concurrent.atomic.AtomicInteger;
+import java.util.concurrent.atomic.AtomicReference;
+import javafx.scene.media.Media;
+import javafx.scene.media.MediaException;
+import javafx.scene.media.MediaPlayer;
+import org.junit.jupiter.api.AfterAll;
+import org.junit.jupiter.api.BeforeAll;
+import org.junit.jupiter.api.Test;
+import test.util.Util;
+
+/**
+ * Plays an HLS stream of MP3 segments from a local HTTP server that delays
+ * every segment request, as a high latency link would.
+ */
+public class HLSPlaybackTest {
+
+    private static final int SEGMENT_COUNT = 6;
+    private static final int SEGMENT_LATENCY_MS = 400;
+
+    // MPEG-1 Layer III, 128 kbps, 44.1 kHz, mono, no CRC. A frame of a header
+    // and zeros decodes to 1152 samples of silence.
+    private static final byte[] FRAME_HEADER = { (byte) 0xFF, (byte) 0xFB, (byte) 0x90, (byte) 0xC0 };
+    private static final int FRAME_SIZE = 417;
+    private static final int FRAME_SAMPLES = 1152;
+    private static final int SAMPLE_RATE = 44100;
+    private static final int FRAMES_PER_SEGMENT = 2 * SAMPLE_RATE / FRAME_SAMPLES;
+
+    private static HttpServer server;
+    private static String playlistURL;
+    private static final AtomicInteger segmentRequests = new AtomicInteger();
+
+    @BeforeAll
+    public static void setupOnce() throws IOException {
+        CountDownLatch startupLatch = new CountDownLatch(1);
+        Util.startup(startupLatch, startupLatch::countDown);
+
+        server = HttpServer.create(new InetSocketAddress(InetAddress.getLoopbackAddress(), 0), 0);
+        server.createContext("/", HLSPlaybackTest::handle);
+        server.setExecutor(Executors.newCachedThreadPool());
+        server.start();
+        playlistURL = "http://" + server.getAddress().getHostString() + ":"
+                + server.getAddress().getPort() + "/playlist.m3u8";
+    }
+
+    @AfterAll
+    public static void teardownOnce() {
+        if (server != null) {
+            server.stop(0);
+        }
+        Util.shutdown();
+    }
+
+    private static String playlist() {
+        double duration = (double) FRAMES_PER_SEGMENT * FRAME_SAMPLES / SAMPLE_RATE;
+        StringBuilder sb = new StringBuilder();
+        sb.append("#EXTM3U\n");
+        sb.append("#EXT-X-VERSION:3\n");
+        sb.append("#EXT-X-TARGETDURATION:2\n");
+        sb.append("#EXT-X-MEDIA-SEQUENCE:0\n");
+        for (int i = 0; i < SEGMENT_COUNT; i++) {
+            sb.append(String.format(Locale.ROOT, "#EXTINF:%.3f,\n", duration));
+            sb.append("segment").append(i).append(".mp3\n");
+        }
+        sb.append("#EXT-X-ENDLIST\n");
+        return sb.toString();
+    }
+
+    private static byte[] segment() {
+        byte[] data = new byte[FRAMES_PER_SEGMENT * FRAME_SIZE];
+        for (int i = 0; i < FRAMES_PER_SEGMENT; i++) {
+            System.arraycopy(FRAME_HEADER, 0, data, i * FRAME_SIZE, FRAME_HEADER.length);
+        }
+        return data;
+    }
+
+    private static void handle(HttpExchange exchange) throws IOException {
+        String path = exchange.getRequestURI().getPath();
+        byte[] body;
+        String contentType;
+        if (path.endsWith(".m3u8")) {
+            body = playlist().getBytes(StandardCharsets.UTF_8);
+            contentType = "application/vnd.apple.mpegurl";
+        } else if (path.endsWith(".mp3")) {
+            segmentRequests.incrementAndGet();
+            Util.sleep(SEGMENT_LATENCY_MS);
+            body = segment();
+            contentType = "audio/mpeg";
+        } else {
+            exchange.sendResponseHeaders(404, -1);
+            exchange.close();
+            return;
+        }
+        exchange.getResponseHeaders().set("Content-Type", contentType);
+        exchange.sendResponseHeaders(200, body.length);
+        try (OutputStream out = exchange.getResponseBody()) {
+            out.write(body);
+        }
+    }
+
+    @Test
+    public void testPlaybackWithSegmentLatency() {
+        CountDownLatch endLatch = new CountDownLatch(1);
+        AtomicReference<MediaException> error = new AtomicReference<>();
+        MediaPlayer[] player = new MediaPlayer[1];
+
+        Util.runAndWait(() -> {
+            player[0] = new MediaPlayer(new Media(playlistURL));
+            player[0].setOnError(() -> {
+                error.set(player[0].getError());
+                endLatch.countDown();
+            });
+            player[0].setOnEndOfMedia(endLatch::countDown);
+            player[0].play();
+        });
+
+        try {
+            Util.waitForLatch(endLatch, 60, "HLS playback did not reach the end of media");
+            assertNull(error.get(), "Playback failed");
+            assertTrue(segmentRequests.get() >= SEGMENT_COUNT,
+                    "Only " + segmentRequests.get() + " of " + SEGMENT_COUNT + " segments were requested");
+        } finally {
+            Util.runAndWait(() -> player[0].dispose());
+        }
+    }
+}
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.robot.com.sun.glass.ui.gtk;
+
+import static org.junit.jupiter.api.Assertions.assertArrayEquals;
+import static org.junit.jupiter.api.Assertions.assertTrue;
+import static org.junit.jupiter.api.Assumptions.assumeTrue;
+import java.util.concurrent.atomic.AtomicReference;
+import javafx.geometry.Bounds;
+import javafx.scene.Scene;
+import javafx.scene.layout.HBox;
+import javafx.scene.paint.Color;
+import javafx.scene.paint.CycleMethod;
+import javafx.scene.paint.LinearGradient;
+import javafx.scene.paint.Stop;
+import javafx.scene.shape.Rectangle;
+import javafx.stage.Stage;
+import org.junit.jupiter.api.BeforeEach;
+import org.junit.jupiter.api.Test;
+import com.sun.glass.ui.gtk.GtkRobotShim;
+import com.sun.javafx.PlatformUtil;
+import test.robot.testharness.VisualTestBase;
+
+/**
+ * Captures the same area of the screen repeatedly with capture streaming
+ * on, which keeps the MIT-SHM capture image between captures, and checks
+ * every capture against a capture through GdkPixbuf.
+ */
+public class GtkRobotCaptureTest extends VisualTestBase {
+
+    static {
+        // Read when GtkRobot is loaded, before the toolkit starts
+        System.setProperty("glass.gtk.captureStreaming", "true");
+    }
+
+    private static final int SIZE = 120;
+    private static final int CAPTURES = 10;
+
+    private Rectangle swatch;
+
+    @BeforeEach
+    public void setup() {
+        assumeTrue(PlatformUtil.isLinux());
+        assumeTrue(GtkRobotShim.isCaptureStreaming());
+        assumeTrue(GtkRobotShim.isX11Capture(), "Captures go through the screencast portal");
+
+        AtomicReference<Rectangle> rectangle = new AtomicReference<>();
+        runAndWait(() -> {
+            Stage stage = getStage();
+            Rectangle r = new Rectangle(SIZE, SIZE, gradient(Color.RED, Color.BLUE));
+            rectangle.set(r);
+            stage.setScene(new Scene(new HBox(r)));
+            stage.setX(100);
+            stage.setY(100);
+            stage.show();
+        });
+        waitFirstFrame();
+        swatch = rectangle.get();
+    }
+
+    private static LinearGradient gradient(Color from, Color to) {
+        return new LinearGradient(0, 0, 1, 1, true, CycleMethod.NO_CYCLE,
+                new Stop(0, from), new Stop(1, to));
+    }
+
+    private int[] getBounds(double inset) {
+        AtomicReference<int[]> bounds = new AtomicReference<>();
+        runAndWait(() -> {
+            Bounds b = swatch.localToScreen(swatch.getBoundsInLocal());
+            bounds.set(new int[] {
+                (int) Math.ceil(b.getMinX() + inset), (int) Math.ceil(b.getMinY() + inset),
+                (int) Math.floor(b.getWidth() - 2 * inset), (int) Math.floor(b.getHeight() - 2 * inset)
+            });
+        });
+        return bounds.get();
+    }
+
+    private int[] capture(int[] bounds, boolean pixbuf) {
+        int[] pixels = new int[bounds[2] * bounds[3]];
+        runAndWait(() -> {
+            if (pixbuf) {
+                GtkRobotShim.getPixbufScreenCapture(bounds[0], bounds[1], bounds[2], bounds[3], pixels);
+            } else {
+                GtkRobotShim.getScreenCapture(bounds[0], bounds[1], bounds[2], bounds[3], pixels);
+            }
+        });
+        return pixels;
+    }
+
+    private void assertStreamingMatchesPixbuf(int[] bounds) {
+        int[] expected = capture(bounds, true);
+        for (int i = 0; i < CAPTURES; i++) {
+            assertArrayEquals(expected, capture(bounds, false), "Capture " + i);
+        }
+    }
+
+    @Test
+    public void testRepeatedCaptures() {
+        int[] bounds = getBounds(10);
+        int[] pixels = capture(bounds, true);
+        int center = pixels[bounds[3] / 2 * bounds[2] + bounds[2] / 2];
+        assertTrue((center >> 16 & 0xff) > 0x40 && (center & 0xff) > 0x40,
+                String.format("Not the swatch: 0x%08x", center));
+
+        assertStreamingMatchesPixbuf(bounds);
+
+        // The kept image is read again, not served from the previous capture
+        runAndWait(() -> swatch.setFill(gradient(Color.YELLOW, Color.GREEN)));
+        waitNextFrame();
+        assertStreamingMatchesPixbuf(bounds);
+    }
+
+    @Test
+    public void testCapturesOfChangingSize() {
+        for (int inset = 0; inset < 40; inset += 10) {
+            assertStreamingMatchesPixbuf(getBounds(inset));
+        }
+    }
+}
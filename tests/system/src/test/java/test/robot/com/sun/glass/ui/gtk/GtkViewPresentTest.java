@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.robot.com.sun.glass.ui.gtk;
+
+import static org.junit.jupiter.api.Assertions.assertTrue;
+import static org.junit.jupiter.api.Assumptions.assumeTrue;
+import java.util.concurrent.atomic.AtomicLong;
+import javafx.scene.Scene;
+import javafx.scene.control.TextField;
+import javafx.scene.layout.VBox;
+import javafx.scene.paint.Color;
+import javafx.stage.Stage;
+import org.junit.jupiter.api.AfterEach;
+import org.junit.jupiter.api.BeforeEach;
+import org.junit.jupiter.api.Test;
+import com.sun.glass.ui.gtk.GtkViewShim;
+import com.sun.javafx.PlatformUtil;
+import test.robot.testharness.VisualTestBase;
+
+/**
+ * Checks that a blinking caret presents only its dirty region of the
+ * software-rendered window, through both XShm and Cairo.
+ */
+public class GtkViewPresentTest extends VisualTestBase {
+
+    static {
+        System.setProperty("prism.order", "sw");
+    }
+
+    private static final int WIDTH = 600;
+    private static final int HEIGHT = 400;
+
+    // Long enough for a few caret blinks
+    private static final long BLINK_MILLIS = 2000;
+
+    private Scene scene;
+    private long fullFrameBytes;
+
+    @BeforeEach
+    public void setup() {
+        assumeTrue(PlatformUtil.isLinux());
+
+        runAndWait(() -> {
+            Stage stage = getStage();
+            TextField field = new TextField("JavaFX");
+            scene = new Scene(new VBox(field), WIDTH, HEIGHT, Color.WHITE);
+            stage.setScene(scene);
+            stage.show();
+            field.requestFocus();
+            field.end();
+        });
+        waitFirstFrame();
+
+        runAndWait(() -> {
+            Stage stage = (Stage) scene.getWindow();
+            fullFrameBytes = Math.round(WIDTH * stage.getOutputScaleX())
+                    * Math.round(HEIGHT * stage.getOutputScaleY()) * 4;
+        });
+    }
+
+    @AfterEach
+    public void restoreShm() {
+        runAndWait(() -> GtkViewShim.setShmEnabled(true));
+    }
+
+    private long presentedBytes() {
+        AtomicLong bytes = new AtomicLong();
+        runAndWait(() -> bytes.set(GtkViewShim.getPresentedBytes()));
+        return bytes.get();
+    }
+
+    private void checkCaretBlink(boolean shm) {
+        runAndWait(() -> GtkViewShim.setShmEnabled(shm));
+
+        // A full frame first, so that the new path starts from a whole window
+        long before = presentedBytes();
+        runAndWait(() -> scene.setFill(shm ? Color.LIGHTGRAY : Color.WHITE));
+        waitNextFrame();
+        sleep(200);
+        long full = presentedBytes() - before;
+        assumeTrue(full > 0, "Not presented by the software pipeline");
+        assertTrue(full >= fullFrameBytes, "Full frame presented " + full + " bytes");
+
+        before = presentedBytes();
+        sleep(BLINK_MILLIS);
+        long blink = presentedBytes() - before;
+        assertTrue(blink > 0, "The caret did not blink");
+        assertTrue(blink < fullFrameBytes / 4,
+                "Caret blinks presented " + blink + " bytes, a full frame is " + fullFrameBytes);
+    }
+
+    @Test
+    public void testCaretBlinkShm() {
+        checkCaretBlink(true);
+    }
+
+    @Test
+    public void testCaretBlinkCairo() {
+        checkCaretBlink(false);
+    }
+}